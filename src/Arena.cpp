@@ -0,0 +1,79 @@
+/**
+ * @file Arena.cpp
+ * @brief This file contains the definitions of the members of the Arena class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "Arena.h"
+
+Arena::Arena() {
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(getHubs() == 0 && getCentra() == 0, "Arena must be empty");
+}
+
+bool Arena::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+Hub *Arena::createHub() {
+
+    REQUIRE(properlyInitialized(), "Arena must be properly initialized");
+    return fhubs.create();
+}
+
+VaccinationCenter *Arena::createCenter(const std::string &name, const std::string &address, int population,
+                                       int capacity) {
+
+    REQUIRE(properlyInitialized(), "Arena must be properly initialized");
+    return fcentra.create(name, address, population, capacity);
+}
+
+void Arena::destroy(Hub *hub) {
+
+    REQUIRE(properlyInitialized(), "Arena must be properly initialized");
+    REQUIRE(owns(hub), "Hub must be owned by the Arena");
+    fhubs.destroy(hub);
+}
+
+void Arena::destroy(VaccinationCenter *center) {
+
+    REQUIRE(properlyInitialized(), "Arena must be properly initialized");
+    REQUIRE(owns(center), "VaccinationCenter must be owned by the Arena");
+    fcentra.destroy(center);
+}
+
+bool Arena::owns(const Hub *hub) const {
+
+    REQUIRE(properlyInitialized(), "Arena must be properly initialized");
+    return fhubs.contains(hub);
+}
+
+bool Arena::owns(const VaccinationCenter *center) const {
+
+    REQUIRE(properlyInitialized(), "Arena must be properly initialized");
+    return fcentra.contains(center);
+}
+
+int Arena::getHubs() const {
+
+    REQUIRE(properlyInitialized(), "Arena must be properly initialized");
+    return fhubs.size();
+}
+
+int Arena::getCentra() const {
+
+    REQUIRE(properlyInitialized(), "Arena must be properly initialized");
+    return fcentra.size();
+}
+
+void Arena::clear() {
+
+    REQUIRE(properlyInitialized(), "Arena must be properly initialized");
+    fhubs.clear();
+    fcentra.clear();
+    ENSURE(getHubs() == 0 && getCentra() == 0, "Arena must be empty");
+}
@@ -0,0 +1,131 @@
+/**
+ * @file Arena.h
+ * @brief This header file contains the declarations and the members of the Arena class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_ARENA_H
+#define VACCINDISTRIBUTOR_ARENA_H
+
+#include <string>
+#include "DesignByContract.h"
+#include "ObjectPool.h"
+#include "Hub.h"
+#include "VaccinationCenter.h"
+
+/**
+ * \brief Class implemented to own the Hubs and VaccinationCenters of a Simulation
+ *
+ * The readers and the snapshot create the objects of a Simulation in its Arena and the Simulation releases all of
+ * them at once when it is cleared or destroyed. The Vaccins of a Hub or VaccinationCenter are owned by that object
+ * and are deleted when it is destroyed.
+ */
+class Arena {
+
+private:
+    ObjectPool<Hub> fhubs;
+    ObjectPool<VaccinationCenter> fcentra;
+    Arena *_initCheck;
+
+    Arena(const Arena &);
+
+    Arena &operator=(const Arena &);
+
+public:
+    /**
+     * \brief Default constructor for an Arena object without objects
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(getHubs() == 0 && getCentra() == 0, "Arena must be empty")
+     */
+    Arena();
+
+    /**
+     * \brief Check whether the Arena object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Create a Hub owned by the Arena
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Arena must be properly initialized")
+     */
+    Hub *createHub();
+
+    /**
+     * \brief Create a VaccinationCenter owned by the Arena
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Arena must be properly initialized")
+     */
+    VaccinationCenter *createCenter(const std::string &name, const std::string &address, int population,
+                                    int capacity);
+
+    /**
+     * \brief Destroy a Hub of the Arena before the others
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Arena must be properly initialized")
+     * REQUIRE(owns(hub), "Hub must be owned by the Arena")
+     */
+    void destroy(Hub *hub);
+
+    /**
+     * \brief Destroy a VaccinationCenter of the Arena before the others
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Arena must be properly initialized")
+     * REQUIRE(owns(center), "VaccinationCenter must be owned by the Arena")
+     */
+    void destroy(VaccinationCenter *center);
+
+    /**
+     * \brief Check whether a Hub is owned by the Arena
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Arena must be properly initialized")
+     */
+    bool owns(const Hub *hub) const;
+
+    /**
+     * \brief Check whether a VaccinationCenter is owned by the Arena
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Arena must be properly initialized")
+     */
+    bool owns(const VaccinationCenter *center) const;
+
+    /**
+     * \brief Get the amount of Hubs of the Arena
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Arena must be properly initialized")
+     */
+    int getHubs() const;
+
+    /**
+     * \brief Get the amount of VaccinationCenters of the Arena
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Arena must be properly initialized")
+     */
+    int getCentra() const;
+
+    /**
+     * \brief Destroy every Hub and VaccinationCenter of the Arena, the Hubs first because they supply the centra
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Arena must be properly initialized")
+     *
+     * @post
+     * ENSURE(getHubs() == 0 && getCentra() == 0, "Arena must be empty")
+     */
+    void clear();
+};
+
+#endif //VACCINDISTRIBUTOR_ARENA_H
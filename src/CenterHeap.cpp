@@ -0,0 +1,152 @@
+/**
+ * @file CenterHeap.cpp
+ * @brief This file contains the definitions of the members of the CenterHeap class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "CenterHeap.h"
+
+CenterHeap::CenterHeap() {
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(empty(), "CenterHeap must be empty");
+}
+
+bool CenterHeap::properlyInitialized() const {
+
+    return CenterHeap::_initCheck == this;
+}
+
+bool CenterHeap::before(const CenterHeap::Entry &a, const CenterHeap::Entry &b) {
+
+    if (a.ratio != b.ratio) {
+        return a.ratio < b.ratio;
+    }
+    return a.order > b.order;
+}
+
+void CenterHeap::swapEntries(int a, int b) {
+
+    Entry entry = fentries[a];
+    fentries[a] = fentries[b];
+    fentries[b] = entry;
+    fposition[fentries[a].order] = a;
+    fposition[fentries[b].order] = b;
+}
+
+void CenterHeap::siftUp(int position) {
+
+    while (position > 0) {
+        int parent = (position - 1) / 2;
+        if (!before(fentries[position], fentries[parent])) {
+            return;
+        }
+        swapEntries(position, parent);
+        position = parent;
+    }
+}
+
+void CenterHeap::siftDown(int position) {
+
+    int size = static_cast<int>(fentries.size());
+    while (true) {
+        int smallest = position;
+        int left = 2 * position + 1;
+        int right = left + 1;
+        if (left < size && before(fentries[left], fentries[smallest])) {
+            smallest = left;
+        }
+        if (right < size && before(fentries[right], fentries[smallest])) {
+            smallest = right;
+        }
+        if (smallest == position) {
+            return;
+        }
+        swapEntries(position, smallest);
+        position = smallest;
+    }
+}
+
+bool CenterHeap::empty() const {
+
+    REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized");
+    return fentries.empty();
+}
+
+bool CenterHeap::contains(int order) const {
+
+    REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized");
+    return order >= 0 && order < static_cast<int>(fposition.size()) && fposition[order] != -1;
+}
+
+void CenterHeap::push(int order, VaccinationCenter *center, double ratio) {
+
+    REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized");
+    REQUIRE(order >= 0, "Order can not be negative");
+    REQUIRE(!contains(order), "VaccinationCenter is already in the heap");
+    REQUIRE(ratio == ratio, "Ratio must be a number");
+
+    if (order >= static_cast<int>(fposition.size())) {
+        fposition.resize(order + 1, -1);
+    }
+    Entry entry;
+    entry.center = center;
+    entry.order = order;
+    entry.ratio = ratio;
+    fentries.push_back(entry);
+    fposition[order] = static_cast<int>(fentries.size()) - 1;
+    siftUp(fposition[order]);
+
+    ENSURE(contains(order), "VaccinationCenter is not added to the heap");
+}
+
+VaccinationCenter *CenterHeap::top() const {
+
+    REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized");
+    REQUIRE(!empty(), "CenterHeap can not be empty");
+    return fentries.front().center;
+}
+
+int CenterHeap::topOrder() const {
+
+    REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized");
+    REQUIRE(!empty(), "CenterHeap can not be empty");
+    return fentries.front().order;
+}
+
+void CenterHeap::update(int order, double ratio) {
+
+    REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized");
+    REQUIRE(contains(order), "VaccinationCenter must be in the heap");
+    REQUIRE(ratio == ratio, "Ratio must be a number");
+
+    int position = fposition[order];
+    fentries[position].ratio = ratio;
+    siftUp(position);
+    siftDown(fposition[order]);
+}
+
+void CenterHeap::remove(int order) {
+
+    REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized");
+    REQUIRE(contains(order), "VaccinationCenter must be in the heap");
+
+    int position = fposition[order];
+    int last = static_cast<int>(fentries.size()) - 1;
+    if (position != last) {
+        swapEntries(position, last);
+    }
+    fentries.pop_back();
+    fposition[order] = -1;
+
+    // Entry that was last is now on the position of the removed entry
+    if (position != last) {
+        int moved = fentries[position].order;
+        siftUp(position);
+        siftDown(fposition[moved]);
+    }
+
+    ENSURE(!contains(order), "VaccinationCenter is not removed from the heap");
+}
@@ -0,0 +1,167 @@
+/**
+ * @file CenterHeap.h
+ * @brief This header file contains the declarations and the members of the CenterHeap class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_CENTERHEAP_H
+#define VACCINDISTRIBUTOR_CENTERHEAP_H
+
+#include <vector>
+#include "DesignByContract.h"
+
+class VaccinationCenter;
+
+/**
+ * \brief Class implemented for an indexed min-heap of VaccinationCenters
+ *
+ * The top of the heap is the VaccinationCenter with the smallest ratio. When ratios are equal the VaccinationCenter
+ * with the biggest order is on top, the same VaccinationCenter Hub::mostSuitableVaccinationCenter selects when the
+ * order is the position of the VaccinationCenter in the map of the Hub. Every VaccinationCenter is identified by its
+ * order, so its ratio can be changed or it can be removed while it is in the heap.
+ */
+class CenterHeap {
+
+private:
+    /**
+     * \brief VaccinationCenter with its key in the heap
+     */
+    struct Entry {
+        VaccinationCenter *center; ///< Pointer to VaccinationCenter object
+        int order; ///< Order of the VaccinationCenter, used when ratios are equal
+        double ratio; ///< Ratio of the VaccinationCenter
+    };
+
+    std::vector<Entry> fentries; ///< Binary heap
+    std::vector<int> fposition; ///< Position in fentries of every order, -1 when not in the heap
+    CenterHeap *_initCheck;
+
+    /**
+     * \brief Check whether entry a must be above entry b
+     */
+    static bool before(const Entry &a, const Entry &b);
+
+    /**
+     * \brief Swap two entries of the heap and update their positions
+     */
+    void swapEntries(int a, int b);
+
+    /**
+     * \brief Move entry up until the heap is valid again
+     */
+    void siftUp(int position);
+
+    /**
+     * \brief Move entry down until the heap is valid again
+     */
+    void siftDown(int position);
+
+public:
+    /**
+     * \brief Default constructor for a CenterHeap object
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(empty(), "CenterHeap must be empty")
+     */
+    CenterHeap();
+
+    /**
+     * \brief Check whether the CenterHeap object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Check whether the heap is empty
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized")
+     *
+     * @return true when there are no VaccinationCenters in the heap
+     */
+    bool empty() const;
+
+    /**
+     * \brief Check whether a VaccinationCenter is in the heap
+     *
+     * @param order Order of the VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized")
+     *
+     * @return true when the VaccinationCenter is in the heap
+     */
+    bool contains(int order) const;
+
+    /**
+     * \brief Add a VaccinationCenter to the heap
+     *
+     * @param order Order of the VaccinationCenter
+     * @param center Pointer to VaccinationCenter object
+     * @param ratio Ratio of the VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized")
+     * REQUIRE(order >= 0, "Order can not be negative")
+     * REQUIRE(!contains(order), "VaccinationCenter is already in the heap")
+     * REQUIRE(ratio == ratio, "Ratio must be a number")
+     *
+     * @post
+     * ENSURE(contains(order), "VaccinationCenter is not added to the heap")
+     */
+    void push(int order, VaccinationCenter *center, double ratio);
+
+    /**
+     * \brief Get the VaccinationCenter on top of the heap
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized")
+     * REQUIRE(!empty(), "CenterHeap can not be empty")
+     *
+     * @return Pointer to VaccinationCenter object
+     */
+    VaccinationCenter *top() const;
+
+    /**
+     * \brief Get the order of the VaccinationCenter on top of the heap
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized")
+     * REQUIRE(!empty(), "CenterHeap can not be empty")
+     *
+     * @return Order as int
+     */
+    int topOrder() const;
+
+    /**
+     * \brief Change the ratio of a VaccinationCenter in the heap
+     *
+     * @param order Order of the VaccinationCenter
+     * @param ratio New ratio of the VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized")
+     * REQUIRE(contains(order), "VaccinationCenter must be in the heap")
+     * REQUIRE(ratio == ratio, "Ratio must be a number")
+     */
+    void update(int order, double ratio);
+
+    /**
+     * \brief Remove a VaccinationCenter from the heap
+     *
+     * @param order Order of the VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterHeap must be properly initialized")
+     * REQUIRE(contains(order), "VaccinationCenter must be in the heap")
+     *
+     * @post
+     * ENSURE(!contains(order), "VaccinationCenter is not removed from the heap")
+     */
+    void remove(int order);
+};
+
+#endif //VACCINDISTRIBUTOR_CENTERHEAP_H
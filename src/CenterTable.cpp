@@ -0,0 +1,303 @@
+/**
+ * @file CenterTable.cpp
+ * @brief This file contains the definitions of the members of the CenterTable class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "CenterTable.h"
+
+/**
+ * \brief Sum of the values from begin to end
+ */
+static int sumValues(const std::vector<int> &values, std::size_t begin, std::size_t end) {
+
+    int total = 0;
+    for (std::size_t i = begin; i < end; i++) {
+        total += values[i];
+    }
+    return total;
+}
+
+CenterTable::CenterTable() {
+
+    ftotalPopulation = 0;
+    ftotalVaccinated = 0;
+    pthread_mutex_init(&fmutex, NULL);
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(getCenters() == 0, "CenterTable must be empty");
+    ENSURE(getTypes() == 0, "CenterTable must be empty");
+}
+
+CenterTable::~CenterTable() {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    pthread_mutex_destroy(&fmutex);
+}
+
+bool CenterTable::properlyInitialized() const {
+
+    return CenterTable::_initCheck == this;
+}
+
+void CenterTable::clear() {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+
+    fcenterNames.clear();
+    fcenterIndex.clear();
+    ftypeNames.clear();
+    ftypeIndex.clear();
+    fpopulation.clear();
+    fcapacity.clear();
+    fvaccinated.clear();
+    fstock.clear();
+    fbacklog.clear();
+    fcenterStock.clear();
+    fcenterBacklog.clear();
+    ftotalPopulation = 0;
+    ftotalVaccinated = 0;
+
+    ENSURE(getCenters() == 0, "CenterTable must be empty");
+    ENSURE(getTypes() == 0, "CenterTable must be empty");
+}
+
+int CenterTable::addCenter(const std::string &name) {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+
+    int index = findCenter(name);
+    if (index != -1) {
+        return index;
+    }
+    index = getCenters();
+    fcenterNames.push_back(name);
+    fcenterIndex[name] = index;
+    fpopulation.push_back(0);
+    fcapacity.push_back(0);
+    fvaccinated.push_back(0);
+    fcenterStock.push_back(0);
+    fcenterBacklog.push_back(0);
+    fstock.resize(fstock.size() + getTypes(), 0);
+    fbacklog.resize(fbacklog.size() + getTypes(), 0);
+
+    ENSURE(findCenter(name) == index, "VaccinationCenter is not added");
+    return index;
+}
+
+int CenterTable::addType(const std::string &type) {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+
+    int index = findType(type);
+    if (index != -1) {
+        return index;
+    }
+    index = getTypes();
+
+    // Every row gets one column more, the values are moved to their new index
+    int types = index + 1;
+    std::vector<int> stock(getCenters() * types, 0);
+    std::vector<int> backlog(getCenters() * types, 0);
+    for (int center = 0; center < getCenters(); center++) {
+        for (int column = 0; column < index; column++) {
+            stock[center * types + column] = fstock[center * index + column];
+            backlog[center * types + column] = fbacklog[center * index + column];
+        }
+    }
+    fstock.swap(stock);
+    fbacklog.swap(backlog);
+    ftypeNames.push_back(type);
+    ftypeIndex[type] = index;
+
+    ENSURE(findType(type) == index, "Vaccin type is not added");
+    return index;
+}
+
+int CenterTable::findCenter(const std::string &name) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    std::map<std::string, int>::const_iterator it = fcenterIndex.find(name);
+    return it == fcenterIndex.end() ? -1 : it->second;
+}
+
+int CenterTable::findType(const std::string &type) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    std::map<std::string, int>::const_iterator it = ftypeIndex.find(type);
+    return it == ftypeIndex.end() ? -1 : it->second;
+}
+
+int CenterTable::getCenters() const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    return static_cast<int>(fcenterNames.size());
+}
+
+int CenterTable::getTypes() const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    return static_cast<int>(ftypeNames.size());
+}
+
+const std::string &CenterTable::getCenterName(int center) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+    return fcenterNames[center];
+}
+
+const std::string &CenterTable::getTypeName(int type) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(type >= 0 && type < getTypes(), "Vaccin type must be in the table");
+    return ftypeNames[type];
+}
+
+void CenterTable::setPopulation(int center, int population) {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+
+    pthread_mutex_lock(&fmutex);
+    ftotalPopulation += population - fpopulation[center];
+    pthread_mutex_unlock(&fmutex);
+    fpopulation[center] = population;
+
+    ENSURE(getPopulation(center) == population, "Population is not set");
+}
+
+void CenterTable::setCapacity(int center, int capacity) {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+
+    fcapacity[center] = capacity;
+
+    ENSURE(getCapacity(center) == capacity, "Capacity is not set");
+}
+
+void CenterTable::setVaccinated(int center, int vaccinated) {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+
+    pthread_mutex_lock(&fmutex);
+    ftotalVaccinated += vaccinated - fvaccinated[center];
+    pthread_mutex_unlock(&fmutex);
+    fvaccinated[center] = vaccinated;
+
+    ENSURE(getVaccinated(center) == vaccinated, "Vaccinated is not set");
+}
+
+void CenterTable::setStock(int center, int type, int stock) {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+    REQUIRE(type >= 0 && type < getTypes(), "Vaccin type must be in the table");
+
+    int &value = fstock[center * getTypes() + type];
+    fcenterStock[center] += stock - value;
+    value = stock;
+
+    ENSURE(getStock(center, type) == stock, "Stock is not set");
+}
+
+void CenterTable::setBacklog(int center, int type, int backlog) {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+    REQUIRE(type >= 0 && type < getTypes(), "Vaccin type must be in the table");
+
+    int &value = fbacklog[center * getTypes() + type];
+    fcenterBacklog[center] += backlog - value;
+    value = backlog;
+
+    ENSURE(getBacklog(center, type) == backlog, "Backlog is not set");
+}
+
+int CenterTable::getPopulation(int center) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+    return fpopulation[center];
+}
+
+int CenterTable::getCapacity(int center) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+    return fcapacity[center];
+}
+
+int CenterTable::getVaccinated(int center) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+    return fvaccinated[center];
+}
+
+int CenterTable::getStock(int center, int type) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+    REQUIRE(type >= 0 && type < getTypes(), "Vaccin type must be in the table");
+    return fstock[center * getTypes() + type];
+}
+
+int CenterTable::getBacklog(int center, int type) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+    REQUIRE(type >= 0 && type < getTypes(), "Vaccin type must be in the table");
+    return fbacklog[center * getTypes() + type];
+}
+
+int CenterTable::getCenterStock(int center) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+    ENSURE_FULL(checkCenter(center), "Totals of the VaccinationCenter are not up to date");
+    return fcenterStock[center];
+}
+
+int CenterTable::getCenterBacklog(int center) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+    ENSURE_FULL(checkCenter(center), "Totals of the VaccinationCenter are not up to date");
+    return fcenterBacklog[center];
+}
+
+int CenterTable::getTotalPopulation() const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    ENSURE_FULL(checkTotals(), "Totals of the CenterTable are not up to date");
+    return ftotalPopulation;
+}
+
+int CenterTable::getTotalVaccinated() const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    ENSURE_FULL(checkTotals(), "Totals of the CenterTable are not up to date");
+    return ftotalVaccinated;
+}
+
+bool CenterTable::checkCenter(int center) const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table");
+
+    std::size_t begin = static_cast<std::size_t>(center) * ftypeNames.size();
+    std::size_t end = begin + ftypeNames.size();
+    return fcenterStock[center] == sumValues(fstock, begin, end) &&
+           fcenterBacklog[center] == sumValues(fbacklog, begin, end);
+}
+
+bool CenterTable::checkTotals() const {
+
+    REQUIRE(properlyInitialized(), "CenterTable must be properly initialized");
+    return ftotalPopulation == sumValues(fpopulation, 0, fpopulation.size()) &&
+           ftotalVaccinated == sumValues(fvaccinated, 0, fvaccinated.size());
+}
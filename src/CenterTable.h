@@ -0,0 +1,370 @@
+/**
+ * @file CenterTable.h
+ * @brief This header file contains the declarations and the members of the CenterTable class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_CENTERTABLE_H
+#define VACCINDISTRIBUTOR_CENTERTABLE_H
+
+#include <string>
+#include <map>
+#include <vector>
+#include <pthread.h>
+#include "DesignByContract.h"
+
+/**
+ * \brief Class implemented for the state of VaccinationCenters stored as dense arrays
+ *
+ * Every VaccinationCenter is a row and every Vaccin type is a column, both identified by an index. The names are
+ * interned once, adding a name that is already in the table gives the index it already has. Stock and people waiting
+ * for their second shot are stored row after row, so the Vaccins of one VaccinationCenter are next to each other.
+ * VaccinationCenter and VaccinInCenter read and write their values in the table.
+ *
+ * The total stock and backlog of every VaccinationCenter and the totals of all VaccinationCenters are kept up to date
+ * on every change, so they are read without walking the rows. The totals of all VaccinationCenters can be changed by
+ * the threads that vaccinate different VaccinationCenters at the same time.
+ */
+class CenterTable {
+
+private:
+    std::vector<std::string> fcenterNames; ///< Name of every VaccinationCenter
+    std::map<std::string, int> fcenterIndex; ///< Index of every VaccinationCenter name
+    std::vector<std::string> ftypeNames; ///< Name of every Vaccin type
+    std::map<std::string, int> ftypeIndex; ///< Index of every Vaccin type
+    std::vector<int> fpopulation; ///< Population of every VaccinationCenter
+    std::vector<int> fcapacity; ///< Capacity of every VaccinationCenter
+    std::vector<int> fvaccinated; ///< Amount of people vaccinated in every VaccinationCenter
+    std::vector<int> fstock; ///< Vaccins in stock, index center * getTypes() + type
+    std::vector<int> fbacklog; ///< People waiting for their second shot, index center * getTypes() + type
+    std::vector<int> fcenterStock; ///< Stock of all Vaccin types of every VaccinationCenter
+    std::vector<int> fcenterBacklog; ///< Backlog of all Vaccin types of every VaccinationCenter
+    int ftotalPopulation; ///< Population of all VaccinationCenters
+    int ftotalVaccinated; ///< Amount of people vaccinated in all VaccinationCenters
+    pthread_mutex_t fmutex; ///< Protects the totals of all VaccinationCenters
+    CenterTable *_initCheck;
+
+public:
+    /**
+     * \brief Default constructor for a CenterTable object
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(getCenters() == 0, "CenterTable must be empty")
+     * ENSURE(getTypes() == 0, "CenterTable must be empty")
+     */
+    CenterTable();
+
+    /**
+     * \brief Destructor for a CenterTable object
+     */
+    ~CenterTable();
+
+    /**
+     * \brief Check whether the CenterTable object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Remove every VaccinationCenter and Vaccin type
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     *
+     * @post
+     * ENSURE(getCenters() == 0, "CenterTable must be empty")
+     * ENSURE(getTypes() == 0, "CenterTable must be empty")
+     */
+    void clear();
+
+    /**
+     * \brief Add a VaccinationCenter, all its values are 0
+     *
+     * @param name Name of the VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     *
+     * @post
+     * ENSURE(findCenter(name) == index, "VaccinationCenter is not added")
+     *
+     * @return Index of the VaccinationCenter, the index it already has when the name is in the table
+     */
+    int addCenter(const std::string &name);
+
+    /**
+     * \brief Add a Vaccin type, its stock and backlog are 0 in every VaccinationCenter
+     *
+     * @param type Name of the Vaccin type
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     *
+     * @post
+     * ENSURE(findType(type) == index, "Vaccin type is not added")
+     *
+     * @return Index of the Vaccin type, the index it already has when the type is in the table
+     */
+    int addType(const std::string &type);
+
+    /**
+     * \brief Get index of a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     *
+     * @return Index as int, -1 when the name is not in the table
+     */
+    int findCenter(const std::string &name) const;
+
+    /**
+     * \brief Get index of a Vaccin type
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     *
+     * @return Index as int, -1 when the type is not in the table
+     */
+    int findType(const std::string &type) const;
+
+    /**
+     * \brief Get amount of VaccinationCenters
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     *
+     * @return Amount as int
+     */
+    int getCenters() const;
+
+    /**
+     * \brief Get amount of Vaccin types
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     *
+     * @return Amount as int
+     */
+    int getTypes() const;
+
+    /**
+     * \brief Get name of a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     *
+     * @return Name as string
+     */
+    const std::string &getCenterName(int center) const;
+
+    /**
+     * \brief Get name of a Vaccin type
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(type >= 0 && type < getTypes(), "Vaccin type must be in the table")
+     *
+     * @return Name as string
+     */
+    const std::string &getTypeName(int type) const;
+
+    /**
+     * \brief Set population of a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     *
+     * @post
+     * ENSURE(getPopulation(center) == population, "Population is not set")
+     */
+    void setPopulation(int center, int population);
+
+    /**
+     * \brief Set capacity of a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     *
+     * @post
+     * ENSURE(getCapacity(center) == capacity, "Capacity is not set")
+     */
+    void setCapacity(int center, int capacity);
+
+    /**
+     * \brief Set amount of people vaccinated in a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     *
+     * @post
+     * ENSURE(getVaccinated(center) == vaccinated, "Vaccinated is not set")
+     */
+    void setVaccinated(int center, int vaccinated);
+
+    /**
+     * \brief Set stock of a Vaccin type in a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     * REQUIRE(type >= 0 && type < getTypes(), "Vaccin type must be in the table")
+     *
+     * @post
+     * ENSURE(getStock(center, type) == stock, "Stock is not set")
+     */
+    void setStock(int center, int type, int stock);
+
+    /**
+     * \brief Set amount of people waiting for their second shot of a Vaccin type in a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     * REQUIRE(type >= 0 && type < getTypes(), "Vaccin type must be in the table")
+     *
+     * @post
+     * ENSURE(getBacklog(center, type) == backlog, "Backlog is not set")
+     */
+    void setBacklog(int center, int type, int backlog);
+
+    /**
+     * \brief Get population of a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     *
+     * @return Population as int
+     */
+    int getPopulation(int center) const;
+
+    /**
+     * \brief Get capacity of a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     *
+     * @return Capacity as int
+     */
+    int getCapacity(int center) const;
+
+    /**
+     * \brief Get amount of people vaccinated in a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     *
+     * @return Amount of people vaccinated as int
+     */
+    int getVaccinated(int center) const;
+
+    /**
+     * \brief Get stock of a Vaccin type in a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     * REQUIRE(type >= 0 && type < getTypes(), "Vaccin type must be in the table")
+     *
+     * @return Stock as int
+     */
+    int getStock(int center, int type) const;
+
+    /**
+     * \brief Get amount of people waiting for their second shot of a Vaccin type in a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     * REQUIRE(type >= 0 && type < getTypes(), "Vaccin type must be in the table")
+     *
+     * @return Backlog as int
+     */
+    int getBacklog(int center, int type) const;
+
+    /**
+     * \brief Get stock of all Vaccin types in a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     *
+     * @post
+     * ENSURE_FULL(checkCenter(center), "Totals of the VaccinationCenter are not up to date")
+     *
+     * @return Total stock as int
+     */
+    int getCenterStock(int center) const;
+
+    /**
+     * \brief Get amount of people waiting for their second shot of all Vaccin types in a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     *
+     * @post
+     * ENSURE_FULL(checkCenter(center), "Totals of the VaccinationCenter are not up to date")
+     *
+     * @return Total backlog as int
+     */
+    int getCenterBacklog(int center) const;
+
+    /**
+     * \brief Get population of all VaccinationCenters
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     *
+     * @post
+     * ENSURE_FULL(checkTotals(), "Totals of the CenterTable are not up to date")
+     *
+     * @return Total population as int
+     */
+    int getTotalPopulation() const;
+
+    /**
+     * \brief Get amount of people vaccinated in all VaccinationCenters
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     *
+     * @post
+     * ENSURE_FULL(checkTotals(), "Totals of the CenterTable are not up to date")
+     *
+     * @return Total amount of people vaccinated as int
+     */
+    int getTotalVaccinated() const;
+
+    /**
+     * \brief Check the total stock and backlog of a VaccinationCenter against its row
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCenters(), "VaccinationCenter must be in the table")
+     *
+     * @return true when the totals are the sums of the row
+     */
+    bool checkCenter(int center) const;
+
+    /**
+     * \brief Check the totals of all VaccinationCenters against the values of every VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "CenterTable must be properly initialized")
+     *
+     * @return true when the totals are the sums of all VaccinationCenters
+     */
+    bool checkTotals() const;
+};
+
+#endif //VACCINDISTRIBUTOR_CENTERTABLE_H
@@ -0,0 +1,243 @@
+/**
+ * @file DayArchive.cpp
+ * @brief This file contains the definitions of the members of the DayArchive class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "DayArchive.h"
+#include <cstring>
+#include <unistd.h>
+
+const char DayArchive::kMagic[8] = {'V', 'D', 'D', 'A', 'Y', 'S', '\0', '\0'};
+const int32_t DayArchive::kVersion;
+const int32_t DayArchive::kByteOrder;
+const int32_t DayArchive::kRecordTag;
+const int32_t DayArchive::kFooterTag;
+
+DayArchive::DayArchive() : fend(0), fchanged(false) {
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(!isOpen(), "Archive can't be open");
+}
+
+DayArchive::~DayArchive() {
+
+    try {
+        close();
+    }
+    catch (Exception ex) {
+        // The records are kept, the index is rebuilt from them when the archive is opened again
+    }
+}
+
+bool DayArchive::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+void DayArchive::open(const std::string &path, bool clear) {
+
+    REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized");
+    REQUIRE(!isOpen(), "Archive is already open");
+
+    // An fstream only opens files that exist for reading and writing
+    std::ifstream existing(path.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    int64_t size = existing.is_open() ? static_cast<int64_t>(existing.tellg()) : 0;
+    existing.close();
+    if (clear || size == 0) {
+        Header header;
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kVersion;
+        header.byteOrder = kByteOrder;
+        std::ofstream created(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        created.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        created.close();
+        if (created.fail()) {
+            throw Exception("Archive " + path + " can't be written");
+        }
+        size = sizeof(header);
+    }
+
+    ffile.open(path.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+    if (!ffile.is_open()) {
+        throw Exception("Archive " + path + " can't be opened");
+    }
+    Header header;
+    ffile.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!ffile || std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion ||
+        header.byteOrder != kByteOrder) {
+        ffile.close();
+        throw Exception("Invalid archive: " + path);
+    }
+    fpath = path;
+    fentries.clear();
+    fchanged = false;
+    readIndex(size);
+
+    ENSURE(isOpen(), "Archive must be open");
+}
+
+void DayArchive::readIndex(int64_t size) {
+
+    // The index of a closed archive is valid when it ends where the footer starts, the footer is checked before the
+    // index is read so a damaged footer can't make it read outside the file
+    Footer footer;
+    const int64_t footerSize = static_cast<int64_t>(sizeof(Footer));
+    const int64_t entrySize = static_cast<int64_t>(sizeof(IndexEntry));
+    if (size >= static_cast<int64_t>(sizeof(Header)) + footerSize) {
+        ffile.seekg(size - footerSize);
+        ffile.read(reinterpret_cast<char *>(&footer), sizeof(footer));
+        if (ffile && footer.tag == kFooterTag && footer.entries >= 0 &&
+            footer.index >= static_cast<int64_t>(sizeof(Header)) && footer.index <= size - footerSize &&
+            footer.entries <= (size - footerSize - footer.index) / entrySize &&
+            footer.index + footer.entries * entrySize + footerSize == size) {
+            std::vector<IndexEntry> index(footer.entries);
+            ffile.seekg(footer.index);
+            if (!index.empty()) {
+                ffile.read(reinterpret_cast<char *>(&index[0]), index.size() * sizeof(IndexEntry));
+            }
+            if (ffile) {
+                for (std::vector<IndexEntry>::const_iterator it = index.begin(); it != index.end(); it++) {
+                    Entry entry = {it->offset, it->size};
+                    fentries[std::make_pair(it->day, it->kind)] = entry;
+                }
+                // New records overwrite the index, it is written again when the archive is closed
+                fend = footer.index;
+                return;
+            }
+            fentries.clear();
+        }
+        ffile.clear();
+    }
+
+    // The archive was not closed, every record that is complete is used
+    fend = sizeof(Header);
+    RecordHeader record;
+    while (fend + static_cast<int64_t>(sizeof(RecordHeader)) <= size) {
+        ffile.seekg(fend);
+        ffile.read(reinterpret_cast<char *>(&record), sizeof(record));
+        if (!ffile || record.tag != kRecordTag || record.day < 0 || record.size < 0 ||
+            fend + static_cast<int64_t>(sizeof(RecordHeader)) + record.size > size) {
+            break;
+        }
+        Entry entry = {fend + static_cast<int64_t>(sizeof(RecordHeader)), record.size};
+        fentries[std::make_pair(record.day, record.kind)] = entry;
+        fend = entry.offset + record.size;
+    }
+    ffile.clear();
+
+    // The index has to be written, also when no records are appended
+    fchanged = true;
+}
+
+void DayArchive::close() {
+
+    REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized");
+
+    if (!isOpen()) {
+        return;
+    }
+    bool written = true;
+    if (fchanged) {
+        std::vector<IndexEntry> index;
+        index.reserve(fentries.size());
+        for (std::map<std::pair<int, int>, Entry>::const_iterator it = fentries.begin(); it != fentries.end(); it++) {
+            IndexEntry entry = {it->second.offset, it->first.first, it->first.second, it->second.size, 0};
+            index.push_back(entry);
+        }
+        Footer footer = {fend, static_cast<int32_t>(index.size()), kFooterTag};
+        ffile.clear();
+        ffile.seekp(fend);
+        if (!index.empty()) {
+            ffile.write(reinterpret_cast<const char *>(&index[0]), index.size() * sizeof(IndexEntry));
+        }
+        ffile.write(reinterpret_cast<const char *>(&footer), sizeof(footer));
+        ffile.flush();
+        written = !ffile.fail();
+    }
+    ffile.close();
+
+    // An index that is shorter than the one it overwrote leaves bytes behind the footer
+    int64_t size = fend + static_cast<int64_t>(fentries.size()) * sizeof(IndexEntry) + sizeof(Footer);
+    if (written && fchanged && truncate(fpath.c_str(), size) != 0) {
+        written = false;
+    }
+    fentries.clear();
+    fchanged = false;
+    if (!written) {
+        throw Exception("Index of archive " + fpath + " can't be written");
+    }
+    ENSURE(!isOpen(), "Archive can't be open");
+}
+
+bool DayArchive::isOpen() const {
+
+    REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized");
+    return ffile.is_open();
+}
+
+void DayArchive::append(int day, Kind kind, const std::string &data) {
+
+    REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized");
+    REQUIRE(isOpen(), "Archive must be open");
+    REQUIRE(day >= 0, "Day can't be negative");
+
+    RecordHeader record = {kRecordTag, day, kind, static_cast<int32_t>(data.size())};
+    ffile.clear();
+    ffile.seekp(fend);
+    ffile.write(reinterpret_cast<const char *>(&record), sizeof(record));
+    ffile.write(data.data(), data.size());
+    if (!ffile) {
+        throw Exception("Day " + ToString(day) + " can't be written to archive " + fpath);
+    }
+    Entry entry = {fend + static_cast<int64_t>(sizeof(RecordHeader)), record.size};
+    fentries[std::make_pair(day, static_cast<int>(kind))] = entry;
+    fend = entry.offset + record.size;
+    fchanged = true;
+
+    ENSURE(contains(day, kind), "Day must be archived");
+}
+
+bool DayArchive::contains(int day, Kind kind) const {
+
+    REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized");
+    REQUIRE(isOpen(), "Archive must be open");
+    return fentries.find(std::make_pair(day, static_cast<int>(kind))) != fentries.end();
+}
+
+std::string DayArchive::read(int day, Kind kind) const {
+
+    REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized");
+    REQUIRE(isOpen(), "Archive must be open");
+    REQUIRE(contains(day, kind), "Day must be archived");
+
+    const Entry &entry = fentries.find(std::make_pair(day, static_cast<int>(kind)))->second;
+    std::string data(entry.size, '\0');
+    ffile.clear();
+    ffile.flush();
+    ffile.seekg(entry.offset);
+    if (!data.empty()) {
+        ffile.read(&data[0], data.size());
+    }
+    if (!ffile) {
+        ffile.clear();
+        throw Exception("Day " + ToString(day) + " can't be read from archive " + fpath);
+    }
+    return data;
+}
+
+std::vector<int> DayArchive::getDays(Kind kind) const {
+
+    REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized");
+    REQUIRE(isOpen(), "Archive must be open");
+
+    std::vector<int> days;
+    for (std::map<std::pair<int, int>, Entry>::const_iterator it = fentries.begin(); it != fentries.end(); it++) {
+        if (it->first.second == kind) {
+            days.push_back(it->first.first);
+        }
+    }
+    return days;
+}
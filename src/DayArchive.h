@@ -0,0 +1,220 @@
+/**
+ * @file DayArchive.h
+ * @brief This header file contains the declarations and the members of the DayArchive class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_DAYARCHIVE_H
+#define VACCINDISTRIBUTOR_DAYARCHIVE_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <stdint.h>
+#include "DesignByContract.h"
+#include "Exception.h"
+#include "Utils.h"
+
+/**
+ * \brief Class implemented to keep the files of every simulated day in one archive, instead of a Day-<n>.txt,
+ *        Day-<n>.ini and Day-<n>.bmp file for every day
+ *
+ * The archive is a Header followed by records that are only appended, every record holds the bytes of one file of a
+ * day. An index with the offset of every record is written behind the records when the archive is closed, so a day
+ * is read with one seek. When a day is archived again, e.g. after an undo, the newest record is used. An archive that
+ * was not closed is opened by reading the headers of the records.
+ * Numbers are written in the byte order of the machine, an archive from a machine with another byte order is refused.
+ */
+class DayArchive {
+
+public:
+    /**
+     * \brief Kind of file of a day
+     */
+    enum Kind {
+        kText = 0, ///< Data of the Hubs and VaccinationCenters, like Simulation::exportFile
+        kIni = 1, ///< .ini file for the engine, like Simulation::generateIni
+        kBmp = 2 ///< Drawing of the day, like Simulation::generateBmp
+    };
+
+private:
+    /**
+     * \brief Start of an archive
+     */
+    struct Header {
+        char magic[8]; ///< kMagic
+        int32_t version; ///< kVersion
+        int32_t byteOrder; ///< kByteOrder as written by the machine
+    };
+
+    /**
+     * \brief Start of a record, the bytes of the file follow it
+     */
+    struct RecordHeader {
+        int32_t tag; ///< kRecordTag
+        int32_t day;
+        int32_t kind;
+        int32_t size; ///< Amount of bytes of the file
+    };
+
+    /**
+     * \brief Record in the index
+     */
+    struct IndexEntry {
+        int64_t offset; ///< Offset of the bytes of the file
+        int32_t day;
+        int32_t kind;
+        int32_t size;
+        int32_t padding;
+    };
+
+    /**
+     * \brief End of an archive that was closed, the index is in front of it
+     */
+    struct Footer {
+        int64_t index; ///< Offset of the index
+        int32_t entries; ///< Amount of IndexEntries
+        int32_t tag; ///< kFooterTag
+    };
+
+    /**
+     * \brief Place of the bytes of a file in the archive
+     */
+    struct Entry {
+        int64_t offset;
+        int32_t size;
+    };
+
+    static const char kMagic[8]; ///< First bytes of every archive
+    static const int32_t kVersion = 1; ///< Version of the format, increased with every change of the records
+    static const int32_t kByteOrder = 0x01020304; ///< Written as a number to detect the byte order
+    static const int32_t kRecordTag = 0x43455244; ///< "DREC" in the byte order of the machine
+    static const int32_t kFooterTag = 0x58444e49; ///< "INDX" in the byte order of the machine
+
+    std::string fpath;
+    mutable std::fstream ffile; ///< Reading moves the position of the file
+    std::map<std::pair<int, int>, Entry> fentries; ///< Newest record of every day and kind
+    int64_t fend; ///< Offset after the last record, where the next record is appended
+    bool fchanged; ///< Records are appended since the index was written
+    DayArchive *_initCheck;
+
+    DayArchive(const DayArchive &);
+    DayArchive &operator=(const DayArchive &);
+
+    /**
+     * \brief Read the index of a closed archive, or the headers of the records when the archive was not closed
+     *
+     * @param size Size of the archive in bytes
+     */
+    void readIndex(int64_t size);
+
+public:
+    /**
+     * \brief Default constructor for a DayArchive object, the archive is not open
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(!isOpen(), "Archive can't be open")
+     */
+    DayArchive();
+
+    /**
+     * \brief Destructor for a DayArchive object, an open archive is closed
+     */
+    ~DayArchive();
+
+    /**
+     * \brief Check whether the DayArchive object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Open an archive, an existing archive is continued and throws an Exception when it is not a valid archive
+     *
+     * @param path Path of the archive, created when it doesn't exist, throws an Exception when it can't be opened
+     * @param clear Remove the days of an existing archive
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized")
+     * REQUIRE(!isOpen(), "Archive is already open")
+     *
+     * @post
+     * ENSURE(isOpen(), "Archive must be open")
+     */
+    void open(const std::string &path, bool clear = false);
+
+    /**
+     * \brief Write the index and close the archive, nothing happens when the archive is not open
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized")
+     *
+     * @post
+     * ENSURE(!isOpen(), "Archive can't be open")
+     */
+    void close();
+
+    /**
+     * \brief Check whether the archive is open
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized")
+     */
+    bool isOpen() const;
+
+    /**
+     * \brief Append the file of a day, throws an Exception when it can't be written
+     *
+     * @param day Day of the file
+     * @param kind Kind of the file
+     * @param data Bytes of the file
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized")
+     * REQUIRE(isOpen(), "Archive must be open")
+     * REQUIRE(day >= 0, "Day can't be negative")
+     *
+     * @post
+     * ENSURE(contains(day, kind), "Day must be archived")
+     */
+    void append(int day, Kind kind, const std::string &data);
+
+    /**
+     * \brief Check whether a file of a day is archived
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized")
+     * REQUIRE(isOpen(), "Archive must be open")
+     */
+    bool contains(int day, Kind kind) const;
+
+    /**
+     * \brief Read the file of a day, throws an Exception when it can't be read
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized")
+     * REQUIRE(isOpen(), "Archive must be open")
+     * REQUIRE(contains(day, kind), "Day must be archived")
+     *
+     * @return Bytes of the file
+     */
+    std::string read(int day, Kind kind) const;
+
+    /**
+     * \brief Get the days with a file of a kind, the files of days that were simulated in order follow each other in
+     *        the archive, so reading them in this order reads the archive from front to back
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DayArchive object must be properly initialized")
+     * REQUIRE(isOpen(), "Archive must be open")
+     *
+     * @return The days, from small to large
+     */
+    std::vector<int> getDays(Kind kind) const;
+};
+
+#endif //VACCINDISTRIBUTOR_DAYARCHIVE_H
@@ -0,0 +1,99 @@
+/**
+ * @file DeliverySchedule.cpp
+ * @brief This file contains the definitions of the members of the DeliverySchedule class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "DeliverySchedule.h"
+#include <algorithm>
+#include "Hub.h"
+#include "Vaccin.h"
+
+DeliverySchedule::DeliverySchedule() : fday(-1) {
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(!isValid(0), "Schedule can't be valid");
+}
+
+bool DeliverySchedule::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+bool DeliverySchedule::after(const Entry &a, const Entry &b) {
+
+    if (a.day != b.day) {
+        return a.day > b.day;
+    }
+    if (a.hub != b.hub) {
+        return a.hub > b.hub;
+    }
+    return a.order > b.order;
+}
+
+void DeliverySchedule::build(const std::vector<Hub*> &hubs, int day) {
+
+    REQUIRE(properlyInitialized(), "DeliverySchedule object must be properly initialized");
+    REQUIRE(day >= 0, "Day can't be negative");
+
+    fentries.clear();
+    // Day 0 has no deliveries, the Hubs start with one
+    int first = day > 0 ? day : 1;
+    for (unsigned int hub = 0; hub < hubs.size(); hub++) {
+        const std::map<std::string, VaccinInHub*> &vaccins = hubs[hub]->getVaccins();
+        int order = 0;
+        for (std::map<std::string, VaccinInHub*>::const_iterator it = vaccins.begin(); it != vaccins.end(); it++) {
+            int interval = it->second->getInterval();
+            Entry entry = {(first + interval - 1) / interval * interval, static_cast<int>(hub), order, it->second};
+            fentries.push_back(entry);
+            order++;
+        }
+    }
+    std::make_heap(fentries.begin(), fentries.end(), after);
+    fday = day;
+
+    ENSURE(isValid(day), "Schedule must be valid");
+}
+
+bool DeliverySchedule::isValid(int day) const {
+
+    REQUIRE(properlyInitialized(), "DeliverySchedule object must be properly initialized");
+    return fday >= 0 && fday == day;
+}
+
+void DeliverySchedule::invalidate() {
+
+    REQUIRE(properlyInitialized(), "DeliverySchedule object must be properly initialized");
+    fday = -1;
+    ENSURE(!isValid(fday), "Schedule can't be valid");
+}
+
+void DeliverySchedule::takeDeliveries(int day, std::vector<VaccinInHub*> &due) {
+
+    REQUIRE(properlyInitialized(), "DeliverySchedule object must be properly initialized");
+    REQUIRE(isValid(day), "Schedule must be valid");
+
+    due.clear();
+    // Every Vaccin is at most once on the day, so the next delivery is pushed after the Vaccins of the day are taken
+    std::vector<Entry>::size_type end = fentries.size();
+    while (end > 0 && fentries.front().day == day) {
+        std::pop_heap(fentries.begin(), fentries.begin() + end, after);
+        end--;
+        due.push_back(fentries[end].vaccin);
+    }
+    for (std::vector<Entry>::size_type i = end; i < fentries.size(); i++) {
+        fentries[i].day += fentries[i].vaccin->getInterval();
+        std::push_heap(fentries.begin(), fentries.begin() + i + 1, after);
+    }
+    fday = day + 1;
+
+    ENSURE(isValid(day + 1), "Schedule must be valid for the next day");
+}
+
+int DeliverySchedule::getNextDay() const {
+
+    REQUIRE(properlyInitialized(), "DeliverySchedule object must be properly initialized");
+    return fentries.empty() ? -1 : fentries.front().day;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file DeliverySchedule.h
+ * @brief This header file contains the declarations and the members of the DeliverySchedule class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_DELIVERYSCHEDULE_H
+#define VACCINDISTRIBUTOR_DELIVERYSCHEDULE_H
+
+#include <vector>
+#include "DesignByContract.h"
+
+class Hub;
+class VaccinInHub;
+
+/**
+ * \brief Class implemented to find the deliveries of a day without testing the interval of every Vaccin of every Hub
+ *
+ * The schedule is a min-heap with the day of the next delivery of every Vaccin. A Vaccin is delivered on every
+ * multiple of its interval except day 0. Deliveries of the same day are given in the order of the Hubs and the types
+ * of their Vaccins. The schedule is built for one day and follows the Simulation day by day, it has to be built again
+ * when the Simulation goes to another day, e.g. after an undo, or when an interval changes.
+ */
+class DeliverySchedule {
+
+private:
+    /**
+     * \brief Next delivery of a Vaccin
+     */
+    struct Entry {
+        int day; ///< Day of the delivery
+        int hub; ///< Index of the Hub, used when days are equal
+        int order; ///< Position of the Vaccin in the map of the Hub, used when days and Hubs are equal
+        VaccinInHub *vaccin;
+    };
+
+    std::vector<Entry> fentries; ///< Binary heap, the earliest delivery on top
+    int fday; ///< Day the schedule is valid for, -1 when it has to be built
+    DeliverySchedule *_initCheck;
+
+    /**
+     * \brief Check whether entry a is delivered after entry b, the comparison of the heap
+     */
+    static bool after(const Entry &a, const Entry &b);
+
+public:
+    /**
+     * \brief Default constructor for a DeliverySchedule object, the schedule has to be built
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(!isValid(0), "Schedule can't be valid")
+     */
+    DeliverySchedule();
+
+    /**
+     * \brief Check whether the DeliverySchedule object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Build the schedule with the next delivery of every Vaccin of the Hubs from a day on
+     *
+     * @param hubs Hubs of the Simulation, every interval must be positive
+     * @param day First day that is simulated
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DeliverySchedule object must be properly initialized")
+     * REQUIRE(day >= 0, "Day can't be negative")
+     *
+     * @post
+     * ENSURE(isValid(day), "Schedule must be valid")
+     */
+    void build(const std::vector<Hub*> &hubs, int day);
+
+    /**
+     * \brief Check whether the schedule can give the deliveries of a day
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DeliverySchedule object must be properly initialized")
+     */
+    bool isValid(int day) const;
+
+    /**
+     * \brief Build the schedule again before the next day, called when an interval changes
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DeliverySchedule object must be properly initialized")
+     *
+     * @post
+     * ENSURE(!isValid(day), "Schedule can't be valid")
+     */
+    void invalidate();
+
+    /**
+     * \brief Give the Vaccins that are delivered on a day and schedule their next delivery, the schedule is valid for
+     *        the next day afterwards
+     *
+     * @param day The day
+     * @param due Filled with the Vaccins in the order of the Hubs and their types
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DeliverySchedule object must be properly initialized")
+     * REQUIRE(isValid(day), "Schedule must be valid")
+     *
+     * @post
+     * ENSURE(isValid(day + 1), "Schedule must be valid for the next day")
+     */
+    void takeDeliveries(int day, std::vector<VaccinInHub*> &due);
+
+    /**
+     * \brief Get the day of the next delivery
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "DeliverySchedule object must be properly initialized")
+     *
+     * @return The day, -1 when no Vaccin is scheduled
+     */
+    int getNextDay() const;
+};
+
+#endif //VACCINDISTRIBUTOR_DELIVERYSCHEDULE_H
@@ -8,8 +8,51 @@
 
 #include <assert.h>
 
+// Contract levels, chosen at build time with -DCONTRACT_LEVEL=...
+//   CONTRACTS_FULL  : every contract is checked (default)
+//   CONTRACTS_CHEAP : REQUIRE/ENSURE are checked, REQUIRE_FULL/ENSURE_FULL are left out
+//   CONTRACTS_OFF   : no contract is checked
+// REQUIRE_FULL/ENSURE_FULL are meant for checks that walk the whole simulation or copy containers.
+#define CONTRACTS_OFF 0
+#define CONTRACTS_CHEAP 1
+#define CONTRACTS_FULL 2
+
+#ifndef CONTRACT_LEVEL
+#define CONTRACT_LEVEL CONTRACTS_FULL
+#endif
+
+#if CONTRACT_LEVEL >= CONTRACTS_CHEAP
+
 #define REQUIRE(assertion, what) \
     if (!(assertion)) __assert (what, __FILE__, __LINE__)
 
 #define ENSURE(assertion, what) \
     if (!(assertion)) __assert (what, __FILE__, __LINE__)
+
+#else
+
+#define REQUIRE(assertion, what) \
+    if (false) (void) (assertion)
+
+#define ENSURE(assertion, what) \
+    if (false) (void) (assertion)
+
+#endif
+
+#if CONTRACT_LEVEL >= CONTRACTS_FULL
+
+#define REQUIRE_FULL(assertion, what) \
+    REQUIRE(assertion, what)
+
+#define ENSURE_FULL(assertion, what) \
+    ENSURE(assertion, what)
+
+#else
+
+#define REQUIRE_FULL(assertion, what) \
+    if (false) (void) (assertion)
+
+#define ENSURE_FULL(assertion, what) \
+    if (false) (void) (assertion)
+
+#endif
@@ -250,27 +250,29 @@ Hub *Dialog::selectHub(std::vector<Hub *> hubs, std::string& titel) {
 VaccinInHub* Dialog::selectVaccin(Hub* hub, std::string& titel) {
     REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
     QStringList items;
-    std::map<std::string, VaccinInHub *> vaccins = hub->getVaccins();
-    for(std::map<std::string, VaccinInHub *>::iterator it = vaccins.begin();
+    const std::map<std::string, VaccinInHub *> &vaccins = hub->getVaccins();
+    for(std::map<std::string, VaccinInHub *>::const_iterator it = vaccins.begin();
         it != vaccins.end(); it++){
         items << tr(std::string((*it).first).c_str());
     }
     bool ok;
     QString item = QInputDialog::getItem(this, titel.c_str(), tr("Select a vaccin: "), items, 0, false, &ok);
-    return vaccins[item.toStdString()];
+    std::map<std::string, VaccinInHub *>::const_iterator selected = vaccins.find(item.toStdString());
+    return selected == vaccins.end() ? NULL : selected->second;
 }
 
 VaccinationCenter *Dialog::selectCenter(Hub* hub, std::string &titel) {
     REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
     QStringList items;
-    std::map<std::string, VaccinationCenter *> centra = hub->getCentra();
-    for(std::map<std::string, VaccinationCenter *>::iterator it = centra.begin();
+    const std::map<std::string, VaccinationCenter *> &centra = hub->getCentra();
+    for(std::map<std::string, VaccinationCenter *>::const_iterator it = centra.begin();
         it != centra.end(); it++){
         items << tr(std::string((*it).first).c_str());
     }
     bool ok;
     QString item = QInputDialog::getItem(this, titel.c_str(), tr("Select an center: "), items, 0, false, &ok);
-    return centra[item.toStdString()];
+    std::map<std::string, VaccinationCenter *>::const_iterator selected = centra.find(item.toStdString());
+    return selected == centra.end() ? NULL : selected->second;
 }
 
 bool Dialog::properlyInitialized() const {
@@ -0,0 +1,367 @@
+/**
+ * @file EventSink.cpp
+ * @brief This file contains the definitions of the members of the EventSink classes
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "EventSink.h"
+#include <cstring>
+#include <deque>
+
+const char BinarySink::kMagic[8] = {'V', 'D', 'E', 'V', 'E', 'N', 'T', '\0'};
+const int32_t BinarySink::kVersion;
+const int32_t BinarySink::kByteOrder;
+const int32_t BinarySink::kName;
+
+namespace {
+
+/**
+ * \brief Event of a type without names and values, the day is the current day of the sink
+ */
+EventSink::Event emptyEvent(EventSink::Event::Type type) {
+    EventSink::Event event;
+    event.type = type;
+    event.day = -1;
+    event.center = NULL;
+    event.vaccin = NULL;
+    event.cargo = 0;
+    event.amount = 0;
+    event.vaccinated = 0;
+    event.population = 0;
+    event.capacity = 0;
+    event.firstShots = 0;
+    return event;
+}
+
+/**
+ * \brief Write a name as a value of a .csv file, nothing is written when the name is not used
+ */
+void writeCsvName(std::ostream &stream, const std::string *name) {
+    if (name != NULL) {
+        stream << CsvField(*name);
+    }
+}
+
+/**
+ * \brief Check whether an event has the names its type uses
+ */
+bool hasNames(const EventSink::Event &event) {
+    bool center = event.type != EventSink::Event::kDelivery;
+    bool vaccin = event.type != EventSink::Event::kVaccination && event.type != EventSink::Event::kCenterStock;
+    return (!center || event.center != NULL) && (!vaccin || event.vaccin != NULL);
+}
+
+/**
+ * \brief Names of the types of events in a .csv file
+ */
+const char *const kTypeNames[] = {"delivery", "requiredTransport", "transport", "discard", "vaccination",
+                                  "centerStock", "vaccinStock"};
+
+}
+
+EventSink::EventSink() : fday(0), flevel(kStock) {
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+}
+
+bool EventSink::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+void EventSink::setDay(int day) {
+
+    REQUIRE(properlyInitialized(), "EventSink object must be properly initialized");
+    REQUIRE(day >= 0, "Day can't be negative");
+    fday = day;
+    ENSURE(getDay() == day, "Day is not set");
+}
+
+int EventSink::getDay() const {
+
+    REQUIRE(properlyInitialized(), "EventSink object must be properly initialized");
+    return fday;
+}
+
+void EventSink::setLevel(Level level) {
+
+    REQUIRE(properlyInitialized(), "EventSink object must be properly initialized");
+    flevel = level;
+    ENSURE(getLevel() == level, "Level is not set");
+}
+
+EventSink::Level EventSink::getLevel() const {
+
+    REQUIRE(properlyInitialized(), "EventSink object must be properly initialized");
+    return flevel;
+}
+
+EventSink::Level EventSink::levelOf(Event::Type type) {
+
+    return type == Event::kCenterStock || type == Event::kVaccinStock ? kStock : kMovements;
+}
+
+void EventSink::record(Event event) {
+
+    REQUIRE(properlyInitialized(), "EventSink object must be properly initialized");
+    if (levelOf(event.type) > flevel) {
+        return;
+    }
+    if (event.day < 0) {
+        event.day = fday;
+    }
+    write(event);
+}
+
+EventSink::Event EventSink::delivery(const std::string &vaccin, int amount) {
+
+    Event event = emptyEvent(Event::kDelivery);
+    event.vaccin = &vaccin;
+    event.amount = amount;
+    return event;
+}
+
+EventSink::Event EventSink::transport(const std::string &center, const std::string &vaccin, int cargo, int amount,
+                                      bool required) {
+
+    Event event = emptyEvent(required ? Event::kRequiredTransport : Event::kTransport);
+    event.center = &center;
+    event.vaccin = &vaccin;
+    event.cargo = cargo;
+    event.amount = amount;
+    return event;
+}
+
+EventSink::Event EventSink::discard(const std::string &center, const std::string &vaccin, int amount) {
+
+    Event event = emptyEvent(Event::kDiscard);
+    event.center = &center;
+    event.vaccin = &vaccin;
+    event.amount = amount;
+    return event;
+}
+
+EventSink::Event EventSink::vaccination(const std::string &center, int vaccinated) {
+
+    Event event = emptyEvent(Event::kVaccination);
+    event.center = &center;
+    event.vaccinated = vaccinated;
+    return event;
+}
+
+EventSink::Event EventSink::centerStock(const std::string &center, int vaccins, int vaccinated, int population,
+                                        int capacity) {
+
+    Event event = emptyEvent(Event::kCenterStock);
+    event.center = &center;
+    event.amount = vaccins;
+    event.vaccinated = vaccinated;
+    event.population = population;
+    event.capacity = capacity;
+    return event;
+}
+
+EventSink::Event EventSink::vaccinStock(const std::string &center, const std::string &vaccin, int vaccins,
+                                        int firstShots) {
+
+    Event event = emptyEvent(Event::kVaccinStock);
+    event.center = &center;
+    event.vaccin = &vaccin;
+    event.amount = vaccins;
+    event.firstShots = firstShots;
+    return event;
+}
+
+void NullSink::write(const Event &) {
+}
+
+void EventBuffer::write(const Event &event) {
+
+    fevents.push_back(event);
+}
+
+const std::vector<EventSink::Event> &EventBuffer::getEvents() const {
+
+    REQUIRE(properlyInitialized(), "EventSink object must be properly initialized");
+    return fevents;
+}
+
+void EventBuffer::replay(EventSink &sink) const {
+
+    REQUIRE(properlyInitialized(), "EventSink object must be properly initialized");
+    REQUIRE(sink.properlyInitialized(), "EventSink object must be properly initialized");
+    for (std::vector<Event>::const_iterator it = fevents.begin(); it != fevents.end(); it++) {
+        sink.record(*it);
+    }
+}
+
+void EventBuffer::clear() {
+
+    REQUIRE(properlyInitialized(), "EventSink object must be properly initialized");
+    fevents.clear();
+    ENSURE(getEvents().empty(), "Events must be removed");
+}
+
+void TeeSink::write(const Event &event) {
+
+    for (std::vector<EventSink *>::const_iterator it = fsinks.begin(); it != fsinks.end(); it++) {
+        (*it)->record(event);
+    }
+}
+
+void TeeSink::add(EventSink *sink) {
+
+    REQUIRE(properlyInitialized(), "EventSink object must be properly initialized");
+    REQUIRE(sink->properlyInitialized(), "EventSink object must be properly initialized");
+    fsinks.push_back(sink);
+}
+
+TextSink::TextSink(std::ostream &stream) : fstream(stream) {
+}
+
+void TextSink::write(const Event &event) {
+
+    switch (event.type) {
+        case Event::kRequiredTransport:
+            fstream << "Er werden " << event.cargo << " nodige (voor 2de vaccinatie) ladingen (" << event.amount;
+            fstream << " vaccins) van " << *event.vaccin << " getransporteerd naar " << *event.center << ".\n";
+            break;
+        case Event::kTransport:
+            fstream << "Er werden " << event.cargo << " ladingen (" << event.amount << " vaccins) van ";
+            fstream << *event.vaccin << " getransporteerd naar " << *event.center << ".\n";
+            break;
+        case Event::kDiscard:
+            fstream << "Er werden " << event.amount << " onodige vaccins van " << *event.vaccin << " verwijderd.\n";
+            break;
+        case Event::kVaccination:
+            fstream << "Er werden " << event.vaccinated << " inwoners gevaccineerd in " << *event.center << ".\n";
+            break;
+        case Event::kCenterStock: {
+            int perVaccin = ToPercent(event.amount, event.capacity);
+            int perVaccinated = ToPercent(event.vaccinated, event.population);
+            if (perVaccin > 100) {
+                perVaccin = 100;
+            }
+            fstream << *event.center << ":" << "\n";
+            fstream << "\t" << "- geavaccineerd " << ProgressBar(perVaccinated, 20) << " " << perVaccinated << "%";
+            fstream << ": " << event.vaccinated << "/" << event.population << "\n";
+            fstream << "\t" << "- " << "vaccins       " << ProgressBar(perVaccin, 20) << " " << perVaccin << "%";
+            fstream << "\n";
+            break;
+        }
+        case Event::kVaccinStock:
+            fstream << "\t \t- " << *event.vaccin << ": " << event.amount << "\n";
+            if (event.firstShots != 0) {
+                fstream << "\t \t \t- " << "Eerste prik: " << ": " << event.firstShots << "\n";
+            }
+            break;
+        case Event::kDelivery:
+            // The text of the simulation doesn't show deliveries
+            break;
+    }
+}
+
+CsvSink::CsvSink(std::ostream &stream) : fstream(stream) {
+
+    fstream << "day,event,center,vaccin,cargo,amount,vaccinated,population,capacity,firstShots\n";
+}
+
+void CsvSink::write(const Event &event) {
+
+    fstream << event.day << ',' << kTypeNames[event.type] << ',';
+    writeCsvName(fstream, event.center);
+    fstream << ',';
+    writeCsvName(fstream, event.vaccin);
+    fstream << ',' << event.cargo << ',' << event.amount << ',' << event.vaccinated << ',' << event.population;
+    fstream << ',' << event.capacity << ',' << event.firstShots << '\n';
+}
+
+BinarySink::BinarySink(std::ostream &stream) : fstream(stream) {
+
+    Header header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byteOrder = kByteOrder;
+    fstream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+}
+
+int32_t BinarySink::nameIndex(const std::string *name) {
+
+    if (name == NULL) {
+        return -1;
+    }
+    // A name that is deleted can be followed by another name on the same address
+    std::map<const std::string *, int32_t>::const_iterator it = findices.find(name);
+    if (it != findices.end() && fnames[it->second] == *name) {
+        return it->second;
+    }
+    int32_t index = static_cast<int32_t>(fnames.size());
+    Record record = {kName, 0, index, -1, 0, static_cast<int32_t>(name->size()), 0, 0, 0, 0};
+    fstream.write(reinterpret_cast<const char *>(&record), sizeof(record));
+    fstream.write(name->data(), name->size());
+    fnames.push_back(*name);
+    findices[name] = index;
+    return index;
+}
+
+void BinarySink::write(const Event &event) {
+
+    int32_t center = nameIndex(event.center);
+    int32_t vaccin = nameIndex(event.vaccin);
+    Record record = {event.type, event.day, center, vaccin, event.cargo, event.amount, event.vaccinated,
+                     event.population, event.capacity, event.firstShots};
+    fstream.write(reinterpret_cast<const char *>(&record), sizeof(record));
+}
+
+void BinarySink::replay(std::istream &stream, EventSink &sink) {
+
+    REQUIRE(sink.properlyInitialized(), "EventSink object must be properly initialized");
+
+    Header header;
+    stream.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!stream || std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion ||
+        header.byteOrder != kByteOrder) {
+        throw Exception("Invalid event log");
+    }
+
+    // Adding names to a deque doesn't move the names that are given to the sink
+    std::deque<std::string> names;
+    Record record;
+    while (stream.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+        if (record.type == kName) {
+            if (record.center != static_cast<int32_t>(names.size()) || record.amount < 0) {
+                throw Exception("Invalid event log");
+            }
+            std::string name(record.amount, '\0');
+            if (!name.empty() && !stream.read(&name[0], name.size())) {
+                throw Exception("Invalid event log");
+            }
+            names.push_back(name);
+            continue;
+        }
+        if (record.type < Event::kDelivery || record.type > Event::kVaccinStock || record.day < 0 ||
+            record.center < -1 || record.center >= static_cast<int32_t>(names.size()) ||
+            record.vaccin < -1 || record.vaccin >= static_cast<int32_t>(names.size())) {
+            throw Exception("Invalid event log");
+        }
+        Event event = emptyEvent(static_cast<Event::Type>(record.type));
+        event.day = record.day;
+        event.center = record.center >= 0 ? &names[record.center] : NULL;
+        event.vaccin = record.vaccin >= 0 ? &names[record.vaccin] : NULL;
+        event.cargo = record.cargo;
+        event.amount = record.amount;
+        event.vaccinated = record.vaccinated;
+        event.population = record.population;
+        event.capacity = record.capacity;
+        event.firstShots = record.firstShots;
+        if (!hasNames(event)) {
+            throw Exception("Invalid event log");
+        }
+        sink.record(event);
+    }
+    if (stream.gcount() != 0) {
+        throw Exception("Invalid event log");
+    }
+}
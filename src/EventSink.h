@@ -0,0 +1,377 @@
+/**
+ * @file EventSink.h
+ * @brief This header file contains the declarations and the members of the EventSink classes
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_EVENTSINK_H
+#define VACCINDISTRIBUTOR_EVENTSINK_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <stdint.h>
+#include "DesignByContract.h"
+#include "Exception.h"
+#include "Utils.h"
+
+/**
+ * \brief Class implemented to receive what happens during a day of the Simulation as small typed events, instead of
+ *        formatted text
+ *
+ * The Hubs and VaccinationCenters record an Event for every transport, vaccination and discard and for the stock at
+ * the end of the day. A sink decides what happens with them: NullSink drops them, TextSink writes the text the
+ * Simulation always wrote, CsvSink and BinarySink write a log and EventBuffer keeps them in memory. Text is only
+ * formatted by a TextSink, so a simulation without one doesn't format anything.
+ */
+class EventSink {
+
+public:
+    /**
+     * \brief Something that happened during a day, the names point to the strings of the Hubs and VaccinationCenters
+     *        and are only valid while those exist
+     */
+    struct Event {
+        /**
+         * \brief Kind of event, the fields that are used are given for every kind
+         */
+        enum Type {
+            kDelivery = 0, ///< vaccin, amount: vaccins in the Hub after a delivery
+            kRequiredTransport = 1, ///< center, vaccin, cargo, amount: loads for second shots and their vaccins
+            kTransport = 2, ///< center, vaccin, cargo, amount: loads and their vaccins
+            kDiscard = 3, ///< center, vaccin, amount: vaccins that are thrown away
+            kVaccination = 4, ///< center, vaccinated: people vaccinated today
+            kCenterStock = 5, ///< center, amount, vaccinated, population, capacity: state at the end of the day
+            kVaccinStock = 6 ///< center, vaccin, amount, firstShots: state of a Vaccin at the end of the day
+        };
+
+        Type type;
+        int day; ///< Day of the event, -1 is the current day of the sink that records it
+        const std::string *center; ///< Name of the VaccinationCenter, NULL when not used
+        const std::string *vaccin; ///< Type of the Vaccin, NULL when not used
+        int cargo;
+        int amount;
+        int vaccinated;
+        int population;
+        int capacity;
+        int firstShots; ///< People waiting for their second shot
+    };
+
+    /**
+     * \brief Events a sink records, every level records the events of the levels before it
+     */
+    enum Level {
+        kMovements = 0, ///< Deliveries, transports, discards and vaccinations
+        kStock = 1 ///< Also the stock of every VaccinationCenter and its Vaccins at the end of the day
+    };
+
+private:
+    int fday; ///< Day of the events that are recorded without a day
+    Level flevel; ///< Events of a higher level are dropped by record
+    EventSink *_initCheck;
+
+protected:
+    /**
+     * \brief Handle an event, the day of the event is set
+     *
+     * @param event The event
+     */
+    virtual void write(const Event &event) = 0;
+
+public:
+    /**
+     * \brief Default constructor for an EventSink object, the current day is 0 and every event is recorded
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     */
+    EventSink();
+
+    virtual ~EventSink() {}
+
+    /**
+     * \brief Check whether the EventSink object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Set the day of the events that are recorded without a day
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "EventSink object must be properly initialized")
+     * REQUIRE(day >= 0, "Day can't be negative")
+     *
+     * @post
+     * ENSURE(getDay() == day, "Day is not set")
+     */
+    void setDay(int day);
+
+    /**
+     * \brief Get the day of the events that are recorded without a day
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "EventSink object must be properly initialized")
+     */
+    int getDay() const;
+
+    /**
+     * \brief Set the level of the events that are recorded
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "EventSink object must be properly initialized")
+     *
+     * @post
+     * ENSURE(getLevel() == level, "Level is not set")
+     */
+    void setLevel(Level level);
+
+    /**
+     * \brief Get the level of the events that are recorded
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "EventSink object must be properly initialized")
+     */
+    Level getLevel() const;
+
+    /**
+     * \brief Get the level of a kind of event
+     */
+    static Level levelOf(Event::Type type);
+
+    /**
+     * \brief Record an event, the current day is used when the event has no day, an event above the level of the
+     *        sink is dropped
+     *
+     * @param event The event
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "EventSink object must be properly initialized")
+     */
+    void record(Event event);
+
+    /**
+     * \brief Event for a delivery to a Hub
+     */
+    static Event delivery(const std::string &vaccin, int amount);
+
+    /**
+     * \brief Event for a transport from a Hub to a VaccinationCenter
+     *
+     * @param required The transport is needed for second shots
+     */
+    static Event transport(const std::string &center, const std::string &vaccin, int cargo, int amount,
+                           bool required);
+
+    /**
+     * \brief Event for vaccins that are thrown away in a VaccinationCenter
+     */
+    static Event discard(const std::string &center, const std::string &vaccin, int amount);
+
+    /**
+     * \brief Event for the people vaccinated in a VaccinationCenter
+     */
+    static Event vaccination(const std::string &center, int vaccinated);
+
+    /**
+     * \brief Event for the stock of a VaccinationCenter
+     */
+    static Event centerStock(const std::string &center, int vaccins, int vaccinated, int population, int capacity);
+
+    /**
+     * \brief Event for the stock of a Vaccin in a VaccinationCenter
+     */
+    static Event vaccinStock(const std::string &center, const std::string &vaccin, int vaccins, int firstShots);
+};
+
+/**
+ * \brief Sink that drops every event
+ */
+class NullSink : public EventSink {
+
+protected:
+    void write(const Event &event);
+};
+
+/**
+ * \brief Sink that keeps the events in memory, they can be given to another sink later
+ */
+class EventBuffer : public EventSink {
+
+private:
+    std::vector<Event> fevents;
+
+protected:
+    void write(const Event &event);
+
+public:
+    /**
+     * \brief Get the events in the order they were recorded
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "EventSink object must be properly initialized")
+     */
+    const std::vector<Event> &getEvents() const;
+
+    /**
+     * \brief Record every event in another sink, in the order they were recorded
+     *
+     * @param sink The other sink
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "EventSink object must be properly initialized")
+     * REQUIRE(sink.properlyInitialized(), "EventSink object must be properly initialized")
+     */
+    void replay(EventSink &sink) const;
+
+    /**
+     * \brief Remove the events
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "EventSink object must be properly initialized")
+     *
+     * @post
+     * ENSURE(getEvents().empty(), "Events must be removed")
+     */
+    void clear();
+};
+
+/**
+ * \brief Sink that records every event in several other sinks
+ */
+class TeeSink : public EventSink {
+
+private:
+    std::vector<EventSink *> fsinks;
+
+protected:
+    void write(const Event &event);
+
+public:
+    /**
+     * \brief Add a sink, it is not deleted by the TeeSink
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "EventSink object must be properly initialized")
+     * REQUIRE(sink->properlyInitialized(), "EventSink object must be properly initialized")
+     */
+    void add(EventSink *sink);
+};
+
+/**
+ * \brief Sink that writes the events as the text of the simulation, the stock is drawn with progress bars
+ */
+class TextSink : public EventSink {
+
+private:
+    std::ostream &fstream;
+
+protected:
+    void write(const Event &event);
+
+public:
+    /**
+     * \brief Constructor for a TextSink object
+     *
+     * @param stream Output-stream for the text
+     */
+    explicit TextSink(std::ostream &stream);
+};
+
+/**
+ * \brief Sink that writes a line with comma separated values for every event, after a line with the names of the
+ *        columns
+ */
+class CsvSink : public EventSink {
+
+private:
+    std::ostream &fstream;
+
+protected:
+    void write(const Event &event);
+
+public:
+    /**
+     * \brief Constructor for a CsvSink object, the names of the columns are written
+     *
+     * @param stream Output-stream for the values
+     */
+    explicit CsvSink(std::ostream &stream);
+};
+
+/**
+ * \brief Sink that writes the events as fixed size records to a binary log, the log can be replayed into another sink
+ *
+ * The log starts with a header, every name is written once in a name record before the first event that uses it.
+ * Numbers are written in the byte order of the machine, like a snapshot.
+ */
+class BinarySink : public EventSink {
+
+private:
+    /**
+     * \brief Start of a log
+     */
+    struct Header {
+        char magic[8]; ///< kMagic
+        int32_t version; ///< kVersion
+        int32_t byteOrder; ///< kByteOrder as written by the machine
+    };
+
+    /**
+     * \brief Event with the names as indices of the name records, or a name record with type kName and the length
+     *        of the name in amount, followed by the name
+     */
+    struct Record {
+        int32_t type;
+        int32_t day;
+        int32_t center; ///< Index of the name, -1 when not used
+        int32_t vaccin; ///< Index of the name, -1 when not used
+        int32_t cargo;
+        int32_t amount;
+        int32_t vaccinated;
+        int32_t population;
+        int32_t capacity;
+        int32_t firstShots;
+    };
+
+    static const char kMagic[8]; ///< First bytes of every log
+    static const int32_t kVersion = 1; ///< Version of the format, increased with every change of the records
+    static const int32_t kByteOrder = 0x01020304; ///< Written as a number to detect the byte order
+    static const int32_t kName = -1; ///< Type of a name record
+
+    std::ostream &fstream;
+    std::map<const std::string *, int32_t> findices; ///< Index of every name that is written
+    std::vector<std::string> fnames; ///< Names in the order they are written
+
+    /**
+     * \brief Get the index of a name, a name record is written when the name is new
+     */
+    int32_t nameIndex(const std::string *name);
+
+protected:
+    void write(const Event &event);
+
+public:
+    /**
+     * \brief Constructor for a BinarySink object, the header is written
+     *
+     * @param stream Output-stream, opened in binary mode
+     */
+    explicit BinarySink(std::ostream &stream);
+
+    /**
+     * \brief Record the events of a log in a sink, throws an Exception when the stream is not a valid log
+     *
+     * @param stream Input-stream with the log, opened in binary mode
+     * @param sink The sink, the names of the events are only valid during the call
+     *
+     * @pre
+     * REQUIRE(sink.properlyInitialized(), "EventSink object must be properly initialized")
+     */
+    static void replay(std::istream &stream, EventSink &sink);
+};
+
+#endif //VACCINDISTRIBUTOR_EVENTSINK_H
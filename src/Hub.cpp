@@ -6,11 +6,52 @@
  */
 
 #include "Hub.h"
+#include <algorithm>
+#include "LoadAllocator.h"
+#include "DeliverySchedule.h"
+#include "CenterTable.h"
+
+/**
+ * \brief Ratio used to select the VaccinationCenter that gets the next load of vaccins
+ *
+ * @param center Pointer to VaccinationCenter object
+ *
+ * @return (vaccinated + vaccins) / population as double
+ */
+static double coverageRatio(const VaccinationCenter *center) {
+    return ((double)(center->getVaccinated()) + (double)(center->getVaccins())) / (double)(center->getPopulation());
+}
+
+/**
+ * \brief Amount of loads in an amount of vaccins, rounded down, also when the amount is negative
+ *
+ * @param vaccins Amount of vaccins
+ * @param transport Vaccins in a load
+ *
+ * @return Amount of loads
+ */
+static int floorLoads(int vaccins, int transport) {
+    return vaccins >= 0 ? vaccins / transport : -((-vaccins + transport - 1) / transport);
+}
+
+/**
+ * \brief Orders VaccinationCenters on the order they were created in
+ */
+struct CreatedBefore {
+    bool operator()(const VaccinationCenter *a, const VaccinationCenter *b) const {
+        return a->getCreated() < b->getCreated();
+    }
+};
 
 Hub::Hub(){
 
     fcentra.clear();
     fvaccins.clear();
+    ftotalVaccins = 0;
+    ftotalDelivery = 0;
+    fschedule = NULL;
+    fallocation = LoadAllocator::kWaterFilling;
+    ftable = NULL;
     _initCheck = this;
     ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
 }
@@ -19,18 +60,23 @@ void Hub::copyHub(const Hub *h, const std::map<std::string, VaccinationCenter*>
 
     REQUIRE(h->properlyInitialized(), "Hub must be properly initialized");
 
+    unbind();
     for (std::map<std::string, VaccinInHub*>::const_iterator it = h->getVaccins().begin(); it != h->getVaccins().end(); it++) {
 
         VaccinInHub *v = new VaccinInHub();
         v->copyVaccin(it->second);
 
         this->fvaccins.insert(std::make_pair(v->getType(), v));
+        v->fhub = this;
+        this->ftotalVaccins += v->getVaccin();
+        this->ftotalDelivery += v->getDelivery();
     }
 
     for (std::map<std::string, VaccinationCenter*>::const_iterator it = h->getCentra().begin(); it != h->getCentra().end(); it++) {
 
         this->fcentra.insert(std::make_pair(it->first, centra.find(it->first)->second));
     }
+    this->fallocation = h->fallocation;
     this->_initCheck = this;
     ENSURE(properlyInitialized(), "Copy constructor must end in properlyInitialized state");
 }
@@ -43,11 +89,8 @@ bool Hub::properlyInitialized() const {
 int Hub::getDelivery() const {
 
     REQUIRE(properlyInitialized(), "Hub must be properly initialized");
-    int totalDelivery = 0;
-    for(std::map<std::string, VaccinInHub*>::const_iterator it = fvaccins.begin(); it != fvaccins.end(); it++){
-        totalDelivery += (*it).second->getDelivery();
-    }
-    return totalDelivery;
+    ENSURE_FULL(checkTotals(), "Totals of the Hub are not up to date");
+    return ftotalDelivery;
 }
 
 int Hub::getInterval() const {
@@ -72,13 +115,36 @@ int Hub::getTransport() const {
 
 int Hub::getAmountVaccin() const {
 
+    REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    ENSURE_FULL(checkTotals(), "Totals of the Hub are not up to date");
+    return ftotalVaccins;
+}
+
+bool Hub::isActive() const {
+
+    REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    if (ftotalVaccins == 0) {
+        return false;
+    }
+    for (std::map<std::string, VaccinInHub*>::const_iterator it = fvaccins.begin(); it != fvaccins.end(); it++) {
+        if (it->second->getVaccin() >= it->second->getTransport()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Hub::checkTotals() const {
+
     REQUIRE(properlyInitialized(), "Hub must be properly initialized");
     int totalVaccins = 0;
+    int totalDelivery = 0;
 
     for (std::map<std::string, VaccinInHub*>::const_iterator it = fvaccins.begin(); it != fvaccins.end(); it++) {
         totalVaccins += (*it).second->getVaccin();
+        totalDelivery += (*it).second->getDelivery();
     }
-    return totalVaccins;
+    return totalVaccins == ftotalVaccins && totalDelivery == ftotalDelivery;
 }
 
 const std::map<std::string, VaccinationCenter*> &Hub::getCentra() const {
@@ -110,25 +176,29 @@ void Hub::distributeRequiredVaccins(VaccinationCenter* vaccinationCenter, std::o
 
     REQUIRE(properlyInitialized(), "Hub must be properly initialized");
     REQUIRE(vaccinationCenter->properlyInitialized(), "VaccinationCenter must be properly initialized");
-    REQUIRE(vaccinationCenter->properlyInitialized(), "VaccinationCenter must be properly initialized");
 
-    vaccinationCenter->requiredAmountVaccinType();
-    // Display information of transport
-    std::map<std::string, int> requeredVaccins = vaccinationCenter->requiredAmountVaccinType();
+    TextSink text(stream);
+    distributeRequiredVaccins(vaccinationCenter, text);
+}
+
+void Hub::distributeRequiredVaccins(VaccinationCenter* vaccinationCenter, EventSink &sink) {
 
-    for (std::map<std::string, int>::iterator it = requeredVaccins.begin(); it != requeredVaccins.end(); it++) {
+    REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    REQUIRE(vaccinationCenter->properlyInitialized(), "VaccinationCenter must be properly initialized");
 
-        if(fvaccins.find(it->first) != fvaccins.end()){
+    // Types in the order of their names, a transport only changes the amount of its own type
+    const std::map<const std::string, VaccinInCenter*> &types = vaccinationCenter->vaccinsType();
+    for (std::map<const std::string, VaccinInCenter*>::const_iterator it = types.begin(); it != types.end(); it++) {
 
-            VaccinInHub* vaccin = fvaccins[it->first];
-            int vaccinsNeeded = it->second;
+        int vaccinsNeeded = vaccinationCenter->requiredAmountVaccin(it->second);
+        VaccinInHub* vaccin = vaccinsNeeded != 0 ? findVaccin(it->second) : NULL;
+        if (vaccin != NULL) {
 
             int cargo = ceil((double)(vaccinsNeeded) / (double)(vaccin->getTransport()));
 
-            while(vaccinationCenter->getOpenVaccinStorage(vaccin) < vaccin->getTransport() * cargo || cargo * vaccin->getTransport() > vaccin->getVaccin())
-            {
-                cargo--;
-            }
+            // The most loads that fit in the storage of the center and in the stock of the Hub
+            cargo = std::min(cargo, floorLoads(vaccinationCenter->getOpenVaccinStorage(vaccin), vaccin->getTransport()));
+            cargo = std::min(cargo, floorLoads(vaccin->getVaccin(), vaccin->getTransport()));
 
             int vaccinsTransport = cargo * vaccin->getTransport();
             vaccin->updateVaccinsTransport(vaccinsTransport);
@@ -138,8 +208,8 @@ void Hub::distributeRequiredVaccins(VaccinationCenter* vaccinationCenter, std::o
                 return;
             }
 
-            stream << "Er werden " << cargo << " nodige (voor 2de vaccinatie) ladingen (" << vaccinsTransport << " vaccins)" << " van " << vaccin->getType() << " getransporteerd naar ";
-            stream << vaccinationCenter->getName() << ".\n";
+            sink.record(EventSink::transport(vaccinationCenter->getName(), vaccin->getType(), cargo, vaccinsTransport,
+                                             true));
         }
     }
 }
@@ -151,43 +221,68 @@ void Hub::distributeVaccinsFair(VaccinInHub* vaccin, int currentDay, std::ostrea
     REQUIRE(vaccin->properlyInitialized(), "VaccinationCenter must be properly initialized");
     REQUIRE(containsVaccin(vaccin), "Given vaccin must exist");
 
-    std::map<VaccinationCenter*, std::pair<int,int> > vaccinationCenterCargoTransport;
-    int maxVaccinDeliveryDay = (vaccin->getVaccin())/(vaccin->getInterval() - (currentDay%vaccin->getInterval()));
+    TextSink text(stream);
+    distributeVaccinsFair(vaccin, currentDay, text);
+}
 
-    int vaccinsTransport = vaccin->getTransport();
-    for(int i = 0; i <= maxVaccinDeliveryDay; i+=vaccinsTransport){
-        if(vaccin->getVaccin() >= vaccin->getTransport()){
+void Hub::distributeVaccinsFair(VaccinInHub* vaccin, int currentDay, EventSink &sink) {
 
-            VaccinationCenter* center = mostSuitableVaccinationCenter(vaccin->getTransport(), vaccin);
+    REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    REQUIRE(currentDay >= 0, "currentDay cannot be negative");
+    REQUIRE(vaccin->properlyInitialized(), "VaccinationCenter must be properly initialized");
+    REQUIRE(containsVaccin(vaccin), "Given vaccin must exist");
 
-            if (center == NULL) {
-                continue;
-            }
+    // Between deliveries the stock is mostly less than a load, then no center has to be looked at
+    if (vaccin->getVaccin() < vaccin->getTransport()) {
+        return;
+    }
+
+    // Transports are reported in the order the centra were created, which is the order of the simulation file
+    std::map<VaccinationCenter*, std::pair<int,int>, CreatedBefore> vaccinationCenterCargoTransport;
+    int maxVaccinDeliveryDay = (vaccin->getVaccin())/(vaccin->getInterval() - (currentDay%vaccin->getInterval()));
 
-            if(center->properlyInitialized()){
-                if(vaccinationCenterCargoTransport.find(center) == vaccinationCenterCargoTransport.end()){
-                    vaccinationCenterCargoTransport[center] = std::make_pair(0,0);
-                }
+    int vaccinsTransport = vaccin->getTransport();
+
+    // Centra that can store a load. A load only changes the center that receives it, so the loads of every center
+    // are known before the first one is given.
+    LoadAllocator allocator;
+    for (std::map<std::string, VaccinationCenter*>::const_iterator it = fcentra.begin(); it != fcentra.end(); it++) {
+        int openLoads = it->second->getOpenLoads(vaccin);
+        if (openLoads > 0) {
+            VaccinationCenter *center = it->second;
+            LoadAllocator::Candidate candidate = {center, center->getVaccinated() + center->getVaccins(),
+                                                  center->getPopulation(), openLoads,
+                                                  center->totalWaitingForSeccondPrik() + center->getVaccinated() ==
+                                                  center->getPopulation()};
+            allocator.add(candidate);
+        }
+    }
 
-                if (center->totalWaitingForSeccondPrik() + center->getVaccinated() == center->getPopulation()) {
-                    continue;
-                }
+    // A load for every transport of the share of today, as long as there are full loads in stock
+    int loads = std::min(maxVaccinDeliveryDay / vaccinsTransport + 1, vaccin->getVaccin() / vaccinsTransport);
+    allocator.allocate(loads, vaccinsTransport, fallocation);
 
-                vaccinationCenterCargoTransport[center].first += 1;
-                vaccinationCenterCargoTransport[center].second += vaccinsTransport;
-                vaccin->updateVaccinsTransport(vaccinsTransport);
-                center->addVaccins(vaccinsTransport, vaccin);
-            }
+    const std::vector<LoadAllocator::Candidate> &candidates = allocator.getCandidates();
+    for (unsigned int i = 0; i < candidates.size(); i++) {
+        int cargo = allocator.getLoads()[i];
+        if (cargo == 0) {
+            continue;
         }
+        vaccinationCenterCargoTransport[candidates[i].center] = std::make_pair(cargo, cargo * vaccinsTransport);
+        vaccin->updateVaccinsTransport(cargo * vaccinsTransport);
+        candidates[i].center->addVaccins(cargo * vaccinsTransport, vaccin);
+    }
+    // The center that stopped the distribution is reported without loads
+    if (allocator.getStopped() != -1) {
+        vaccinationCenterCargoTransport[candidates[allocator.getStopped()].center] = std::make_pair(0, 0);
     }
 
-    // Display information of transport
-    for (std::map<VaccinationCenter*, std::pair<int,int> >::iterator it = vaccinationCenterCargoTransport.begin(); it != vaccinationCenterCargoTransport.end(); it++) {
+    // Record the transports
+    for (std::map<VaccinationCenter*, std::pair<int,int>, CreatedBefore>::iterator it = vaccinationCenterCargoTransport.begin(); it != vaccinationCenterCargoTransport.end(); it++) {
         int cargo = it->second.first;
         int vaccinTransport = it->second.second;
 
-        stream << "Er werden " << cargo << " ladingen (" << vaccinTransport << " vaccins)" << " van " << vaccin->getType() << " getransporteerd naar ";
-        stream << it->first->getName() << ".\n";
+        sink.record(EventSink::transport(it->first->getName(), vaccin->getType(), cargo, vaccinTransport, false));
     }
 }
 
@@ -198,10 +293,74 @@ void Hub::addVaccin(VaccinInHub* vaccin) {
     REQUIRE(!containsVaccin(vaccin), "Vaccin can't yet exist in Hub");
 
     this->fvaccins.insert(std::make_pair(vaccin->getType(), vaccin));
+    vaccin->fhub = this;
+    this->ftotalVaccins += vaccin->getVaccin();
+    this->ftotalDelivery += vaccin->getDelivery();
+    if (fschedule != NULL) {
+        fschedule->invalidate();
+    }
+    unbind();
 
     ENSURE(containsVaccin(vaccin), "Vaccin must be added to Hub");
 }
 
+void Hub::setJournal(Journal *journal) {
+
+    REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    for (std::map<std::string, VaccinInHub*>::iterator it = fvaccins.begin(); it != fvaccins.end(); it++) {
+        it->second->setJournal(journal);
+    }
+}
+
+void Hub::setSchedule(DeliverySchedule *schedule) {
+
+    REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    fschedule = schedule;
+}
+
+void Hub::setAllocation(LoadAllocator::Mode mode) {
+
+    REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    fallocation = mode;
+    ENSURE(getAllocation() == mode, "Allocation is not set");
+}
+
+LoadAllocator::Mode Hub::getAllocation() const {
+
+    REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    return fallocation;
+}
+
+void Hub::bind(const CenterTable *table) {
+
+    REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+
+    ftable = table;
+    ftypes.assign(table->getTypes(), NULL);
+    for (std::map<std::string, VaccinInHub*>::iterator it = fvaccins.begin(); it != fvaccins.end(); it++) {
+        int type = table->findType(it->first);
+        REQUIRE(type != -1, "Every Vaccin type must have a column in the table");
+        it->second->ftypeTable = table;
+        it->second->ftypeIndex = type;
+        ftypes[type] = it->second;
+    }
+}
+
+void Hub::unbind() {
+
+    ftable = NULL;
+    ftypes.clear();
+}
+
+VaccinInHub *Hub::findVaccin(const VaccinInCenter *type) const {
+
+    if (ftable != NULL && type->getTable() == ftable) {
+        return type->getTypeIndex() < static_cast<int>(ftypes.size()) ? ftypes[type->getTypeIndex()] : NULL;
+    }
+    std::map<std::string, VaccinInHub*>::const_iterator it = fvaccins.find(type->getType());
+    return it == fvaccins.end() ? NULL : it->second;
+}
+
 const std::map<std::string, VaccinInHub*> &Hub::getVaccins() const {
 
     REQUIRE(properlyInitialized(), "Hub must be properly initialized");
@@ -214,7 +373,7 @@ std::map<std::string, VaccinInHub *> &Hub::getVaccins() {
     return fvaccins;
 }
 
-void Hub::print(std::ofstream &stream) const {
+void Hub::print(std::ostream &stream) const {
 
     REQUIRE(properlyInitialized(), "Hub must be properly initialized");
 
@@ -229,9 +388,15 @@ void Hub::print(std::ofstream &stream) const {
 }
 
 void Hub::printGraphical(std::ostream &stream) const {
+    REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    TextSink text(stream);
+    recordStock(text);
+}
+
+void Hub::recordStock(EventSink &sink) const {
     REQUIRE(properlyInitialized(), "Hub must be properly initialized");
     for (std::map<std::string, VaccinationCenter*>::const_iterator it = this->fcentra.begin(); it != this->fcentra.end(); it++) {
-        it->second->printGraphical(stream);
+        it->second->recordStock(sink);
     }
 }
 
@@ -261,7 +426,7 @@ const Hub::stockToSizeReturn Hub::stockToSize() const {
     }
 }
 
-std::string Hub::generateIni(std::ofstream &stream, int & counterFigures, int & counterHub) const {
+std::string Hub::generateIni(std::ostream &stream, int & counterFigures, int & counterHub) const {
 
     REQUIRE(properlyInitialized(), "Hub must be properly initialized");
 
@@ -303,6 +468,23 @@ std::string Hub::generateIni(std::ofstream &stream, int & counterFigures, int &
     return "(" + ToString(positionX) + ", 0, 0)\n";
 }
 
+Scene::Vector3 Hub::generateScene(Scene &scene, int &counterHub) const {
+
+    REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    REQUIRE(scene.properlyInitialized(), "Scene must be properly initialized");
+
+    Hub::stockToSizeReturn data = stockToSize();
+
+    // Same places, sizes and colors as in the .ini file of generateIni, the cube and the cone both count as a Hub
+    Scene::Vector3 position(static_cast<double>(counterHub) / 1.2, 0, 0);
+    scene.addFigure(Scene::Figure(Scene::Figure::kCube, data.cubeScale, position, Scene::Color(0, 0.6, 0.3)));
+    scene.addFigure(Scene::Figure(Scene::Figure::kCone, data.coneScale,
+                                  Scene::Vector3(position.x, 0, data.coneCenterZ), Scene::Color(0, 0.6, 0.4),
+                                  data.coneN, 1));
+    counterHub += 2;
+    return position;
+}
+
 VaccinationCenter *Hub::mostSuitableVaccinationCenter(int vaccinCount, VaccinInHub* vaccin) {
 
     REQUIRE(properlyInitialized(), "Hub must be properly initialized");
@@ -315,8 +497,7 @@ VaccinationCenter *Hub::mostSuitableVaccinationCenter(int vaccinCount, VaccinInH
     for (std::map<std::string, VaccinationCenter *>::const_iterator it = this->getCentra().begin(); it != this->getCentra().end(); it++) {
         //selecteer het centrum met het miste vaccins tov de capaciteit
 
-        if(((((double)(it->second->getVaccinated()) + (double)(it->second->getVaccins()))/(double)(it->second->getPopulation()) <= ((double)(center->getVaccinated())+ (double)(center->getVaccins()))/(double)(center->getPopulation()))
-        || !centerReached) && (it->second->getOpenVaccinStorage(vaccin) >= vaccinCount)){
+        if((coverageRatio(it->second) <= coverageRatio(center) || !centerReached) && (it->second->getOpenVaccinStorage(vaccin) >= vaccinCount)){
             center = it->second;
             centerReached = true;
         }
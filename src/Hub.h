@@ -13,8 +13,11 @@
 #include "DesignByContract.h"
 #include "VaccinationCenter.h"
 #include "Vaccin.h"
+#include "LoadAllocator.h"
 #include <cmath>
 
+class DeliverySchedule;
+
 /**
  * \brief Class implemented for a Hub
  */
@@ -23,7 +26,31 @@ class Hub {
 private:
     std::map<std::string, VaccinInHub*> fvaccins; ///< Map with pointers to Vaccins of hub
     std::map<std::string, VaccinationCenter*> fcentra ; ///< Map with the connected VaccinationCenters
+    int ftotalVaccins; ///< Amount of vaccins of all Vaccins, changed by the Vaccins
+    int ftotalDelivery; ///< Delivery of all Vaccins, changed by the Vaccins
+    DeliverySchedule *fschedule; ///< Schedule with the deliveries of the Vaccins, invalidated when one changes
+    LoadAllocator::Mode fallocation; ///< Way distributeVaccinsFair divides the loads over the centra
+    const CenterTable *ftable; ///< Table with the columns of the Vaccin types, NULL when the Hub isn't bound to one
+    std::vector<VaccinInHub*> ftypes; ///< Vaccin of every column of ftable, NULL for types the Hub hasn't
     Hub *_initCheck;
+
+    friend class VaccinInHub;
+
+    /**
+     * \brief Find the Vaccin of the type of a Vaccin of a center, on its column when the Hub is bound to the table
+     *        of the center and on its name when not
+     *
+     * @param type Vaccin type of a VaccinationCenter
+     *
+     * @return Vaccin of the Hub, NULL when the Hub doesn't have the type
+     */
+    VaccinInHub *findVaccin(const VaccinInCenter *type) const;
+
+    /**
+     * \brief Stop finding the Vaccins on their columns, until the Hub is bound again
+     */
+    void unbind();
+
 public:
     /**
      * \brief Non-default constructor for a Hub object
@@ -73,6 +100,9 @@ public:
      * @pre
      * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
      *
+     * @post
+     * ENSURE_FULL(checkTotals(), "Totals of the Hub are not up to date")
+     *
      * @return Amount of vaccins
      */
     int getDelivery() const;
@@ -103,10 +133,33 @@ public:
      * @pre
      * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
      *
+     * @post
+     * ENSURE_FULL(checkTotals(), "Totals of the Hub are not up to date")
+     *
      * @return Amount of vaccins as int
      */
     int getAmountVaccin() const;
 
+    /**
+     * \brief Check if the Hub has a load of a Vaccin in stock, only a full load can be transported
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
+     *
+     * @return true when the Hub can transport a Vaccin
+     */
+    bool isActive() const;
+
+    /**
+     * \brief Check the total amount of vaccins and delivery against the Vaccins of the Hub
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
+     *
+     * @return true when the totals are the sums of the Vaccins
+     */
+    bool checkTotals() const;
+
     /**
      * \brief Get vaccins of Hub object
      *
@@ -142,6 +195,59 @@ public:
      */
     void addVaccin(VaccinInHub* Vaccin);
 
+    /**
+     * \brief Set the Journal that records the changes of the vaccins of the Hub
+     *
+     * @param journal Pointer to Journal object, NULL to stop recording
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
+     */
+    void setJournal(Journal *journal);
+
+    /**
+     * \brief Set the DeliverySchedule that has to be built again when a Vaccin is added or its interval changes
+     *
+     * @param schedule Pointer to DeliverySchedule object, NULL when the Hub isn't scheduled
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
+     */
+    void setSchedule(DeliverySchedule *schedule);
+
+    /**
+     * \brief Set the way distributeVaccinsFair divides the loads over the centra, both give the same loads
+     *
+     * @param mode LoadAllocator::kWaterFilling (default) or LoadAllocator::kSequential
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
+     *
+     * @post
+     * ENSURE(getAllocation() == mode, "Allocation is not set")
+     */
+    void setAllocation(LoadAllocator::Mode mode);
+
+    /**
+     * \brief Get the way distributeVaccinsFair divides the loads over the centra
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
+     */
+    LoadAllocator::Mode getAllocation() const;
+
+    /**
+     * \brief Bind the Vaccins to the columns of their types in the table of the centra, a Vaccin added later unbinds
+     *        the Hub
+     *
+     * @param table Table of the centra of the Hub
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
+     * REQUIRE(table->findType(type) != -1, "Every Vaccin type must have a column in the table")
+     */
+    void bind(const CenterTable *table);
+
     /**
      * \brief Get map with connected VaccinationCenters to Hub
      *
@@ -192,6 +298,22 @@ public:
     */
     void distributeVaccinsFair(VaccinInHub* vaccin, int currentDay, std::ostream &stream);
 
+    /**
+    * \brief Distribute vaccin fairly between the centers and over the days, a transport event is recorded for every
+    *        center that receives vaccins
+    *
+    * @param vaccin: Vaccin that needs to be distributed
+    * @param currentDay: the current day of the simulation
+    * @param sink: sink for the events
+    *
+    * @pre
+    * REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    * REQUIRE(currentDay >= 0, "currentDay cannot be negative");
+    * REQUIRE(vaccin->properlyInitialized(), "VaccinationCenter must be properly initialized");
+    * REQUIRE(containsVaccin(vaccin), "Given vaccin must exist");
+    */
+    void distributeVaccinsFair(VaccinInHub* vaccin, int currentDay, EventSink &sink);
+
     /**
     * \brief Distribute required vaccins over an vaccinationCenter
     *
@@ -206,6 +328,18 @@ public:
     */
     void distributeRequiredVaccins(VaccinationCenter* vaccinationCenter, std::ostream &stream);
 
+    /**
+    * \brief Distribute required vaccins over an vaccinationCenter, a transport event is recorded for every transport
+    *
+    * @param vaccinationCenter: gives this center the required vaccins
+    * @param sink: sink for the events
+    *
+    * @pre
+    * REQUIRE(properlyInitialized(), "Hub must be properly initialized");
+    * REQUIRE(vaccinationCenter->properlyInitialized(), "VaccinationCenter must be properly initialized");
+    */
+    void distributeRequiredVaccins(VaccinationCenter* vaccinationCenter, EventSink &sink);
+
     /**
     * \brief Gives the most suitable VaccinationCenter for a specified amount of a vaccin type
     *
@@ -229,7 +363,7 @@ public:
      * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
      * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
      */
-    void print(std::ofstream& stream) const;
+    void print(std::ostream& stream) const;
 
     /**
      *\brief Print out data of each vaccinationCenter with progressBar
@@ -242,6 +376,16 @@ public:
      */
     void printGraphical(std::ostream& stream) const;
 
+    /**
+     * \brief Record the stock of each vaccinationCenter, the events of printGraphical
+     *
+     * @param sink Sink for the events
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
+     */
+    void recordStock(EventSink &sink) const;
+
     /**
      * \brief Hold the return data of the stockToSize() function
      */
@@ -290,7 +434,21 @@ public:
      *
      * @return Cartesian coordinates of Hub as string in .ini file format
      */
-    std::string generateIni(std::ofstream & stream, int & counterFigures, int & counterHub) const;
+    std::string generateIni(std::ostream & stream, int & counterFigures, int & counterHub) const;
+
+    /**
+     * \brief Add the Hub to a Scene, as a cube and a cone like in the .ini file of generateIni
+     *
+     * @param scene The Scene
+     * @param counterHub Current number of Hub figures already in the Scene
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Hub must be properly initialized")
+     * REQUIRE(scene.properlyInitialized(), "Scene must be properly initialized")
+     *
+     * @return Cartesian coordinates of Hub
+     */
+    Scene::Vector3 generateScene(Scene &scene, int &counterHub) const;
 
     /**
      * \brief Check if centerName exist in Hub vaccinnationcenter map
@@ -0,0 +1,146 @@
+/**
+ * @file Image.cpp
+ * @brief This file contains the definitions of the members of the Image class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include <fstream>
+#include "Image.h"
+
+/**
+ * \brief Write a number as little endian bytes, the byte order of a .bmp file
+ */
+static void writeLittleEndian(std::ostream &stream, unsigned int value, int bytes) {
+
+    for (int i = 0; i < bytes; i++) {
+        stream.put(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+Image::Image(int width, int height, unsigned char red, unsigned char green, unsigned char blue)
+    : fwidth(width), fheight(height) {
+
+    REQUIRE(width > 0 && height > 0, "Image can't be empty");
+
+    fpixels.resize(static_cast<size_t>(width) * height * 3);
+    for (size_t i = 0; i < fpixels.size(); i += 3) {
+        fpixels[i] = red;
+        fpixels[i + 1] = green;
+        fpixels[i + 2] = blue;
+    }
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+}
+
+Image::Image(const Image &image) : fwidth(image.fwidth), fheight(image.fheight), fpixels(image.fpixels) {
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+}
+
+Image &Image::operator=(const Image &image) {
+
+    REQUIRE(properlyInitialized(), "Image object must be properly initialized");
+    fwidth = image.fwidth;
+    fheight = image.fheight;
+    fpixels = image.fpixels;
+    return *this;
+}
+
+bool Image::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+int Image::getWidth() const {
+
+    REQUIRE(properlyInitialized(), "Image object must be properly initialized");
+    return fwidth;
+}
+
+int Image::getHeight() const {
+
+    REQUIRE(properlyInitialized(), "Image object must be properly initialized");
+    return fheight;
+}
+
+const unsigned char *Image::getPixels() const {
+
+    REQUIRE(properlyInitialized(), "Image object must be properly initialized");
+    return &fpixels[0];
+}
+
+void Image::setPixel(int x, int y, unsigned char red, unsigned char green, unsigned char blue) {
+
+    REQUIRE(properlyInitialized(), "Image object must be properly initialized");
+    REQUIRE(x >= 0 && x < getWidth() && y >= 0 && y < getHeight(), "Pixel must be in the image");
+
+    size_t index = (static_cast<size_t>(y) * fwidth + x) * 3;
+    fpixels[index] = red;
+    fpixels[index + 1] = green;
+    fpixels[index + 2] = blue;
+}
+
+unsigned char Image::getPixel(int x, int y, int channel) const {
+
+    REQUIRE(properlyInitialized(), "Image object must be properly initialized");
+    REQUIRE(x >= 0 && x < getWidth() && y >= 0 && y < getHeight(), "Pixel must be in the image");
+    REQUIRE(channel >= 0 && channel < 3, "Channel must be red, green or blue");
+
+    return fpixels[(static_cast<size_t>(y) * fwidth + x) * 3 + channel];
+}
+
+void Image::writeBmp(std::ostream &stream) const {
+
+    REQUIRE(properlyInitialized(), "Image object must be properly initialized");
+
+    // Every row is padded to a multiple of 4 bytes
+    unsigned int rowSize = (static_cast<unsigned int>(fwidth) * 3 + 3) & ~3u;
+    unsigned int pixelsSize = rowSize * fheight;
+
+    // File header
+    stream.put('B');
+    stream.put('M');
+    writeLittleEndian(stream, 54 + pixelsSize, 4);
+    writeLittleEndian(stream, 0, 4);
+    writeLittleEndian(stream, 54, 4);
+
+    // Info header: 24 bits per pixel without compression, 2835 pixels per meter is 72 dpi
+    writeLittleEndian(stream, 40, 4);
+    writeLittleEndian(stream, fwidth, 4);
+    writeLittleEndian(stream, fheight, 4);
+    writeLittleEndian(stream, 1, 2);
+    writeLittleEndian(stream, 24, 2);
+    writeLittleEndian(stream, 0, 4);
+    writeLittleEndian(stream, pixelsSize, 4);
+    writeLittleEndian(stream, 2835, 4);
+    writeLittleEndian(stream, 2835, 4);
+    writeLittleEndian(stream, 0, 4);
+    writeLittleEndian(stream, 0, 4);
+
+    // The rows of a .bmp file start at the bottom and every pixel is blue, green, red
+    std::vector<char> row(rowSize, 0);
+    for (int y = fheight - 1; y >= 0; y--) {
+        const unsigned char *pixel = &fpixels[static_cast<size_t>(y) * fwidth * 3];
+        for (int x = 0; x < fwidth; x++) {
+            row[x * 3] = static_cast<char>(pixel[x * 3 + 2]);
+            row[x * 3 + 1] = static_cast<char>(pixel[x * 3 + 1]);
+            row[x * 3 + 2] = static_cast<char>(pixel[x * 3]);
+        }
+        stream.write(&row[0], rowSize);
+    }
+}
+
+bool Image::writeBmp(const std::string &path) const {
+
+    REQUIRE(properlyInitialized(), "Image object must be properly initialized");
+
+    std::ofstream file(path.c_str(), std::ios::out | std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    writeBmp(file);
+    file.close();
+    return !file.fail();
+}
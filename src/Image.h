@@ -0,0 +1,139 @@
+/**
+ * @file Image.h
+ * @brief This header file contains the declarations and the members of the Image class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_IMAGE_H
+#define VACCINDISTRIBUTOR_IMAGE_H
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "DesignByContract.h"
+
+/**
+ * \brief Class implemented for an image in memory, every pixel is a red, green and blue byte
+ *
+ * The pixels are stored row after row starting with the top row, so the rows can be given to a QImage with
+ * QImage::Format_RGB888 as they are.
+ */
+class Image {
+
+private:
+    int fwidth;
+    int fheight;
+    std::vector<unsigned char> fpixels; ///< Red, green and blue of every pixel, row after row from the top
+    Image *_initCheck;
+
+public:
+    /**
+     * \brief Constructor for an Image object with every pixel in the same color
+     *
+     * @param width Width in pixels
+     * @param height Height in pixels
+     * @param red Red of every pixel
+     * @param green Green of every pixel
+     * @param blue Blue of every pixel
+     *
+     * @pre
+     * REQUIRE(width > 0 && height > 0, "Image can't be empty")
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     */
+    Image(int width, int height, unsigned char red, unsigned char green, unsigned char blue);
+
+    /**
+     * \brief Copy constructor for an Image object
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     */
+    Image(const Image &image);
+
+    /**
+     * \brief Assign the pixels of another Image
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Image object must be properly initialized")
+     */
+    Image &operator=(const Image &image);
+
+    /**
+     * \brief Check whether the Image object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Get the width in pixels
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Image object must be properly initialized")
+     */
+    int getWidth() const;
+
+    /**
+     * \brief Get the height in pixels
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Image object must be properly initialized")
+     */
+    int getHeight() const;
+
+    /**
+     * \brief Get the pixels, 3 bytes for every pixel, row after row from the top
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Image object must be properly initialized")
+     */
+    const unsigned char *getPixels() const;
+
+    /**
+     * \brief Set the color of a pixel, x = 0 is the left column and y = 0 the top row
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Image object must be properly initialized")
+     * REQUIRE(x >= 0 && x < getWidth() && y >= 0 && y < getHeight(), "Pixel must be in the image")
+     */
+    void setPixel(int x, int y, unsigned char red, unsigned char green, unsigned char blue);
+
+    /**
+     * \brief Get the red, green or blue of a pixel, x = 0 is the left column and y = 0 the top row
+     *
+     * @param channel 0 for red, 1 for green and 2 for blue
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Image object must be properly initialized")
+     * REQUIRE(x >= 0 && x < getWidth() && y >= 0 && y < getHeight(), "Pixel must be in the image")
+     * REQUIRE(channel >= 0 && channel < 3, "Channel must be red, green or blue")
+     */
+    unsigned char getPixel(int x, int y, int channel) const;
+
+    /**
+     * \brief Write the Image as a 24 bit .bmp file
+     *
+     * @param stream Output-stream, opened in binary mode
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Image object must be properly initialized")
+     */
+    void writeBmp(std::ostream &stream) const;
+
+    /**
+     * \brief Write the Image to a 24 bit .bmp file
+     *
+     * @param path Path of the .bmp file
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Image object must be properly initialized")
+     *
+     * @return true when the file is written, false when it can't be written
+     */
+    bool writeBmp(const std::string &path) const;
+};
+
+#endif //VACCINDISTRIBUTOR_IMAGE_H
@@ -0,0 +1,225 @@
+/**
+ * @file Journal.cpp
+ * @brief This file contains the definitions of the members of the Journal class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "Journal.h"
+#include "VaccinationCenter.h"
+#include "Vaccin.h"
+#include "CenterTable.h"
+
+Journal::Journal() {
+
+    fday = NULL;
+    pthread_mutex_init(&fmutex, NULL);
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(!isRecording(), "Journal must not be recording");
+}
+
+Journal::~Journal() {
+
+    REQUIRE(properlyInitialized(), "Journal must be properly initialized");
+    delete fday;
+    pthread_mutex_destroy(&fmutex);
+}
+
+bool Journal::properlyInitialized() const {
+
+    return Journal::_initCheck == this;
+}
+
+bool Journal::isRecording() const {
+
+    REQUIRE(properlyInitialized(), "Journal must be properly initialized");
+    return fday != NULL;
+}
+
+void Journal::startDay(int iter, const std::map<int, int> &dayVaccinated) {
+
+    REQUIRE(properlyInitialized(), "Journal must be properly initialized");
+    REQUIRE(!isRecording(), "Journal is already recording");
+
+    fday = new Day();
+    fday->iter = iter;
+    std::map<int, int>::const_iterator it = dayVaccinated.find(iter);
+    fday->dayVaccinatedExisted = it != dayVaccinated.end();
+    fday->dayVaccinated = fday->dayVaccinatedExisted ? it->second : 0;
+
+    ENSURE(isRecording(), "Journal must be recording");
+}
+
+Journal::Day *Journal::endDay() {
+
+    REQUIRE(properlyInitialized(), "Journal must be properly initialized");
+    REQUIRE(isRecording(), "Journal must be recording");
+
+    Day *day = fday;
+    fday = NULL;
+
+    ENSURE(!isRecording(), "Journal must not be recording");
+    return day;
+}
+
+void Journal::addChange(const Journal::Change &change) {
+
+    REQUIRE(isRecording(), "Journal must be recording");
+    pthread_mutex_lock(&fmutex);
+    fday->changes.push_back(change);
+    pthread_mutex_unlock(&fmutex);
+}
+
+void Journal::rewind(const Journal::Day *day, std::map<int, int> &dayVaccinated) const {
+
+    REQUIRE(properlyInitialized(), "Journal must be properly initialized");
+    REQUIRE(!isRecording(), "Journal must not be recording");
+    REQUIRE(day != NULL, "Day must exist");
+
+    for (std::vector<Change>::const_reverse_iterator it = day->changes.rbegin(); it != day->changes.rend(); it++) {
+
+        switch (it->type) {
+
+            case CenterVaccinated:
+                it->center->setVaccinated(it->value);
+                break;
+
+            case VaccinAmount:
+                it->vaccinCenter->setVaccinAmount(it->value);
+                break;
+
+            case TrackerEntry: {
+                VaccinInCenter *vaccin = it->vaccinCenter;
+                if (it->key == 0) {
+                    vaccin->frequiredDay = it->value;
+                    vaccin->frequiredDaySet = it->existed;
+                }
+                else {
+                    vaccin->ringDay(it->key) = it->value;
+                }
+                vaccin->setBacklog(it->value2);
+                break;
+            }
+
+            case TrackerShift: {
+                // Move the circular buffer back, the place of day -renewal becomes day -1 again
+                VaccinInCenter *vaccin = it->vaccinCenter;
+                if (!vaccin->fring.empty()) {
+                    vaccin->fringStart = (vaccin->fringStart + 1) % vaccin->fvaccinRenewal;
+                    vaccin->ringDay(-1) = it->value2;
+                }
+                vaccin->frequiredDay = it->value;
+                vaccin->frequiredDaySet = it->existed;
+                break;
+            }
+
+            case VaccinAdded:
+                it->center->eraseVaccinType(it->vaccinCenter);
+                delete it->vaccinCenter;
+                break;
+
+            case HubVaccin:
+                it->vaccinHub->setVaccinAmount(it->value);
+                it->vaccinHub->fdelivered = it->value2;
+                break;
+        }
+    }
+
+    if (day->dayVaccinatedExisted) {
+        dayVaccinated[day->iter] = day->dayVaccinated;
+    }
+    else {
+        dayVaccinated.erase(day->iter);
+    }
+}
+
+void Journal::recordCenterVaccinated(VaccinationCenter *center) {
+
+    REQUIRE(properlyInitialized(), "Journal must be properly initialized");
+    if (!isRecording()) {
+        return;
+    }
+
+    Change change = Change();
+    change.type = CenterVaccinated;
+    change.center = center;
+    change.value = center->getVaccinated();
+    addChange(change);
+}
+
+void Journal::recordVaccinAdded(VaccinationCenter *center, VaccinInCenter *vaccin) {
+
+    REQUIRE(properlyInitialized(), "Journal must be properly initialized");
+    if (!isRecording()) {
+        return;
+    }
+
+    Change change = Change();
+    change.type = VaccinAdded;
+    change.center = center;
+    change.vaccinCenter = vaccin;
+    addChange(change);
+}
+
+void Journal::recordVaccinAmount(VaccinInCenter *vaccin) {
+
+    REQUIRE(properlyInitialized(), "Journal must be properly initialized");
+    if (!isRecording()) {
+        return;
+    }
+
+    Change change = Change();
+    change.type = VaccinAmount;
+    change.vaccinCenter = vaccin;
+    change.value = vaccin->getVaccin();
+    addChange(change);
+}
+
+void Journal::recordTrackerEntry(VaccinInCenter *vaccin, int day) {
+
+    REQUIRE(properlyInitialized(), "Journal must be properly initialized");
+    if (!isRecording()) {
+        return;
+    }
+
+    Change change = Change();
+    change.type = TrackerEntry;
+    change.vaccinCenter = vaccin;
+    change.key = day;
+    change.value = day == 0 ? vaccin->frequiredDay : vaccin->ringDay(day);
+    change.value2 = vaccin->totalFirstVaccination();
+    change.existed = vaccin->frequiredDaySet;
+    addChange(change);
+}
+
+void Journal::recordTrackerShift(VaccinInCenter *vaccin) {
+
+    REQUIRE(properlyInitialized(), "Journal must be properly initialized");
+    if (!isRecording()) {
+        return;
+    }
+
+    Change change = Change();
+    change.type = TrackerShift;
+    change.vaccinCenter = vaccin;
+    change.value = vaccin->frequiredDay;
+    change.existed = vaccin->frequiredDaySet;
+    change.value2 = vaccin->fring.empty() ? 0 : vaccin->ringDay(-1);
+    addChange(change);
+}
+
+void Journal::recordHubVaccin(VaccinInHub *vaccin) {
+
+    REQUIRE(properlyInitialized(), "Journal must be properly initialized");
+    if (!isRecording()) {
+        return;
+    }
+
+    Change change = Change();
+    change.type = HubVaccin;
+    change.vaccinHub = vaccin;
+    change.value = vaccin->fvaccinAmount;
+    change.value2 = vaccin->fdelivered;
+    addChange(change);
+}
@@ -0,0 +1,226 @@
+/**
+ * @file Journal.h
+ * @brief This header file contains the declarations and the members of the Journal class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_JOURNAL_H
+#define VACCINDISTRIBUTOR_JOURNAL_H
+
+#include <map>
+#include <vector>
+#include <pthread.h>
+#include "DesignByContract.h"
+
+class VaccinationCenter;
+class VaccinInCenter;
+class VaccinInHub;
+
+/**
+ * \brief Class implemented to record the changes of a simulated day, so the day can be undone
+ *
+ * Instead of copying the whole Simulation every day, the objects of the Simulation report the old value of every
+ * counter just before they change it. Undoing a day puts the old values back in reverse order.
+ * Changes may be recorded from several threads at the same time, as long as each thread changes different objects.
+ */
+class Journal {
+
+public:
+    /**
+     * \brief Kind of change that is recorded
+     */
+    enum ChangeType {
+        CenterVaccinated,   ///< Amount of vaccinated people of a VaccinationCenter
+        VaccinAmount,       ///< Amount of vaccins of a VaccinInCenter
+        TrackerEntry,       ///< One entry (day, amount) of the renewal tracker of a VaccinInCenter
+        TrackerShift,       ///< The renewal tracker of a VaccinInCenter was moved one day
+        VaccinAdded,        ///< A new VaccinInCenter was added to a VaccinationCenter
+        HubVaccin           ///< Stock and delivered amount of a VaccinInHub
+    };
+
+    /**
+     * \brief Old value of one changed counter
+     */
+    struct Change {
+        ChangeType type; ///< Kind of change
+        VaccinationCenter *center; ///< Changed VaccinationCenter (CenterVaccinated, VaccinAdded)
+        VaccinInCenter *vaccinCenter; ///< Changed VaccinInCenter (VaccinAmount, TrackerEntry, TrackerShift, VaccinAdded)
+        VaccinInHub *vaccinHub; ///< Changed VaccinInHub (HubVaccin)
+        int key; ///< Day in the renewal tracker (TrackerEntry)
+        int value; ///< Old value
+        int value2; ///< Second old value (delivered amount for HubVaccin, total for TrackerEntry, day -1 for TrackerShift)
+        bool existed; ///< Day 0 of the tracker was used (TrackerEntry, TrackerShift)
+    };
+
+    /**
+     * \brief All changes of one simulated day
+     */
+    struct Day {
+        int iter; ///< Iteration of the Simulation at the start of the day
+        bool dayVaccinatedExisted; ///< Day/vaccinated data of iter existed at the start of the day
+        int dayVaccinated; ///< Old day/vaccinated data of iter
+        std::vector<Change> changes; ///< Changes in the order they were made
+    };
+
+private:
+    Day *fday; ///< Day that is being recorded, NULL when nothing is recorded
+    pthread_mutex_t fmutex; ///< Protects the changes of the recorded day
+    Journal *_initCheck;
+
+    /**
+     * \brief Add a change to the recorded day
+     *
+     * @param change Change to be added
+     *
+     * @pre
+     * REQUIRE(isRecording(), "Journal must be recording")
+     */
+    void addChange(const Change &change);
+
+public:
+    /**
+     * \brief Default constructor for a Journal object
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(!isRecording(), "Journal must not be recording")
+     */
+    Journal();
+
+    /**
+     * \brief Deconstructor for a Journal object, deletes the day that is being recorded
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Journal must be properly initialized")
+     */
+    ~Journal();
+
+    /**
+     * \brief Check whether the Journal object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Check whether the Journal is recording a day
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Journal must be properly initialized")
+     *
+     * @return true when changes are recorded
+     */
+    bool isRecording() const;
+
+    /**
+     * \brief Start recording a new day
+     *
+     * @param iter Iteration of the Simulation at the start of the day
+     * @param dayVaccinated Day/vaccinated data of the Simulation at the start of the day
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Journal must be properly initialized")
+     * REQUIRE(!isRecording(), "Journal is already recording")
+     *
+     * @post
+     * ENSURE(isRecording(), "Journal must be recording")
+     */
+    void startDay(int iter, const std::map<int, int> &dayVaccinated);
+
+    /**
+     * \brief Stop recording and give the recorded day, the caller becomes owner of the day
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Journal must be properly initialized")
+     * REQUIRE(isRecording(), "Journal must be recording")
+     *
+     * @post
+     * ENSURE(!isRecording(), "Journal must not be recording")
+     *
+     * @return Recorded day
+     */
+    Day *endDay();
+
+    /**
+     * \brief Undo all changes of a day in reverse order
+     *
+     * @param day Recorded day, must be the last day that was recorded and not yet undone
+     * @param dayVaccinated Day/vaccinated data of the Simulation to restore
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Journal must be properly initialized")
+     * REQUIRE(!isRecording(), "Journal must not be recording")
+     * REQUIRE(day != NULL, "Day must exist")
+     */
+    void rewind(const Day *day, std::map<int, int> &dayVaccinated) const;
+
+    /**
+     * \brief Record the amount of vaccinated people of a VaccinationCenter before it changes, nothing is recorded when the Journal is not recording
+     *
+     * @param center Pointer to VaccinationCenter object
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Journal must be properly initialized")
+     */
+    void recordCenterVaccinated(VaccinationCenter *center);
+
+    /**
+     * \brief Record that a new VaccinInCenter was added to a VaccinationCenter, nothing is recorded when the Journal
+     * is not recording
+     *
+     * @param center Pointer to VaccinationCenter object
+     * @param vaccin Pointer to the added VaccinInCenter object
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Journal must be properly initialized")
+     */
+    void recordVaccinAdded(VaccinationCenter *center, VaccinInCenter *vaccin);
+
+    /**
+     * \brief Record the amount of vaccins of a VaccinInCenter before it changes, nothing is recorded when the Journal
+     * is not recording
+     *
+     * @param vaccin Pointer to VaccinInCenter object
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Journal must be properly initialized")
+     */
+    void recordVaccinAmount(VaccinInCenter *vaccin);
+
+    /**
+     * \brief Record one entry of the renewal tracker of a VaccinInCenter before it changes, nothing is recorded when
+     * the Journal is not recording
+     *
+     * @param vaccin Pointer to VaccinInCenter object
+     * @param day Day of the entry in the tracker
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Journal must be properly initialized")
+     */
+    void recordTrackerEntry(VaccinInCenter *vaccin, int day);
+
+    /**
+     * \brief Record the renewal tracker of a VaccinInCenter before it moves one day, nothing is recorded when the
+     * Journal is not recording
+     *
+     * @param vaccin Pointer to VaccinInCenter object
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Journal must be properly initialized")
+     */
+    void recordTrackerShift(VaccinInCenter *vaccin);
+
+    /**
+     * \brief Record the stock and delivered amount of a VaccinInHub before they change, nothing is recorded when the
+     * Journal is not recording
+     *
+     * @param vaccin Pointer to VaccinInHub object
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Journal must be properly initialized")
+     */
+    void recordHubVaccin(VaccinInHub *vaccin);
+};
+
+#endif //VACCINDISTRIBUTOR_JOURNAL_H
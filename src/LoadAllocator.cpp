@@ -0,0 +1,241 @@
+/**
+ * @file LoadAllocator.cpp
+ * @brief This file contains the definitions of the members of the LoadAllocator class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "LoadAllocator.h"
+#include <algorithm>
+#include "CenterHeap.h"
+
+/**
+ * \brief Middle load of the loads of a candidate that are left in the search of the last load
+ */
+struct MiddleLoad {
+    double ratio;
+    int candidate;
+    int load;
+    int weight; ///< Loads of the candidate that are left
+};
+
+/**
+ * \brief Orders middle loads on the order they are given, loads of different candidates
+ */
+static bool givenBefore(const MiddleLoad &a, const MiddleLoad &b) {
+
+    if (a.ratio != b.ratio) {
+        return a.ratio < b.ratio;
+    }
+    return a.candidate > b.candidate;
+}
+
+LoadAllocator::LoadAllocator() : fstopped(-1), ftransport(1) {
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(getCandidates().empty(), "Candidates must be empty");
+}
+
+bool LoadAllocator::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+double LoadAllocator::ratio(int candidate, int load) const {
+
+    // The same value as the ratio of the center after the loads, so both modes compare the same numbers
+    const Candidate &c = fcandidates[candidate];
+    return ((double)(c.filled) + (double)(load) * (double)(ftransport)) / (double)(c.population);
+}
+
+bool LoadAllocator::before(int candidate, int load, int otherCandidate, int otherLoad) const {
+
+    if (candidate == otherCandidate) {
+        return load < otherLoad;
+    }
+    double a = ratio(candidate, load);
+    double b = ratio(otherCandidate, otherLoad);
+    if (a != b) {
+        return a < b;
+    }
+    return candidate > otherCandidate;
+}
+
+int LoadAllocator::countUntil(int candidate, int first, int last, int otherCandidate, int otherLoad) const {
+
+    int low = first;
+    int high = last;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (before(otherCandidate, otherLoad, candidate, middle)) {
+            high = middle;
+        }
+        else {
+            low = middle + 1;
+        }
+    }
+    return low - first;
+}
+
+void LoadAllocator::add(const Candidate &candidate) {
+
+    REQUIRE(properlyInitialized(), "LoadAllocator must be properly initialized");
+    REQUIRE(candidate.population > 0, "Population must be positive");
+    REQUIRE(candidate.loads > 0, "Candidate must be able to store a load");
+    fcandidates.push_back(candidate);
+}
+
+const std::vector<LoadAllocator::Candidate> &LoadAllocator::getCandidates() const {
+
+    REQUIRE(properlyInitialized(), "LoadAllocator must be properly initialized");
+    return fcandidates;
+}
+
+void LoadAllocator::allocate(int loads, int transport, Mode mode) {
+
+    REQUIRE(properlyInitialized(), "LoadAllocator must be properly initialized");
+    REQUIRE(loads >= 0, "Loads can't be negative");
+    REQUIRE(transport > 0, "Transport must be positive");
+
+    ftransport = transport;
+    fstopped = -1;
+    floads.assign(fcandidates.size(), 0);
+    if (mode == kSequential) {
+        allocateSequential(loads);
+    }
+    else {
+        allocateWaterFilling(loads);
+    }
+
+    ENSURE(getLoads().size() == getCandidates().size(), "Every candidate must have its loads");
+}
+
+void LoadAllocator::allocateSequential(int loads) {
+
+    CenterHeap heap;
+    for (unsigned int i = 0; i < fcandidates.size(); i++) {
+        heap.push(i, fcandidates[i].center, ratio(i, 0));
+    }
+    for (int load = 0; load < loads && !heap.empty(); load++) {
+        int candidate = heap.topOrder();
+        if (fcandidates[candidate].full) {
+            fstopped = candidate;
+            break;
+        }
+        floads[candidate]++;
+        if (floads[candidate] < fcandidates[candidate].loads) {
+            heap.update(candidate, ratio(candidate, floads[candidate]));
+        }
+        else {
+            heap.remove(candidate);
+        }
+    }
+}
+
+void LoadAllocator::allocateWaterFilling(int loads) {
+
+    int candidates = static_cast<int>(fcandidates.size());
+
+    // Only the loads before the first load of a full candidate can be given
+    int stop = -1;
+    for (int i = 0; i < candidates; i++) {
+        if (fcandidates[i].full && (stop == -1 || before(i, 0, stop, 0))) {
+            stop = i;
+        }
+    }
+    if (stop != -1) {
+        int given = -1;
+        for (int i = 0; i < candidates; i++) {
+            given += countUntil(i, 0, fcandidates[i].loads, stop, 0);
+        }
+        if (given < loads) {
+            loads = given;
+            fstopped = stop;
+        }
+    }
+    long long total = 0;
+    for (int i = 0; i < candidates; i++) {
+        total += fcandidates[i].loads;
+    }
+    if (total < loads) {
+        loads = static_cast<int>(total);
+    }
+    if (loads == 0) {
+        return;
+    }
+
+    // Search the last load that is given, the loads of every candidate between first and last are left. The middle
+    // load with the weighted median of the left loads takes at least a quarter of them out of the search.
+    std::vector<int> first(candidates, 0);
+    std::vector<int> last(candidates);
+    for (int i = 0; i < candidates; i++) {
+        last[i] = fcandidates[i].loads;
+    }
+    int needed = loads;
+    int lastCandidate = -1;
+    int lastLoad = -1;
+    std::vector<MiddleLoad> middles;
+    std::vector<int> counts(candidates);
+    while (lastCandidate == -1) {
+        middles.clear();
+        long long weights = 0;
+        for (int i = 0; i < candidates; i++) {
+            if (first[i] < last[i]) {
+                MiddleLoad middle;
+                middle.candidate = i;
+                middle.load = first[i] + (last[i] - first[i]) / 2;
+                middle.ratio = ratio(i, middle.load);
+                middle.weight = last[i] - first[i];
+                middles.push_back(middle);
+                weights += middle.weight;
+            }
+        }
+        std::sort(middles.begin(), middles.end(), givenBefore);
+        std::vector<MiddleLoad>::const_iterator pivot = middles.begin();
+        long long weight = pivot->weight;
+        while (2 * weight < weights) {
+            pivot++;
+            weight += pivot->weight;
+        }
+
+        int counted = 0;
+        for (int i = 0; i < candidates; i++) {
+            counts[i] = countUntil(i, first[i], last[i], pivot->candidate, pivot->load);
+            counted += counts[i];
+        }
+        if (counted == needed) {
+            lastCandidate = pivot->candidate;
+            lastLoad = pivot->load;
+        }
+        else if (counted > needed) {
+            // The pivot is the last of the counted loads and is given after the last load
+            for (int i = 0; i < candidates; i++) {
+                last[i] = first[i] + counts[i];
+            }
+            last[pivot->candidate]--;
+        }
+        else {
+            needed -= counted;
+            for (int i = 0; i < candidates; i++) {
+                first[i] += counts[i];
+            }
+        }
+    }
+
+    for (int i = 0; i < candidates; i++) {
+        floads[i] = countUntil(i, 0, fcandidates[i].loads, lastCandidate, lastLoad);
+    }
+}
+
+const std::vector<int> &LoadAllocator::getLoads() const {
+
+    REQUIRE(properlyInitialized(), "LoadAllocator must be properly initialized");
+    return floads;
+}
+
+int LoadAllocator::getStopped() const {
+
+    REQUIRE(properlyInitialized(), "LoadAllocator must be properly initialized");
+    return fstopped;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file LoadAllocator.h
+ * @brief This header file contains the declarations and the members of the LoadAllocator class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_LOADALLOCATOR_H
+#define VACCINDISTRIBUTOR_LOADALLOCATOR_H
+
+#include <vector>
+#include "DesignByContract.h"
+
+class VaccinationCenter;
+
+/**
+ * \brief Class implemented to divide the loads of a Vaccin over the VaccinationCenters of a Hub
+ *
+ * Every load goes to the candidate with the smallest ratio of vaccinated people and vaccins to its population, when
+ * ratios are equal to the candidate that was added last. A load raises the ratio of its candidate, so the loads of one
+ * candidate have increasing ratios. Giving the loads one at a time, the way Hub::distributeVaccinsFair always did,
+ * takes every load from the top of a CenterHeap. Water-filling gives the same loads in one pass: the loads that are
+ * given are the smallest loads of all candidates, so it finds the ratio of the last load and gives every candidate
+ * the loads up to that ratio. The distribution stops before the first load of a full candidate, a center where every
+ * person is vaccinated or waiting for a second shot.
+ */
+class LoadAllocator {
+
+public:
+    /**
+     * \brief Way the loads are divided, both modes give the same loads
+     */
+    enum Mode {
+        kWaterFilling = 0, ///< All loads of every candidate at once, the amount of work doesn't depend on the loads
+        kSequential = 1 ///< One load at a time from a CenterHeap, the order of older versions
+    };
+
+    /**
+     * \brief VaccinationCenter that can get loads
+     */
+    struct Candidate {
+        VaccinationCenter *center;
+        int filled; ///< Vaccinated people and vaccins of the center before the first load
+        int population;
+        int loads; ///< Loads the center can store, at least 1
+        bool full; ///< The distribution stops when the center would get the next load
+    };
+
+private:
+    std::vector<Candidate> fcandidates;
+    std::vector<int> floads; ///< Loads of every candidate after allocate()
+    int fstopped; ///< Candidate that stopped the distribution, -1 when none did
+    int ftransport; ///< Vaccins in a load
+    LoadAllocator *_initCheck;
+
+    /**
+     * \brief Get the ratio of a candidate when it gets its load with the given index, index 0 is its first load
+     */
+    double ratio(int candidate, int load) const;
+
+    /**
+     * \brief Check whether a load of a candidate is given before a load of another candidate
+     */
+    bool before(int candidate, int load, int otherCandidate, int otherLoad) const;
+
+    /**
+     * \brief Get the amount of loads of a candidate, between first and last, that are given before a load or are
+     *        the load itself
+     */
+    int countUntil(int candidate, int first, int last, int otherCandidate, int otherLoad) const;
+
+    void allocateWaterFilling(int loads);
+
+    void allocateSequential(int loads);
+
+public:
+    /**
+     * \brief Default constructor for a LoadAllocator object
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(getCandidates().empty(), "Candidates must be empty")
+     */
+    LoadAllocator();
+
+    /**
+     * \brief Check whether the LoadAllocator object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Add a candidate, candidates are added in the order of the centra of the Hub
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "LoadAllocator must be properly initialized")
+     * REQUIRE(candidate.population > 0, "Population must be positive")
+     * REQUIRE(candidate.loads > 0, "Candidate must be able to store a load")
+     */
+    void add(const Candidate &candidate);
+
+    /**
+     * \brief Get the candidates in the order they were added
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "LoadAllocator must be properly initialized")
+     */
+    const std::vector<Candidate> &getCandidates() const;
+
+    /**
+     * \brief Divide loads over the candidates, less loads are given when the candidates can't store them or when a
+     *        full candidate stops the distribution
+     *
+     * @param loads Maximum amount of loads
+     * @param transport Vaccins in a load
+     * @param mode Way the loads are divided
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "LoadAllocator must be properly initialized")
+     * REQUIRE(loads >= 0, "Loads can't be negative")
+     * REQUIRE(transport > 0, "Transport must be positive")
+     *
+     * @post
+     * ENSURE(getLoads().size() == getCandidates().size(), "Every candidate must have its loads")
+     */
+    void allocate(int loads, int transport, Mode mode);
+
+    /**
+     * \brief Get the loads of every candidate given by allocate(), in the order of the candidates
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "LoadAllocator must be properly initialized")
+     */
+    const std::vector<int> &getLoads() const;
+
+    /**
+     * \brief Get the candidate that stopped the distribution in allocate()
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "LoadAllocator must be properly initialized")
+     *
+     * @return Index of the candidate, -1 when the distribution wasn't stopped by a full candidate
+     */
+    int getStopped() const;
+};
+
+#endif //VACCINDISTRIBUTOR_LOADALLOCATOR_H
@@ -25,7 +25,7 @@
 //        s.simulate();
 //        s.simulate();
 //        s.simulate();
-//        s.clearSimulation(true);
+//        s.clearSimulation();
 //        std::cout << s.getUndoStack().size() << std::endl;
 
 //        // TODO - bool undoSimulation()
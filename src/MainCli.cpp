@@ -0,0 +1,263 @@
+/**
+ * @file MainCli.cpp
+ * @brief This file is used to run the system from the command line, without the graphical interface
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <unistd.h>
+#include "Simulation.h"
+
+/**
+ * \brief Print the usage of the command line runner
+ *
+ * @param stream Output stream
+ * @param program Name of the executable
+ */
+static void printUsage(std::ostream &stream, const char *program) {
+
+    stream << "Usage: " << program << " [options] <simulation.xml|snapshot> <days>\n";
+    stream << "Simulates until day <days>, a snapshot continues on the day it was written\n";
+    stream << "Options:\n";
+    stream << "  -t <knownTags.xml>  Check the simulation file against a file with the known tags\n";
+    stream << "  -o <output.txt>     Write the simulation output to a file instead of stdout\n";
+    stream << "  -e                  Export a Day-<n>.txt file with data every day\n";
+    stream << "  -i                  Export a Day-<n>.ini file every day\n";
+    stream << "  -b                  Export a Day-<n>.bmp file every day, drawn without the engine\n";
+    stream << "  -a <archive>        Write the files of -e, -i and -b to one archive instead of Day-<n> files\n";
+    stream << "  -q                  Do not write the simulation output\n";
+    stream << "  -c <events.csv>     Write the events of every day to a .csv file\n";
+    stream << "  -g <events.log>     Write the events of every day to a binary log\n";
+    stream << "  -v <level>          Events that are written: movements (deliveries, transports and vaccinations)\n";
+    stream << "                      or stock (also the stock of every center, default)\n";
+    stream << "  -j <threads>        Amount of threads used to simulate (default: all cores)\n";
+    stream << "  -s <snapshot>       Write a snapshot of the simulation after the last day\n";
+    stream << "  -l                  Give the loads of the hubs to the centra one at a time, like older versions\n";
+    stream << "  -h                  Show this message\n";
+}
+
+int main(int argc, char *argv[]) {
+
+    const char *knownTags = "";
+    const char *outputPath = NULL;
+    bool exportFlag = false;
+    bool ini = false;
+    bool bmp = false;
+    bool quiet = false;
+    const char *threadsString = NULL;
+    const char *snapshotPath = NULL;
+    const char *archivePath = NULL;
+    const char *csvPath = NULL;
+    const char *logPath = NULL;
+    const char *levelString = NULL;
+    bool sequential = false;
+
+    int option;
+    while ((option = getopt(argc, argv, "t:o:eiba:qc:g:v:j:s:lh")) != -1) {
+        switch (option) {
+            case 't':
+                knownTags = optarg;
+                break;
+            case 'o':
+                outputPath = optarg;
+                break;
+            case 'e':
+                exportFlag = true;
+                break;
+            case 'i':
+                ini = true;
+                break;
+            case 'b':
+                bmp = true;
+                break;
+            case 'a':
+                archivePath = optarg;
+                break;
+            case 'q':
+                quiet = true;
+                break;
+            case 'c':
+                csvPath = optarg;
+                break;
+            case 'g':
+                logPath = optarg;
+                break;
+            case 'v':
+                levelString = optarg;
+                break;
+            case 'j':
+                threadsString = optarg;
+                break;
+            case 's':
+                snapshotPath = optarg;
+                break;
+            case 'l':
+                sequential = true;
+                break;
+            case 'h':
+                printUsage(std::cout, argv[0]);
+                return 0;
+            default:
+                printUsage(std::cerr, argv[0]);
+                return 1;
+        }
+    }
+
+    if (argc - optind != 2) {
+        printUsage(std::cerr, argv[0]);
+        return 1;
+    }
+
+    const char *path = argv[optind];
+    std::string daysString = argv[optind + 1];
+    int days;
+    try {
+        days = ToInt(daysString);
+    }
+    catch (Exception ex) {
+        std::cerr << "Invalid amount of days: " << daysString << std::endl;
+        return 1;
+    }
+    if (days < 0) {
+        std::cerr << "Invalid amount of days: " << daysString << std::endl;
+        return 1;
+    }
+    int threads = 0;
+    if (threadsString != NULL) {
+        std::string threadsValue = threadsString;
+        try {
+            threads = ToInt(threadsValue);
+        }
+        catch (Exception ex) {
+            threads = 0;
+        }
+        if (threads < 1) {
+            std::cerr << "Invalid amount of threads: " << threadsValue << std::endl;
+            return 1;
+        }
+    }
+    EventSink::Level level = EventSink::kStock;
+    if (levelString != NULL) {
+        std::string levelValue = levelString;
+        if (levelValue == "movements") {
+            level = EventSink::kMovements;
+        }
+        else if (levelValue != "stock") {
+            std::cerr << "Invalid level: " << levelValue << std::endl;
+            return 1;
+        }
+    }
+    if (!FileExists(path) || FileIsEmpty(path)) {
+        std::cerr << "Could not open file: " << path << std::endl;
+        return 1;
+    }
+
+    // The events of the simulation go to every sink that is asked for, without sinks no text is formatted
+    std::ofstream outputFile;
+    std::ostream *stream = &std::cout;
+    if (!quiet && outputPath != NULL) {
+        outputFile.open(outputPath);
+        if (!outputFile.is_open()) {
+            std::cerr << "Could not open output file: " << outputPath << std::endl;
+            return 1;
+        }
+        stream = &outputFile;
+    }
+    std::ofstream csvFile;
+    if (csvPath != NULL) {
+        csvFile.open(csvPath);
+        if (!csvFile.is_open()) {
+            std::cerr << "Could not open output file: " << csvPath << std::endl;
+            return 1;
+        }
+    }
+    std::ofstream logFile;
+    if (logPath != NULL) {
+        logFile.open(logPath, std::ios::out | std::ios::binary);
+        if (!logFile.is_open()) {
+            std::cerr << "Could not open output file: " << logPath << std::endl;
+            return 1;
+        }
+    }
+
+    Simulation s;
+    if (threads > 0) {
+        s.setThreads(threads);
+    }
+    if (sequential) {
+        s.setAllocation(LoadAllocator::kSequential);
+    }
+    bool snapshot = Snapshot::isSnapshot(path);
+    if (snapshot && knownTags[0] != '\0') {
+        std::cerr << "Known tags can only be checked in a simulation file" << std::endl;
+        return 1;
+    }
+    try {
+        if (snapshot) {
+            s.loadSnapshot(path);
+        }
+        else {
+            s.importXmlFile(path, knownTags, std::cerr);
+        }
+    }
+    catch (Exception ex) {
+        std::cerr << ex.value() << std::endl;
+        return 2;
+    }
+
+    TextSink textSink(*stream);
+    CsvSink *csvSink = csvFile.is_open() ? new CsvSink(csvFile) : NULL;
+    BinarySink *logSink = logFile.is_open() ? new BinarySink(logFile) : NULL;
+    TeeSink sink;
+    sink.setLevel(level);
+    if (!quiet) {
+        sink.add(&textSink);
+    }
+    if (csvSink != NULL) {
+        sink.add(csvSink);
+    }
+    if (logSink != NULL) {
+        sink.add(logSink);
+    }
+
+    // A simulation that is continued from a snapshot adds its days to the archive
+    DayArchive archive;
+    try {
+        if (archivePath != NULL) {
+            archive.open(archivePath, !snapshot);
+        }
+        s.automaticSimulation(days, sink, exportFlag, ini, bmp, archive.isOpen() ? &archive : NULL);
+        archive.close();
+    }
+    catch (Exception ex) {
+        std::cerr << ex.value() << std::endl;
+        delete csvSink;
+        delete logSink;
+        return 2;
+    }
+    delete csvSink;
+    delete logSink;
+    stream->flush();
+    if ((csvFile.is_open() && !csvFile.flush()) || (logFile.is_open() && !logFile.flush())) {
+        std::cerr << "Could not write the events" << std::endl;
+        return 2;
+    }
+
+    if (snapshotPath != NULL) {
+        try {
+            s.saveSnapshot(snapshotPath);
+        }
+        catch (Exception ex) {
+            std::cerr << ex.value() << std::endl;
+            return 2;
+        }
+    }
+
+    if (outputFile.is_open()) {
+        outputFile.close();
+    }
+    return 0;
+}
@@ -0,0 +1,208 @@
+/**
+ * @file MainGenerator.cpp
+ * @brief This file is used to write generated simulation files from the command line
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <unistd.h>
+#include "ScenarioGenerator.h"
+#include "Utils.h"
+
+/**
+ * \brief Print the usage of the generator
+ *
+ * @param stream Output stream
+ * @param program Name of the executable
+ */
+static void printUsage(std::ostream &stream, const char *program) {
+
+    stream << "Usage: " << program << " [options]\n";
+    stream << "Options:\n";
+    stream << "  -s <seed>                  Seed of the generated values (default: 1)\n";
+    stream << "  -n <hubs>,<centra>         Amount of hubs and centra (default: 1,10)\n";
+    stream << "  -v <types>,<perHub>        Amount of vaccin types and types delivered to each hub (default: 3,3)\n";
+    stream << "  -m <frozen>,<cooled>       Percent of vaccin types under zero and above zero with renewal,\n";
+    stream << "                             the rest has no renewal (default: 40,30)\n";
+    stream << "  -f <fanOut>                Amount of hubs that supply each center (default: 1)\n";
+    stream << "  -p <min>,<max>             Range of the population of a center (default: 10000,500000)\n";
+    stream << "  -k                         Many small and a few large populations instead of uniform\n";
+    stream << "  -c <min>,<max>             Range of the capacity of a center in per mille of its population\n";
+    stream << "                             (default: 10,40)\n";
+    stream << "  -o <output.xml>            Write the simulation to a file instead of stdout\n";
+    stream << "  -h                         Show this message\n";
+}
+
+/**
+ * \brief Read a list of positive integers separated by commas
+ *
+ * @param value String with the integers
+ * @param count Amount of integers in the list
+ * @param values Vector the integers are written to
+ *
+ * @return true when the list has count positive integers, false when not
+ */
+static bool readIntegers(const std::string &value, unsigned int count, std::vector<int> &values) {
+
+    values.clear();
+    std::stringstream stream(value);
+    std::string part;
+    while (std::getline(stream, part, ',')) {
+        if (part.empty() || part[0] == '-') {
+            return false;
+        }
+        try {
+            values.push_back(ToInt(part));
+        }
+        catch (Exception ex) {
+            return false;
+        }
+    }
+    return values.size() == count;
+}
+
+/**
+ * \brief Read the value of an option, the default values are kept when the option is not given
+ *
+ * @param name Description of the option used in the error message
+ * @param value Value of the option, NULL when the option is not given
+ * @param count Amount of integers in the value
+ * @param values Vector with the default integers, the integers of the value are written to it
+ *
+ * @return true when the option is not given or has count positive integers, false when not
+ */
+static bool readOption(const char *name, const char *value, unsigned int count, std::vector<int> &values) {
+
+    if (value == NULL) {
+        return true;
+    }
+    if (!readIntegers(value, count, values)) {
+        std::cerr << "Invalid " << name << ": " << value << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+
+    const char *seedString = NULL;
+    const char *sizeString = NULL;
+    const char *typesString = NULL;
+    const char *mixString = NULL;
+    const char *fanOutString = NULL;
+    const char *populationString = NULL;
+    const char *capacityString = NULL;
+    const char *outputPath = NULL;
+    bool skewed = false;
+
+    int option;
+    while ((option = getopt(argc, argv, "s:n:v:m:f:p:c:ko:h")) != -1) {
+        switch (option) {
+            case 's':
+                seedString = optarg;
+                break;
+            case 'n':
+                sizeString = optarg;
+                break;
+            case 'v':
+                typesString = optarg;
+                break;
+            case 'm':
+                mixString = optarg;
+                break;
+            case 'f':
+                fanOutString = optarg;
+                break;
+            case 'p':
+                populationString = optarg;
+                break;
+            case 'c':
+                capacityString = optarg;
+                break;
+            case 'k':
+                skewed = true;
+                break;
+            case 'o':
+                outputPath = optarg;
+                break;
+            case 'h':
+                printUsage(std::cout, argv[0]);
+                return 0;
+            default:
+                printUsage(std::cerr, argv[0]);
+                return 1;
+        }
+    }
+    if (argc != optind) {
+        printUsage(std::cerr, argv[0]);
+        return 1;
+    }
+
+    std::vector<int> seed(1, 1);
+    std::vector<int> size(1, 1);
+    size.push_back(10);
+    std::vector<int> types(2, 3);
+    std::vector<int> mix(1, 40);
+    mix.push_back(30);
+    std::vector<int> fanOut(1, 1);
+    std::vector<int> population(1, 10000);
+    population.push_back(500000);
+    std::vector<int> capacity(1, 10);
+    capacity.push_back(40);
+
+    if (!readOption("seed", seedString, 1, seed) ||
+        !readOption("amount of hubs and centra", sizeString, 2, size) ||
+        !readOption("vaccin types", typesString, 2, types) ||
+        !readOption("mix of vaccin types", mixString, 2, mix) ||
+        !readOption("fan-out", fanOutString, 1, fanOut) ||
+        !readOption("population range", populationString, 2, population) ||
+        !readOption("capacity range", capacityString, 2, capacity)) {
+        return 1;
+    }
+    if (size[0] < 1 || size[1] < 1) {
+        std::cerr << "There must be at least one hub and one center" << std::endl;
+        return 1;
+    }
+    if (types[0] < 1 || types[1] < 1 || types[1] > types[0]) {
+        std::cerr << "Each hub must get at least one and at most all vaccin types" << std::endl;
+        return 1;
+    }
+    if (mix[0] + mix[1] > 100) {
+        std::cerr << "Mix of vaccin types must not be more than 100 percent" << std::endl;
+        return 1;
+    }
+    if (fanOut[0] < 1 || fanOut[0] > size[0]) {
+        std::cerr << "Each center must be supplied by at least one and at most all hubs" << std::endl;
+        return 1;
+    }
+    if (population[0] > population[1] || capacity[0] > capacity[1]) {
+        std::cerr << "Smallest value of a range must not be larger than the largest value" << std::endl;
+        return 1;
+    }
+
+    ScenarioGenerator generator(static_cast<unsigned int>(seed[0]));
+    generator.setSize(size[0], size[1]);
+    generator.setVaccinTypes(types[0], types[1], mix[0], mix[1]);
+    generator.setFanOut(fanOut[0]);
+    generator.setPopulation(population[0], population[1], skewed);
+    generator.setCapacity(capacity[0], capacity[1]);
+
+    if (outputPath == NULL) {
+        generator.generate(std::cout);
+        std::cout.flush();
+        return 0;
+    }
+
+    std::ofstream outputFile(outputPath);
+    if (!outputFile.is_open()) {
+        std::cerr << "Could not open output file: " << outputPath << std::endl;
+        return 1;
+    }
+    generator.generate(outputFile);
+    outputFile.close();
+    return 0;
+}
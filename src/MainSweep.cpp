@@ -0,0 +1,160 @@
+/**
+ * @file MainSweep.cpp
+ * @brief This file is used to simulate many scenarios of one simulation from the command line
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <unistd.h>
+#include "Sweep.h"
+
+/**
+ * \brief Print the usage of the sweep runner
+ *
+ * @param stream Output stream
+ * @param program Name of the executable
+ */
+static void printUsage(std::ostream &stream, const char *program) {
+
+    stream << "Usage: " << program << " [options] <simulation.xml|snapshot> <scenarios.txt> <days>\n";
+    stream << "Simulates every scenario until day <days>, the simulation is imported once\n";
+    stream << "Every line of the scenarios is a name followed by overrides <target>:<name>=<values>, the target is\n";
+    stream << "capacity (of a center), delivery, interval, transport or renewal (of a vaccin), * is every center or\n";
+    stream << "vaccin and several values separated by commas give a scenario for every combination, e.g.\n";
+    stream << "  grid capacity:*=2000,4000 delivery:Pfizer=10000,20000,30000\n";
+    stream << "Options:\n";
+    stream << "  -t <knownTags.xml>  Check the simulation file against a file with the known tags\n";
+    stream << "  -o <results.csv>    Write the results to a file instead of stdout\n";
+    stream << "  -j <threads>        Amount of scenarios simulated at the same time (default: all cores)\n";
+    stream << "  -h                  Show this message\n";
+}
+
+int main(int argc, char *argv[]) {
+
+    const char *knownTags = "";
+    const char *outputPath = NULL;
+    const char *threadsString = NULL;
+
+    int option;
+    while ((option = getopt(argc, argv, "t:o:j:h")) != -1) {
+        switch (option) {
+            case 't':
+                knownTags = optarg;
+                break;
+            case 'o':
+                outputPath = optarg;
+                break;
+            case 'j':
+                threadsString = optarg;
+                break;
+            case 'h':
+                printUsage(std::cout, argv[0]);
+                return 0;
+            default:
+                printUsage(std::cerr, argv[0]);
+                return 1;
+        }
+    }
+
+    if (argc - optind != 3) {
+        printUsage(std::cerr, argv[0]);
+        return 1;
+    }
+
+    const char *path = argv[optind];
+    const char *scenariosPath = argv[optind + 1];
+    std::string daysString = argv[optind + 2];
+    int days;
+    try {
+        days = ToInt(daysString);
+    }
+    catch (Exception ex) {
+        std::cerr << "Invalid amount of days: " << daysString << std::endl;
+        return 1;
+    }
+    if (days < 0) {
+        std::cerr << "Invalid amount of days: " << daysString << std::endl;
+        return 1;
+    }
+    int threads = 0;
+    if (threadsString != NULL) {
+        std::string threadsValue = threadsString;
+        try {
+            threads = ToInt(threadsValue);
+        }
+        catch (Exception ex) {
+            threads = 0;
+        }
+        if (threads < 1) {
+            std::cerr << "Invalid amount of threads: " << threadsValue << std::endl;
+            return 1;
+        }
+    }
+    if (!FileExists(path) || FileIsEmpty(path)) {
+        std::cerr << "Could not open file: " << path << std::endl;
+        return 1;
+    }
+    std::ifstream scenariosFile(scenariosPath);
+    if (!scenariosFile.is_open()) {
+        std::cerr << "Could not open file: " << scenariosPath << std::endl;
+        return 1;
+    }
+
+    Simulation s;
+    bool snapshot = Snapshot::isSnapshot(path);
+    if (snapshot && knownTags[0] != '\0') {
+        std::cerr << "Known tags can only be checked in a simulation file" << std::endl;
+        return 1;
+    }
+    try {
+        if (snapshot) {
+            s.loadSnapshot(path);
+        }
+        else {
+            s.importXmlFile(path, knownTags, std::cerr);
+        }
+    }
+    catch (Exception ex) {
+        std::cerr << ex.value() << std::endl;
+        return 2;
+    }
+
+    Sweep sweep(s);
+    if (threads > 0) {
+        sweep.setThreads(threads);
+    }
+    try {
+        sweep.readScenarios(scenariosFile);
+    }
+    catch (Exception ex) {
+        std::cerr << ex.value() << std::endl;
+        return 1;
+    }
+    sweep.run(days);
+
+    std::ofstream outputFile;
+    std::ostream *stream = &std::cout;
+    if (outputPath != NULL) {
+        outputFile.open(outputPath);
+        if (!outputFile.is_open()) {
+            std::cerr << "Could not open output file: " << outputPath << std::endl;
+            return 1;
+        }
+        stream = &outputFile;
+    }
+    sweep.writeCsv(*stream);
+    stream->flush();
+
+    // Scenarios that can't be simulated are in the results, the exit code tells that one of them failed
+    const std::vector<Sweep::Result> &results = sweep.getResults();
+    for (std::vector<Sweep::Result>::const_iterator it = results.begin(); it != results.end(); it++) {
+        if (!it->error.empty()) {
+            std::cerr << it->name << ": " << it->error << std::endl;
+            return 2;
+        }
+    }
+    return 0;
+}
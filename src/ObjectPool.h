@@ -0,0 +1,238 @@
+/**
+ * @file ObjectPool.h
+ * @brief This header file contains the declaration and the definitions of the ObjectPool class template
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_OBJECTPOOL_H
+#define VACCINDISTRIBUTOR_OBJECTPOOL_H
+
+#include <new>
+#include <map>
+#include <vector>
+#include <cstddef>
+#include "DesignByContract.h"
+
+/**
+ * \brief Class template implemented to own objects of one type in blocks of storage and to destroy them together
+ *
+ * Objects are created with create(...), the storage of kBlockSize objects is allocated at once and the storage of a
+ * destroyed object is used for the next one. Objects of the pool are never deleted, they are destroyed by the
+ * pool with destroy() or all at once with clear().
+ */
+template <class T>
+class ObjectPool {
+
+private:
+    static const int kBlockSize = 64; ///< Objects in a block of storage
+
+    std::vector<char*> fblocks; ///< Storage of kBlockSize objects each
+    std::map<const char*, int> fbases; ///< Index in fblocks of every block by its address
+    std::vector<bool> flive; ///< Whether the storage of every index holds an object
+    std::vector<int> ffree; ///< Indices of the storage that holds no object, the last one is used first
+    int fsize; ///< Amount of objects
+    ObjectPool *_initCheck;
+
+    ObjectPool(const ObjectPool &);
+
+    ObjectPool &operator=(const ObjectPool &);
+
+    T *at(int index) const {
+        return reinterpret_cast<T*>(fblocks[index / kBlockSize] + (index % kBlockSize) * sizeof(T));
+    }
+
+    /**
+     * \brief Get the index of the storage of an object, -1 when it is not storage of the pool
+     */
+    int indexOf(const void *object) const {
+        const char *address = static_cast<const char*>(object);
+        // The block with the last address that isn't after the object
+        std::map<const char*, int>::const_iterator block = fbases.upper_bound(address);
+        if (block == fbases.begin()) {
+            return -1;
+        }
+        block--;
+        std::ptrdiff_t offset = address - block->first;
+        if (offset >= static_cast<std::ptrdiff_t>(kBlockSize * sizeof(T)) || offset % sizeof(T) != 0) {
+            return -1;
+        }
+        return block->second * kBlockSize + static_cast<int>(offset / sizeof(T));
+    }
+
+    /**
+     * \brief Get storage for one object
+     */
+    void *allocate() {
+        if (ffree.empty()) {
+            fblocks.push_back(static_cast<char*>(::operator new(kBlockSize * sizeof(T))));
+            fbases[fblocks.back()] = static_cast<int>(fblocks.size()) - 1;
+            flive.resize(fblocks.size() * kBlockSize, false);
+            for (int index = static_cast<int>(flive.size()) - 1; index >= static_cast<int>(flive.size()) - kBlockSize;
+                 index--) {
+                ffree.push_back(index);
+            }
+        }
+        int index = ffree.back();
+        ffree.pop_back();
+        flive[index] = true;
+        fsize++;
+        return at(index);
+    }
+
+    /**
+     * \brief Give back storage of allocate() that holds no object
+     */
+    void deallocate(void *storage) {
+        int index = indexOf(storage);
+        REQUIRE(index != -1 && flive[index], "Storage must be allocated by the pool");
+        flive[index] = false;
+        ffree.push_back(index);
+        fsize--;
+    }
+
+public:
+    /**
+     * \brief Default constructor for an ObjectPool object without objects or storage
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(size() == 0, "ObjectPool must be empty")
+     */
+    ObjectPool() : fsize(0) {
+        _initCheck = this;
+        ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+        ENSURE(size() == 0, "ObjectPool must be empty");
+    }
+
+    /**
+     * \brief Destroy every object and release the storage
+     */
+    ~ObjectPool() {
+        clear();
+        for (std::vector<char*>::iterator it = fblocks.begin(); it != fblocks.end(); it++) {
+            ::operator delete(*it);
+        }
+    }
+
+    /**
+     * \brief Check whether the ObjectPool object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const {
+        return _initCheck == this;
+    }
+
+    /**
+     * \brief Create an object with the default constructor of T
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized")
+     *
+     * @post
+     * ENSURE(contains(object), "Object must be an object of the pool")
+     */
+    T *create() {
+        REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized");
+        void *storage = allocate();
+        T *object;
+        try {
+            object = ::new (storage) T();
+        }
+        catch (...) {
+            deallocate(storage);
+            throw;
+        }
+        ENSURE(contains(object), "Object must be an object of the pool");
+        return object;
+    }
+
+    /**
+     * \brief Create an object with the constructor of T that takes four arguments, the storage is given back when the
+     *        constructor throws
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized")
+     *
+     * @post
+     * ENSURE(contains(object), "Object must be an object of the pool")
+     */
+    template <class A1, class A2, class A3, class A4>
+    T *create(const A1 &a1, const A2 &a2, const A3 &a3, const A4 &a4) {
+        REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized");
+        void *storage = allocate();
+        T *object;
+        try {
+            object = ::new (storage) T(a1, a2, a3, a4);
+        }
+        catch (...) {
+            deallocate(storage);
+            throw;
+        }
+        ENSURE(contains(object), "Object must be an object of the pool");
+        return object;
+    }
+
+    /**
+     * \brief Check whether an object is an object of the pool
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized")
+     */
+    bool contains(const T *object) const {
+        REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized");
+        int index = indexOf(object);
+        return index != -1 && flive[index];
+    }
+
+    /**
+     * \brief Destroy an object of the pool, its storage is used for the next object
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized")
+     * REQUIRE(contains(object), "Object must be an object of the pool")
+     */
+    void destroy(T *object) {
+        REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized");
+        REQUIRE(contains(object), "Object must be an object of the pool");
+        object->~T();
+        deallocate(object);
+    }
+
+    /**
+     * \brief Destroy every object of the pool, the storage is kept for the next objects
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized")
+     *
+     * @post
+     * ENSURE(size() == 0, "ObjectPool must be empty")
+     */
+    void clear() {
+        REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized");
+        ffree.clear();
+        for (int index = static_cast<int>(flive.size()) - 1; index >= 0; index--) {
+            if (flive[index]) {
+                at(index)->~T();
+                flive[index] = false;
+            }
+            ffree.push_back(index);
+        }
+        fsize = 0;
+        ENSURE(size() == 0, "ObjectPool must be empty");
+    }
+
+    /**
+     * \brief Get the amount of objects of the pool
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized")
+     */
+    int size() const {
+        REQUIRE(properlyInitialized(), "ObjectPool must be properly initialized");
+        return fsize;
+    }
+};
+
+#endif //VACCINDISTRIBUTOR_OBJECTPOOL_H
@@ -0,0 +1,247 @@
+/**
+ * @file Renderer.cpp
+ * @brief This file contains the definitions of the members of the Renderer class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "Renderer.h"
+
+/**
+ * \brief Corners of the faces of a cube, corner i has x = 1 when bit 0 of i is set, y = 1 for bit 1 and z = 1 for
+ *        bit 2, else -1
+ */
+static const int kCubeFaces[6][4] = {{0, 2, 6, 4}, {1, 3, 7, 5}, {0, 1, 5, 4}, {2, 3, 7, 6}, {0, 1, 3, 2},
+                                     {4, 5, 7, 6}};
+
+/**
+ * \brief Pi, M_PI is not part of standard C++
+ */
+static const double kPi = 3.14159265358979323846;
+
+/**
+ * \brief Byte of a color value between 0 and 1
+ */
+static unsigned char toByte(double value) {
+
+    if (value <= 0) {
+        return 0;
+    }
+    if (value >= 1) {
+        return 255;
+    }
+    return static_cast<unsigned char>(std::floor(value * 255 + 0.5));
+}
+
+Renderer::Renderer() {
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+}
+
+bool Renderer::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+Image Renderer::render(const Scene &scene) const {
+
+    REQUIRE(properlyInitialized(), "Renderer object must be properly initialized");
+    REQUIRE(scene.properlyInitialized(), "Scene object must be properly initialized");
+
+    // Eye point transformation: the eye point in spherical coordinates, looking at the origin
+    const Scene::Vector3 &eye = scene.getEye();
+    double r = std::sqrt(eye.x * eye.x + eye.y * eye.y + eye.z * eye.z);
+    double theta = std::atan2(eye.y, eye.x);
+    double phi = r > 0 ? std::acos(eye.z / r) : 0;
+    double sinTheta = std::sin(theta);
+    double cosTheta = std::cos(theta);
+    double sinPhi = std::sin(phi);
+    double cosPhi = std::cos(phi);
+
+    std::vector<Point> points;
+    std::vector<Triangle> triangles;
+    std::vector<Scene::Vector3> world;
+    const std::vector<Scene::Figure> &figures = scene.getFigures();
+    for (std::vector<Scene::Figure>::const_iterator it = figures.begin(); it != figures.end(); it++) {
+        int first = static_cast<int>(world.size());
+        std::vector<int> corners;
+        if (it->type == Scene::Figure::kCube) {
+            for (int i = 0; i < 8; i++) {
+                world.push_back(Scene::Vector3(i & 1 ? 1 : -1, i & 2 ? 1 : -1, i & 4 ? 1 : -1));
+            }
+            for (int face = 0; face < 6; face++) {
+                const int *c = kCubeFaces[face];
+                int quad[6] = {c[0], c[1], c[2], c[0], c[2], c[3]};
+                corners.insert(corners.end(), quad, quad + 6);
+            }
+        }
+        else {
+            // Ground surface in the xy-plane and the top on the z-axis
+            for (int i = 0; i < it->n; i++) {
+                double angle = 2 * kPi * i / it->n;
+                world.push_back(Scene::Vector3(std::cos(angle), std::sin(angle), 0));
+            }
+            world.push_back(Scene::Vector3(0, 0, it->height));
+            for (int i = 0; i < it->n; i++) {
+                int side[3] = {i, (i + 1) % it->n, it->n};
+                corners.insert(corners.end(), side, side + 3);
+            }
+            for (int i = 1; i + 1 < it->n; i++) {
+                int ground[3] = {0, i, i + 1};
+                corners.insert(corners.end(), ground, ground + 3);
+            }
+        }
+        for (size_t i = first; i < world.size(); i++) {
+            world[i].x = world[i].x * it->scale + it->center.x;
+            world[i].y = world[i].y * it->scale + it->center.y;
+            world[i].z = world[i].z * it->scale + it->center.z;
+        }
+        for (size_t i = 0; i < corners.size(); i += 3) {
+            Triangle triangle = {first + corners[i], first + corners[i + 1], first + corners[i + 2], it->color};
+            triangles.push_back(triangle);
+        }
+    }
+    const std::vector<std::pair<Scene::Vector3, Scene::Vector3> > &lines = scene.getLines();
+    int firstLine = static_cast<int>(world.size());
+    for (std::vector<std::pair<Scene::Vector3, Scene::Vector3> >::const_iterator it = lines.begin();
+         it != lines.end(); it++) {
+        world.push_back(it->first);
+        world.push_back(it->second);
+    }
+
+    // Perspective projection on the plane at distance 1 of the eye point, points behind the eye are not drawn
+    double xMin = std::numeric_limits<double>::max();
+    double xMax = -xMin;
+    double yMin = xMin;
+    double yMax = -xMin;
+    points.resize(world.size());
+    for (size_t i = 0; i < world.size(); i++) {
+        const Scene::Vector3 &p = world[i];
+        double x = -sinTheta * p.x + cosTheta * p.y;
+        double y = -cosTheta * cosPhi * p.x - sinTheta * cosPhi * p.y + sinPhi * p.z;
+        double z = cosTheta * sinPhi * p.x + sinTheta * sinPhi * p.y + cosPhi * p.z - r;
+        points[i].z = z;
+        if (z < 0) {
+            points[i].x = x / -z;
+            points[i].y = y / -z;
+            xMin = std::min(xMin, points[i].x);
+            xMax = std::max(xMax, points[i].x);
+            yMin = std::min(yMin, points[i].y);
+            yMax = std::max(yMax, points[i].y);
+        }
+    }
+
+    int size = scene.getSize();
+    const Scene::Color &background = scene.getBackground();
+    if (xMin > xMax) {
+        return Image(size, size, toByte(background.red), toByte(background.green), toByte(background.blue));
+    }
+
+    // The largest side of the projection fills the image, with a margin of 5%
+    double xRange = std::max(xMax - xMin, 1e-9);
+    double yRange = std::max(yMax - yMin, 1e-9);
+    double imageX = size * xRange / std::max(xRange, yRange);
+    double imageY = size * yRange / std::max(xRange, yRange);
+    double d = 0.95 * imageX / xRange;
+    double dx = imageX / 2 - d * (xMin + xMax) / 2;
+    double dy = imageY / 2 - d * (yMin + yMax) / 2;
+    for (std::vector<Point>::iterator it = points.begin(); it != points.end(); it++) {
+        it->x = it->x * d + dx;
+        it->y = it->y * d + dy;
+    }
+
+    Image image(std::max(1, static_cast<int>(std::floor(imageX + 0.5))),
+                std::max(1, static_cast<int>(std::floor(imageY + 0.5))),
+                toByte(background.red), toByte(background.green), toByte(background.blue));
+    std::vector<double> zBuffer(static_cast<size_t>(image.getWidth()) * image.getHeight(),
+                                std::numeric_limits<double>::infinity());
+    for (std::vector<Triangle>::const_iterator it = triangles.begin(); it != triangles.end(); it++) {
+        const Point &a = points[it->a];
+        const Point &b = points[it->b];
+        const Point &c = points[it->c];
+        if (a.z < 0 && b.z < 0 && c.z < 0) {
+            drawTriangle(image, zBuffer, a, b, c, it->color);
+        }
+    }
+    for (size_t i = firstLine; i < points.size(); i += 2) {
+        if (points[i].z < 0 && points[i + 1].z < 0) {
+            drawLine(image, zBuffer, points[i], points[i + 1], scene.getLineColor());
+        }
+    }
+
+    ENSURE(std::max(image.getWidth(), image.getHeight()) <= scene.getSize(), "Image can't be larger than the Scene");
+    return image;
+}
+
+void Renderer::drawTriangle(Image &image, std::vector<double> &zBuffer, const Point &a, const Point &b,
+                            const Point &c, const Scene::Color &color) {
+
+    double area = (b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y);
+    if (std::fabs(area) < 1e-12) {
+        return;
+    }
+
+    int width = image.getWidth();
+    int height = image.getHeight();
+    int xFirst = std::max(0, static_cast<int>(std::ceil(std::min(a.x, std::min(b.x, c.x)))));
+    int xLast = std::min(width - 1, static_cast<int>(std::floor(std::max(a.x, std::max(b.x, c.x)))));
+    int yFirst = std::max(0, static_cast<int>(std::ceil(std::min(a.y, std::min(b.y, c.y)))));
+    int yLast = std::min(height - 1, static_cast<int>(std::floor(std::max(a.y, std::max(b.y, c.y)))));
+    unsigned char red = toByte(color.red);
+    unsigned char green = toByte(color.green);
+    unsigned char blue = toByte(color.blue);
+
+    // 1/z changes linearly over the projected triangle, the weights of the corners give 1/z of every pixel
+    for (int y = yFirst; y <= yLast; y++) {
+        for (int x = xFirst; x <= xLast; x++) {
+            double wa = ((b.x - x) * (c.y - y) - (c.x - x) * (b.y - y)) / area;
+            double wb = ((c.x - x) * (a.y - y) - (a.x - x) * (c.y - y)) / area;
+            double wc = 1 - wa - wb;
+            if (wa < -1e-9 || wb < -1e-9 || wc < -1e-9) {
+                continue;
+            }
+            double inverseZ = wa / a.z + wb / b.z + wc / c.z;
+
+            // The image is drawn with y up, the rows of the Image start at the top
+            size_t index = static_cast<size_t>(height - 1 - y) * width + x;
+            if (inverseZ < zBuffer[index]) {
+                zBuffer[index] = inverseZ;
+                image.setPixel(x, height - 1 - y, red, green, blue);
+            }
+        }
+    }
+}
+
+void Renderer::drawLine(Image &image, std::vector<double> &zBuffer, const Point &from, const Point &to,
+                        const Scene::Color &color) {
+
+    int width = image.getWidth();
+    int height = image.getHeight();
+    unsigned char red = toByte(color.red);
+    unsigned char green = toByte(color.green);
+    unsigned char blue = toByte(color.blue);
+
+    int x0 = static_cast<int>(std::floor(from.x + 0.5));
+    int y0 = static_cast<int>(std::floor(from.y + 0.5));
+    int x1 = static_cast<int>(std::floor(to.x + 0.5));
+    int y1 = static_cast<int>(std::floor(to.y + 0.5));
+    int steps = std::max(std::abs(x1 - x0), std::abs(y1 - y0));
+    for (int i = 0; i <= steps; i++) {
+        double t = steps == 0 ? 0 : static_cast<double>(i) / steps;
+        int x = static_cast<int>(std::floor(x0 + t * (x1 - x0) + 0.5));
+        int y = static_cast<int>(std::floor(y0 + t * (y1 - y0) + 0.5));
+        if (x < 0 || x >= width || y < 0 || y >= height) {
+            continue;
+        }
+        double inverseZ = (1 - t) / from.z + t / to.z;
+        size_t index = static_cast<size_t>(height - 1 - y) * width + x;
+        if (inverseZ < zBuffer[index]) {
+            zBuffer[index] = inverseZ;
+            image.setPixel(x, height - 1 - y, red, green, blue);
+        }
+    }
+}
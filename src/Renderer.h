@@ -0,0 +1,106 @@
+/**
+ * @file Renderer.h
+ * @brief This header file contains the declarations and the members of the Renderer class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_RENDERER_H
+#define VACCINDISTRIBUTOR_RENDERER_H
+
+#include <vector>
+#include "DesignByContract.h"
+#include "Scene.h"
+#include "Image.h"
+
+/**
+ * \brief Class implemented to draw a Scene in memory, like the "ZBuffering" type of the engine draws a .ini file
+ *
+ * The figures are split in triangles and seen from the eye point of the Scene with a perspective projection. The
+ * projection is scaled so the largest side of the image has the size of the Scene. Triangles and lines are drawn with
+ * a z-buffer, so what is nearest to the eye point is visible.
+ */
+class Renderer {
+
+private:
+    /**
+     * \brief Point after the eye point transformation and the projection, x and y are pixels and z is the distance
+     *        along the view direction, negative in front of the eye
+     */
+    struct Point {
+        double x;
+        double y;
+        double z;
+    };
+
+    /**
+     * \brief Triangle of a figure, the corners are indices in the points
+     */
+    struct Triangle {
+        int a;
+        int b;
+        int c;
+        Scene::Color color;
+    };
+
+    Renderer *_initCheck;
+
+    /**
+     * \brief Draw a triangle, a pixel is only drawn when it is nearer to the eye point than what is drawn on it
+     *
+     * @param image The Image
+     * @param zBuffer 1/z of the nearest point drawn on every pixel
+     * @param a Corner of the triangle
+     * @param b Corner of the triangle
+     * @param c Corner of the triangle
+     * @param color Color of the triangle
+     */
+    static void drawTriangle(Image &image, std::vector<double> &zBuffer, const Point &a, const Point &b,
+                             const Point &c, const Scene::Color &color);
+
+    /**
+     * \brief Draw a line, a pixel is only drawn when it is nearer to the eye point than what is drawn on it
+     *
+     * @param image The Image
+     * @param zBuffer 1/z of the nearest point drawn on every pixel
+     * @param from Start of the line
+     * @param to End of the line
+     * @param color Color of the line
+     */
+    static void drawLine(Image &image, std::vector<double> &zBuffer, const Point &from, const Point &to,
+                         const Scene::Color &color);
+
+public:
+    /**
+     * \brief Default constructor for a Renderer object
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     */
+    Renderer();
+
+    /**
+     * \brief Check whether the Renderer object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Draw a Scene
+     *
+     * @param scene The Scene, every figure and line must be in front of the eye point
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Renderer object must be properly initialized")
+     * REQUIRE(scene.properlyInitialized(), "Scene object must be properly initialized")
+     *
+     * @post
+     * ENSURE(std::max(image.getWidth(), image.getHeight()) <= scene.getSize(), "Image can't be larger than the Scene")
+     *
+     * @return The Image, a square Image with the background color when the Scene has no figures and lines
+     */
+    Image render(const Scene &scene) const;
+};
+
+#endif //VACCINDISTRIBUTOR_RENDERER_H
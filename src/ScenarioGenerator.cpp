@@ -0,0 +1,251 @@
+/**
+ * @file ScenarioGenerator.cpp
+ * @brief This file contains the definitions of the members of the ScenarioGenerator class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+#include "ScenarioGenerator.h"
+#include "Utils.h"
+
+/**
+ * \brief Kinds of generated values, every kind gets its own sequence of values
+ */
+enum ValueKind {
+    kHubStart, kHubTypes, kTemperature, kRenewal, kTransport, kInterval, kLoads, kPopulation, kCapacity
+};
+
+/**
+ * \brief Largest delivery of a Vaccin, keeps the amounts of the simulation far from the limit of an int
+ */
+static const int kMaxDelivery = 100000000;
+
+/**
+ * \brief Possible sizes of a load of Vaccins
+ */
+static const int kTransports[] = {100, 500, 1000, 1500, 2000};
+
+/**
+ * \brief Mix the bits of a value, every bit of the input changes about half of the bits of the output
+ */
+static unsigned int mixBits(unsigned int value) {
+
+    value ^= value >> 16;
+    value *= 0x7feb352dU;
+    value ^= value >> 15;
+    value *= 0x846ca68bU;
+    value ^= value >> 16;
+    return value;
+}
+
+ScenarioGenerator::ScenarioGenerator(unsigned int seed) {
+
+    fseed = seed;
+    fhubs = 1;
+    fcentra = 10;
+    ftypes = 3;
+    ftypesPerHub = 3;
+    ffrozen = 40;
+    fcooled = 30;
+    ffanOut = 1;
+    fminPopulation = 10000;
+    fmaxPopulation = 500000;
+    fskewed = false;
+    fminCapacity = 10;
+    fmaxCapacity = 40;
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(getSeed() == seed, "Value of fseed not set");
+}
+
+bool ScenarioGenerator::properlyInitialized() const {
+
+    return ScenarioGenerator::_initCheck == this;
+}
+
+unsigned int ScenarioGenerator::getSeed() const {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+    return fseed;
+}
+
+void ScenarioGenerator::setSize(int hubs, int centra) {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+    REQUIRE(hubs >= 1, "There must be a hub");
+    REQUIRE(centra >= 1, "There must be a VaccinationCenter");
+
+    fhubs = hubs;
+    fcentra = centra;
+    ffanOut = std::min(ffanOut, hubs);
+
+    ENSURE(getHubs() == hubs, "Value of fhubs not set");
+    ENSURE(getCentra() == centra, "Value of fcentra not set");
+}
+
+int ScenarioGenerator::getHubs() const {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+    return fhubs;
+}
+
+int ScenarioGenerator::getCentra() const {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+    return fcentra;
+}
+
+void ScenarioGenerator::setVaccinTypes(int types, int typesPerHub, int frozen, int cooled) {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+    REQUIRE(types >= 1, "There must be a Vaccin type");
+    REQUIRE(typesPerHub >= 1 && typesPerHub <= types, "Hub must get at least one and at most all Vaccin types");
+    REQUIRE(frozen >= 0 && cooled >= 0 && frozen + cooled <= 100, "Mix of Vaccin types must be percentages");
+
+    ftypes = types;
+    ftypesPerHub = typesPerHub;
+    ffrozen = frozen;
+    fcooled = cooled;
+
+    ENSURE(getTypes() == types, "Value of ftypes not set");
+}
+
+int ScenarioGenerator::getTypes() const {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+    return ftypes;
+}
+
+void ScenarioGenerator::setFanOut(int fanOut) {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+    REQUIRE(fanOut >= 1 && fanOut <= getHubs(), "VaccinationCenter must be supplied by at least one and at most all hubs");
+    ffanOut = fanOut;
+}
+
+void ScenarioGenerator::setPopulation(int minPopulation, int maxPopulation, bool skewed) {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+    REQUIRE(minPopulation >= 0 && minPopulation <= maxPopulation, "Population range must be valid");
+    fminPopulation = minPopulation;
+    fmaxPopulation = maxPopulation;
+    fskewed = skewed;
+}
+
+void ScenarioGenerator::setCapacity(int minCapacity, int maxCapacity) {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+    REQUIRE(minCapacity >= 0 && minCapacity <= maxCapacity, "Capacity range must be valid");
+    fminCapacity = minCapacity;
+    fmaxCapacity = maxCapacity;
+}
+
+int ScenarioGenerator::random(unsigned int kind, unsigned int index, int min, int max) const {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+    REQUIRE(min <= max, "Range can't be empty");
+
+    unsigned int value = mixBits(fseed ^ mixBits(kind * 0x9e3779b9U ^ mixBits(index)));
+    unsigned int range = static_cast<unsigned int>(max - min) + 1;
+    if (range == 0) {
+        return static_cast<int>(value);
+    }
+    return min + static_cast<int>(value % range);
+}
+
+void ScenarioGenerator::generate(std::ostream &stream) const {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+    REQUIRE(ffanOut <= fhubs, "VaccinationCenter can't be supplied by more hubs than there are");
+    REQUIRE(ftypesPerHub <= ftypes, "Hub can't get more Vaccin types than there are");
+
+    // Every VaccinationCenter is supplied by ffanOut hubs next to each other, starting from a random hub
+    std::vector<std::vector<int> > hubCentra(fhubs);
+    for (int center = 0; center < fcentra; center++) {
+        int start = random(kHubStart, center, 0, fhubs - 1);
+        for (int hub = 0; hub < ffanOut; hub++) {
+            hubCentra[(start + hub) % fhubs].push_back(center);
+        }
+    }
+
+    // Percentages of the mix are rounded to the nearest amount of Vaccin types
+    int frozenTypes = (ftypes * ffrozen + 50) / 100;
+    int renewalTypes = std::min(ftypes, frozenTypes + (ftypes * fcooled + 50) / 100);
+
+    for (int hub = 0; hub < fhubs; hub++) {
+        stream << "<HUB>\n";
+        int firstType = random(kHubTypes, hub, 0, ftypes - 1);
+        int centra = static_cast<int>(hubCentra[hub].size());
+
+        for (int i = 0; i < ftypesPerHub; i++) {
+            int type = (firstType + i) % ftypes;
+            unsigned int index = static_cast<unsigned int>(hub) * ftypes + type;
+
+            // The temperature and renewal belong to the Vaccin type, every hub gets the same values
+            int temperature = random(kTemperature, type, 2, 8);
+            int renewal = 0;
+            if (type < frozenTypes) {
+                temperature = random(kTemperature, type, 0, 1) == 0 ? -70 : -20;
+            }
+            if (type < renewalTypes) {
+                renewal = random(kRenewal, type, 0, 1) == 0 ? 21 : 28;
+            }
+
+            int transport = kTransports[random(kTransport, index, 0, 4)];
+            int loads = random(kLoads, index, centra / 2 + 1, 2 * centra + 1);
+            int delivery = std::min(loads, kMaxDelivery / transport) * transport;
+
+            stream << "    <VACCIN>\n";
+            stream << "        <type>Vaccin-" << type << "</type>\n";
+            stream << "        <levering>" << delivery << "</levering>\n";
+            stream << "        <interval>" << random(kInterval, index, 1, 14) << "</interval>\n";
+            stream << "        <transport>" << transport << "</transport>\n";
+            stream << "        <hernieuwing>" << renewal << "</hernieuwing>\n";
+            stream << "        <temperatuur>" << temperature << "</temperatuur>\n";
+            stream << "    </VACCIN>\n";
+        }
+
+        stream << "    <CENTRA>\n";
+        for (std::vector<int>::const_iterator it = hubCentra[hub].begin(); it != hubCentra[hub].end(); it++) {
+            stream << "        <centrum>Center-" << *it << "</centrum>\n";
+        }
+        stream << "    </CENTRA>\n";
+        stream << "</HUB>\n";
+    }
+
+    for (int center = 0; center < fcentra; center++) {
+        int population;
+        if (fskewed) {
+            // Cube of a uniform value between 0 and 1, most values are close to 0
+            double value = random(kPopulation, center, 0, 1000000) / 1000000.0;
+            population = fminPopulation + static_cast<int>((fmaxPopulation - fminPopulation) * value * value * value);
+        }
+        else {
+            population = random(kPopulation, center, fminPopulation, fmaxPopulation);
+        }
+        int perMille = random(kCapacity, center, fminCapacity, fmaxCapacity);
+        int capacity = std::max(1, static_cast<int>(static_cast<double>(population) * perMille / 1000));
+
+        stream << "<VACCINATIECENTRUM>\n";
+        stream << "    <naam>Center-" << center << "</naam>\n";
+        stream << "    <adres>Straat " << center << ", Antwerpen</adres>\n";
+        stream << "    <inwoners>" << population << "</inwoners>\n";
+        stream << "    <capaciteit>" << capacity << "</capaciteit>\n";
+        stream << "</VACCINATIECENTRUM>\n";
+    }
+}
+
+void ScenarioGenerator::generateFile(const std::string &path) const {
+
+    REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized");
+
+    std::ofstream file(path.c_str());
+    generate(file);
+    file.close();
+
+    ENSURE_FULL(FileExists(path), "File that has been written to must exist");
+    ENSURE(!FileIsEmpty(path), "File that has been written to must not be empty");
+}
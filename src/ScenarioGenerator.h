@@ -0,0 +1,212 @@
+/**
+ * @file ScenarioGenerator.h
+ * @brief This header file contains the declarations and the members of the ScenarioGenerator class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef TTT_SCENARIOGENERATOR_H
+#define TTT_SCENARIOGENERATOR_H
+
+#include <string>
+#include <iostream>
+#include "DesignByContract.h"
+
+/**
+ * \brief Class implemented for a ScenarioGenerator, writes simulation files of any size in the format of XMLReader
+ *
+ * Every value is a hash of the seed and the place of the value in the file, so the same seed and settings always
+ * give the same file. Centra are written one by one, only the lists of centra of the hubs are kept in memory.
+ */
+class ScenarioGenerator {
+private:
+    unsigned int fseed; ///< Seed of the generated values
+    int fhubs; ///< Amount of hubs
+    int fcentra; ///< Amount of VaccinationCenters
+    int ftypes; ///< Amount of Vaccin types
+    int ftypesPerHub; ///< Amount of Vaccin types delivered to each hub
+    int ffrozen; ///< Percent of the Vaccin types stored under zero, with renewal
+    int fcooled; ///< Percent of the Vaccin types stored above zero, with renewal, the rest has no renewal
+    int ffanOut; ///< Amount of hubs that supply each VaccinationCenter
+    int fminPopulation; ///< Smallest population of a VaccinationCenter
+    int fmaxPopulation; ///< Largest population of a VaccinationCenter
+    bool fskewed; ///< Many small and a few large populations instead of a uniform distribution
+    int fminCapacity; ///< Smallest capacity of a VaccinationCenter in per mille of its population
+    int fmaxCapacity; ///< Largest capacity of a VaccinationCenter in per mille of its population
+    ScenarioGenerator *_initCheck;
+
+    /**
+     * \brief Generated value between min and max, both included
+     *
+     * @param kind Kind of value, values of another kind are independent
+     * @param index Place of the value in the file
+     * @param min Smallest value
+     * @param max Largest value
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     * REQUIRE(min <= max, "Range can't be empty")
+     *
+     * @return Value as int
+     */
+    int random(unsigned int kind, unsigned int index, int min, int max) const;
+
+public:
+    /**
+     * \brief Constructor for a ScenarioGenerator object, the settings are those of a small simulation
+     *
+     * @param seed Seed of the generated values
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(getSeed() == seed, "Value of fseed not set")
+     */
+    ScenarioGenerator(unsigned int seed);
+
+    /**
+    * \brief Check whether the ScenarioGenerator object is properly initialised
+    *
+    * @return true when object is properly initialised, false when not
+    */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Get the seed of the generated values
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     *
+     * @return Seed as unsigned int
+     */
+    unsigned int getSeed() const;
+
+    /**
+     * \brief Set the amount of hubs and VaccinationCenters
+     *
+     * @param hubs Amount of hubs
+     * @param centra Amount of VaccinationCenters
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     * REQUIRE(hubs >= 1, "There must be a hub")
+     * REQUIRE(centra >= 1, "There must be a VaccinationCenter")
+     *
+     * @post
+     * ENSURE(getHubs() == hubs, "Value of fhubs not set")
+     * ENSURE(getCentra() == centra, "Value of fcentra not set")
+     */
+    void setSize(int hubs, int centra);
+
+    /**
+     * \brief Get the amount of hubs
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     *
+     * @return Amount of hubs as int
+     */
+    int getHubs() const;
+
+    /**
+     * \brief Get the amount of VaccinationCenters
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     *
+     * @return Amount of VaccinationCenters as int
+     */
+    int getCentra() const;
+
+    /**
+     * \brief Set the Vaccin types and the mix of Vaccin types
+     *
+     * @param types Amount of Vaccin types
+     * @param typesPerHub Amount of Vaccin types delivered to each hub
+     * @param frozen Percent of the Vaccin types stored under zero, with renewal
+     * @param cooled Percent of the Vaccin types stored above zero, with renewal, the rest has no renewal
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     * REQUIRE(types >= 1, "There must be a Vaccin type")
+     * REQUIRE(typesPerHub >= 1 && typesPerHub <= types, "Hub must get at least one and at most all Vaccin types")
+     * REQUIRE(frozen >= 0 && cooled >= 0 && frozen + cooled <= 100, "Mix of Vaccin types must be percentages")
+     *
+     * @post
+     * ENSURE(getTypes() == types, "Value of ftypes not set")
+     */
+    void setVaccinTypes(int types, int typesPerHub, int frozen, int cooled);
+
+    /**
+     * \brief Get the amount of Vaccin types
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     *
+     * @return Amount of Vaccin types as int
+     */
+    int getTypes() const;
+
+    /**
+     * \brief Set the amount of hubs that supply each VaccinationCenter
+     *
+     * @param fanOut Amount of hubs
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     * REQUIRE(fanOut >= 1 && fanOut <= getHubs(), "VaccinationCenter must be supplied by at least one and at most all hubs")
+     */
+    void setFanOut(int fanOut);
+
+    /**
+     * \brief Set the distribution of the populations of the VaccinationCenters
+     *
+     * @param minPopulation Smallest population
+     * @param maxPopulation Largest population
+     * @param skewed true -> many small and a few large populations, false -> uniform
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     * REQUIRE(minPopulation >= 0 && minPopulation <= maxPopulation, "Population range must be valid")
+     */
+    void setPopulation(int minPopulation, int maxPopulation, bool skewed);
+
+    /**
+     * \brief Set the distribution of the capacities of the VaccinationCenters
+     *
+     * @param minCapacity Smallest capacity in per mille of the population
+     * @param maxCapacity Largest capacity in per mille of the population
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     * REQUIRE(minCapacity >= 0 && minCapacity <= maxCapacity, "Capacity range must be valid")
+     */
+    void setCapacity(int minCapacity, int maxCapacity);
+
+    /**
+     * \brief Write the simulation
+     *
+     * @param stream Output stream
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     * REQUIRE(ffanOut <= fhubs, "VaccinationCenter can't be supplied by more hubs than there are")
+     * REQUIRE(ftypesPerHub <= ftypes, "Hub can't get more Vaccin types than there are")
+     */
+    void generate(std::ostream &stream) const;
+
+    /**
+     * \brief Write the simulation to a file
+     *
+     * @param path Path of the file
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ScenarioGenerator must be properly initialized")
+     *
+     * @post
+     * ENSURE(FileExists(path), "File that has been written to must exist")
+     * ENSURE(!FileIsEmpty(path), "File that has been written to must not be empty")
+     */
+    void generateFile(const std::string &path) const;
+};
+
+#endif //TTT_SCENARIOGENERATOR_H
@@ -0,0 +1,77 @@
+/**
+ * @file Scene.cpp
+ * @brief This file contains the definitions of the members of the Scene class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "Scene.h"
+
+Scene::Scene(int size, const Color &background, const Vector3 &eye) : fsize(size), fbackground(background),
+                                                                      feye(eye) {
+
+    REQUIRE(size > 0, "Size must be positive");
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+}
+
+bool Scene::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+void Scene::addFigure(const Figure &figure) {
+
+    REQUIRE(properlyInitialized(), "Scene object must be properly initialized");
+    REQUIRE(figure.scale > 0, "Scale must be positive");
+    REQUIRE(figure.type != Figure::kCone || figure.n >= 3, "Cone needs at least 3 corner points");
+    ffigures.push_back(figure);
+}
+
+void Scene::addLine(const Vector3 &from, const Vector3 &to) {
+
+    REQUIRE(properlyInitialized(), "Scene object must be properly initialized");
+    flines.push_back(std::make_pair(from, to));
+}
+
+void Scene::setLineColor(const Color &color) {
+
+    REQUIRE(properlyInitialized(), "Scene object must be properly initialized");
+    flineColor = color;
+}
+
+int Scene::getSize() const {
+
+    REQUIRE(properlyInitialized(), "Scene object must be properly initialized");
+    return fsize;
+}
+
+const Scene::Color &Scene::getBackground() const {
+
+    REQUIRE(properlyInitialized(), "Scene object must be properly initialized");
+    return fbackground;
+}
+
+const Scene::Vector3 &Scene::getEye() const {
+
+    REQUIRE(properlyInitialized(), "Scene object must be properly initialized");
+    return feye;
+}
+
+const std::vector<Scene::Figure> &Scene::getFigures() const {
+
+    REQUIRE(properlyInitialized(), "Scene object must be properly initialized");
+    return ffigures;
+}
+
+const std::vector<std::pair<Scene::Vector3, Scene::Vector3> > &Scene::getLines() const {
+
+    REQUIRE(properlyInitialized(), "Scene object must be properly initialized");
+    return flines;
+}
+
+const Scene::Color &Scene::getLineColor() const {
+
+    REQUIRE(properlyInitialized(), "Scene object must be properly initialized");
+    return flineColor;
+}
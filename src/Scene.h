@@ -0,0 +1,174 @@
+/**
+ * @file Scene.h
+ * @brief This header file contains the declarations and the members of the Scene class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_SCENE_H
+#define VACCINDISTRIBUTOR_SCENE_H
+
+#include <vector>
+#include <utility>
+#include "DesignByContract.h"
+
+/**
+ * \brief Class implemented for a 3D-environment with Hubs and VaccinationCenters, drawn by the Renderer
+ *
+ * A Scene holds the same figures as the .ini file of Simulation::generateIni: cubes and cones with a scale, a center
+ * and a color, and lines between points. The figures are not rotated.
+ */
+class Scene {
+
+public:
+    /**
+     * \brief Point or direction in the 3D-environment
+     */
+    struct Vector3 {
+        double x;
+        double y;
+        double z;
+
+        Vector3(double x = 0, double y = 0, double z = 0) : x(x), y(y), z(z) {}
+    };
+
+    /**
+     * \brief Color with red, green and blue between 0 and 1
+     */
+    struct Color {
+        double red;
+        double green;
+        double blue;
+
+        Color(double red = 0, double green = 0, double blue = 0) : red(red), green(green), blue(blue) {}
+    };
+
+    /**
+     * \brief Cube with corners at -1 and 1 or cone with its ground surface at z = 0, scaled and moved to center
+     */
+    struct Figure {
+        enum Type {
+            kCube, kCone
+        };
+
+        Type type;
+        double scale;
+        Vector3 center;
+        Color color;
+        int n; ///< Amount of corner points of the ground surface of a cone
+        double height; ///< Height of a cone before it is scaled
+
+        Figure(Type type, double scale, const Vector3 &center, const Color &color, int n = 0, double height = 0)
+            : type(type), scale(scale), center(center), color(color), n(n), height(height) {}
+    };
+
+private:
+    int fsize; ///< Size of the largest side of the image in pixels
+    Color fbackground; ///< Color of the background
+    Vector3 feye; ///< Eye point, looking at the origin
+    std::vector<Figure> ffigures;
+    std::vector<std::pair<Vector3, Vector3> > flines;
+    Color flineColor; ///< Color of all lines
+    Scene *_initCheck;
+
+public:
+    /**
+     * \brief Constructor for a Scene object without figures and lines
+     *
+     * @param size Size of the largest side of the image in pixels
+     * @param background Color of the background
+     * @param eye Eye point, looking at the origin
+     *
+     * @pre
+     * REQUIRE(size > 0, "Size must be positive")
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     */
+    Scene(int size, const Color &background, const Vector3 &eye);
+
+    /**
+     * \brief Check whether the Scene object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Add a figure
+     *
+     * @param figure The figure
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Scene object must be properly initialized")
+     * REQUIRE(figure.scale > 0, "Scale must be positive")
+     * REQUIRE(figure.type != Figure::kCone || figure.n >= 3, "Cone needs at least 3 corner points")
+     */
+    void addFigure(const Figure &figure);
+
+    /**
+     * \brief Add a line between two points
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Scene object must be properly initialized")
+     */
+    void addLine(const Vector3 &from, const Vector3 &to);
+
+    /**
+     * \brief Set the color of all lines
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Scene object must be properly initialized")
+     */
+    void setLineColor(const Color &color);
+
+    /**
+     * \brief Get the size of the largest side of the image in pixels
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Scene object must be properly initialized")
+     */
+    int getSize() const;
+
+    /**
+     * \brief Get the color of the background
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Scene object must be properly initialized")
+     */
+    const Color &getBackground() const;
+
+    /**
+     * \brief Get the eye point
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Scene object must be properly initialized")
+     */
+    const Vector3 &getEye() const;
+
+    /**
+     * \brief Get the figures in the order they were added
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Scene object must be properly initialized")
+     */
+    const std::vector<Figure> &getFigures() const;
+
+    /**
+     * \brief Get the lines in the order they were added
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Scene object must be properly initialized")
+     */
+    const std::vector<std::pair<Vector3, Vector3> > &getLines() const;
+
+    /**
+     * \brief Get the color of all lines
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Scene object must be properly initialized")
+     */
+    const Color &getLineColor() const;
+};
+
+#endif //VACCINDISTRIBUTOR_SCENE_H
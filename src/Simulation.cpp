@@ -7,20 +7,165 @@
 
 #include "Simulation.h"
 
+/**
+ * \brief Vaccinate one VaccinationCenter for every index and buffer its events
+ */
+class VaccinationTask : public ThreadPool::Task {
+private:
+    const std::vector<VaccinationCenter*> &fcentra; ///< Centra to vaccinate
+    std::vector<std::vector<EventSink::Event> > &fevents; ///< Events of every VaccinationCenter
+    int fday; ///< Day of the events
+
+public:
+    VaccinationTask(const std::vector<VaccinationCenter*> &centra, std::vector<std::vector<EventSink::Event> > &events,
+                    int day) : fcentra(centra), fevents(events), fday(day) {}
+
+    void run(int index) {
+        // Without stock a VaccinationCenter vaccinates nobody and has nothing to discard
+        if (!fcentra[index]->isActive()) {
+            return;
+        }
+        EventBuffer buffer;
+        buffer.setDay(fday);
+        fcentra[index]->vaccinateCenter(buffer);
+        fevents[index] = buffer.getEvents();
+    }
+};
+
+/**
+ * \brief Transport the vaccins of the Hubs of one component for every index and buffer the events of every Hub
+ */
+class TransportTask : public ThreadPool::Task {
+private:
+    const std::vector<Hub*> &fhubs; ///< Hubs of the Simulation
+    const Topology &ftopology; ///< Centra of every Hub
+    const std::vector<std::vector<int> > &fcomponents; ///< Indices of the Hubs of every component
+    std::vector<std::vector<EventSink::Event> > &frequired; ///< Transports for second shots of every Hub
+    std::vector<std::vector<EventSink::Event> > &ffair; ///< Fair transports of every Hub
+    int fcurrentDay; ///< Day the vaccins are distributed for
+    int fday; ///< Day of the events
+
+public:
+    TransportTask(const std::vector<Hub*> &hubs, const Topology &topology,
+                  const std::vector<std::vector<int> > &components,
+                  std::vector<std::vector<EventSink::Event> > &required,
+                  std::vector<std::vector<EventSink::Event> > &fair, int currentDay, int day)
+            : fhubs(hubs), ftopology(topology), fcomponents(components), frequired(required), ffair(fair), fcurrentDay(currentDay),
+              fday(day) {}
+
+    void run(int index) {
+        const std::vector<int> &hubs = fcomponents[index];
+        for (std::vector<int>::const_iterator hub = hubs.begin(); hub != hubs.end(); hub++) {
+            // Without a load in stock a Hub has nothing to transport, not even for second shots
+            if (!fhubs[*hub]->isActive()) {
+                continue;
+            }
+            EventBuffer buffer;
+            buffer.setDay(fday);
+            for (int edge = ftopology.beginCentra(*hub); edge < ftopology.endCentra(*hub); edge++) {
+                fhubs[*hub]->distributeRequiredVaccins(ftopology.getCenter(ftopology.getEdgeCenter(edge)), buffer);
+            }
+            frequired[*hub] = buffer.getEvents();
+        }
+        for (std::vector<int>::const_iterator hub = hubs.begin(); hub != hubs.end(); hub++) {
+            if (!fhubs[*hub]->isActive()) {
+                continue;
+            }
+            EventBuffer buffer;
+            buffer.setDay(fday);
+            const std::map<std::string, VaccinInHub*> &vaccins = fhubs[*hub]->getVaccins();
+            for (std::map<std::string, VaccinInHub*>::const_iterator it = vaccins.begin(); it != vaccins.end(); it++) {
+                fhubs[*hub]->distributeVaccinsFair(it->second, fcurrentDay, buffer);
+            }
+            ffair[*hub] = buffer.getEvents();
+        }
+    }
+};
+
+/**
+ * \brief Record the stock of the Hubs of one component and move the renewal trackers of their centra a day, for every
+ *        index, and buffer the events of every Hub
+ */
+class StockTask : public ThreadPool::Task {
+private:
+    const std::vector<Hub*> &fhubs; ///< Hubs of the Simulation
+    const Topology &ftopology; ///< Centra of every Hub
+    const std::vector<std::vector<int> > &fcomponents; ///< Indices of the Hubs of every component
+    std::vector<std::vector<EventSink::Event> > &fevents; ///< Events of every Hub
+    int fday; ///< Day of the events
+    bool fstock; ///< The stock is recorded, false when the sink drops it
+
+public:
+    StockTask(const std::vector<Hub*> &hubs, const Topology &topology,
+              const std::vector<std::vector<int> > &components,
+              std::vector<std::vector<EventSink::Event> > &events, int day, bool stock)
+            : fhubs(hubs), ftopology(topology), fcomponents(components), fevents(events), fday(day), fstock(stock) {}
+
+    void run(int index) {
+        const std::vector<int> &hubs = fcomponents[index];
+        for (std::vector<int>::const_iterator hub = hubs.begin(); hub != hubs.end(); hub++) {
+            EventBuffer buffer;
+            buffer.setDay(fday);
+            if (fstock) {
+                fhubs[*hub]->recordStock(buffer);
+            }
+            for (int edge = ftopology.beginCentra(*hub); edge < ftopology.endCentra(*hub); edge++) {
+                ftopology.getCenter(ftopology.getEdgeCenter(edge))->updateRenewal();
+            }
+            fevents[*hub] = buffer.getEvents();
+        }
+    }
+};
+
+/**
+ * \brief Record buffered events in the order of their buffers
+ *
+ * @param events Events of every Hub or VaccinationCenter
+ * @param sink Sink that records the events
+ */
+static void recordEvents(const std::vector<std::vector<EventSink::Event> > &events, EventSink &sink) {
+    for (std::vector<std::vector<EventSink::Event> >::const_iterator it = events.begin(); it != events.end(); it++) {
+        for (std::vector<EventSink::Event>::const_iterator ite = it->begin(); ite != it->end(); ite++) {
+            sink.record(*ite);
+        }
+    }
+}
+
 Simulation::Simulation() {
 
     fhub.clear();
+    farena = new Arena();
+    fjournal = new Journal();
+    fschedule = new DeliverySchedule();
+    ftopology = new Topology();
+    fthreads = ThreadPool::hardwareThreads();
+    fallocation = LoadAllocator::kWaterFilling;
+    fpool = NULL;
+    fcenterTable = new CenterTable();
+    fownsCenterTable = true;
     _initCheck = this;
     iter = 0;
+    fhistoryStart = 0;
 }
 
 Simulation::~Simulation() {
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
 
-    for(std::map<std::string, VaccinationCenter*>::iterator centra = fcentra.begin(); centra != fcentra.end(); centra++){
-        delete centra->second;
-    }
+    // The Hubs and centra of a copy are owned by the Arena of the Simulation it was copied from
     fcentra.clear();
+    fhub.clear();
+    delete farena;
+    while (!undoStack.empty()) {
+        delete undoStack.top();
+        undoStack.pop();
+    }
+    delete fjournal;
+    delete fschedule;
+    delete ftopology;
+    delete fpool;
+    if (fownsCenterTable) {
+        delete fcenterTable;
+    }
 }
 
 Simulation::Simulation(const Simulation &s) {
@@ -39,10 +184,24 @@ Simulation::Simulation(const Simulation &s) {
         }
         this->fcentra[it->first] = it->second;
     }
+    this->farena = new Arena();
     this->iter = s.getIter();
+    // The recorded days are not copied, the copy can only undo its own days
+    this->fhistoryStart = s.getIter();
+    this->fjournal = new Journal();
+    // The Hubs are shared and stay bound to the schedule of s, this schedule is built on the first day of the copy
+    this->fschedule = new DeliverySchedule();
+    this->fthreads = s.fthreads;
+    this->fallocation = s.fallocation;
+    this->fpool = NULL;
+    // The centra are shared, so are their values
+    this->fcenterTable = s.fcenterTable;
+    this->fownsCenterTable = false;
     this->_initCheck = this;
+    this->ftopology = new Topology(fcentra, fhub);
+    findComponents();
     ENSURE(properlyInitialized(), "Copy constructor must end in properlyInitialized state");
-    ENSURE(checkSimulation(), "The simulation must be valid/consistent");
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
     ENSURE(this->getIter() == s.getIter(), "Iter must be the same");
 }
 
@@ -69,12 +228,59 @@ void Simulation::importXmlFile(const char *path, const char *knownTagsPad, std::
     REQUIRE(FileExists(path), "The file that needs to be read must exist");
     REQUIRE(!FileIsEmpty(path), "The file that needs to be read must not be empty");
 
-    XMLReader xmlReader = XMLReader(path);
     std::string empty = "";
+    if (knownTagsPad != NULL && knownTagsPad != empty) {
+        TagSchema schema(knownTagsPad, errorStream);
+        readXmlFile(path, &schema, errorStream);
+    }
+    else {
+        readXmlFile(path, NULL, errorStream);
+    }
+    bindObjects();
+
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    ENSURE_FULL(checkVaccins(),"Hub must have equal amount of vaccins as delivery on day zero");
+}
+
+void Simulation::importXmlFile(const char *path, const TagSchema &schema, std::ostream &errorStream) {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE(FileExists(path), "The file that needs to be read must exist");
+    REQUIRE(!FileIsEmpty(path), "The file that needs to be read must not be empty");
+
+    readXmlFile(path, &schema, errorStream);
+    bindObjects();
 
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    ENSURE_FULL(checkVaccins(),"Hub must have equal amount of vaccins as delivery on day zero");
+}
+
+void Simulation::readXmlFile(const char *path, const TagSchema *schema, std::ostream &errorStream) {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+
+    // The topology of the objects that are read is built by bindObjects(), until then the simulation isn't connected
+    delete this->ftopology;
+    this->ftopology = new Topology();
+    // The objects of a previous import are replaced
+    releaseObjects();
+
+    // The file is scanned without building a TinyXML document and the tags are checked in the same scan, files that
+    // the XMLStreamReader does not support are read by the XMLReader, which gives the same result
+    XMLStreamReader streamReader(path, schema);
+    if (streamReader.isSupported()) {
+        streamReader.setArena(farena);
+        streamReader.acceptedTags(errorStream);
+        this->fcentra = streamReader.readVaccinationCenters(errorStream);
+        this->fhub = streamReader.readHubs(this->fcentra, errorStream);
+        return;
+    }
+
+    XMLReader xmlReader = XMLReader(path);
+    xmlReader.setArena(farena);
     try{
-        if(knownTagsPad != empty && knownTagsPad != NULL){
-            xmlReader.acceptedTags(errorStream, knownTagsPad);
+        if(schema != NULL){
+            xmlReader.acceptedTags(errorStream, *schema);
         }
         this->fcentra = xmlReader.readVaccinationCenters(errorStream);
         this->fhub = xmlReader.readHubs(this->fcentra, errorStream);
@@ -82,9 +288,97 @@ void Simulation::importXmlFile(const char *path, const char *knownTagsPad, std::
     catch (Exception ex) {
         throw Exception(ex.value());
     }
+}
+
+void Simulation::saveSnapshot(const std::string &path) const {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+
+    Snapshot snapshot;
+    snapshot.write(path, fhub, fcentra, iter, DayVaccinated);
+    ENSURE(FileExists(path), "Snapshot must be written");
+}
+
+void Simulation::loadSnapshot(const std::string &path) {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE(FileExists(path), "The snapshot that needs to be read must exist");
+    REQUIRE(getFcentra().empty() && getHub().empty() && getIter() == 0, "Simulation must be empty");
+
+    // The snapshot is checked before anything is built, so an invalid snapshot leaves the Simulation empty
+    Snapshot snapshot;
+    snapshot.setArena(farena);
+    snapshot.read(path, fhub, fcentra, iter, DayVaccinated);
+    while (!undoStack.empty()) {
+        delete undoStack.top();
+        undoStack.pop();
+    }
+    fhistoryStart = iter;
+    bindObjects();
+
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    ENSURE(getUndoStack().empty(), "undoStack must be empty");
+}
+
+std::string Simulation::getSnapshotData() const {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+
+    Snapshot snapshot;
+    return snapshot.encode(fhub, fcentra, iter, DayVaccinated);
+}
+
+void Simulation::loadSnapshotData(const std::string &data) {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE(getFcentra().empty() && getHub().empty() && getIter() == 0, "Simulation must be empty");
+
+    Snapshot snapshot;
+    snapshot.setArena(farena);
+    snapshot.decode(data, fhub, fcentra, iter, DayVaccinated);
+    while (!undoStack.empty()) {
+        delete undoStack.top();
+        undoStack.pop();
+    }
+    fhistoryStart = iter;
+    bindObjects();
+
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    ENSURE(getUndoStack().empty(), "undoStack must be empty");
+}
+
+void Simulation::bindObjects() {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
 
-    ENSURE(checkSimulation(), "The simulation must be valid/consistent");
-    ENSURE(checkVaccins(),"Hub must have equal amount of vaccins as delivery on day zero");
+    // Every Vaccin type gets its column before the centra are moved to the table, so no column is added later on
+    resetCenterTable();
+    for (std::vector<Hub*>::iterator it = fhub.begin(); it != fhub.end(); it++) {
+        for (std::map<std::string, VaccinInHub*>::const_iterator ite = (*it)->getVaccins().begin();
+             ite != (*it)->getVaccins().end(); ite++) {
+            fcenterTable->addType(ite->first);
+        }
+    }
+    for (std::map<std::string, VaccinationCenter*>::iterator it = fcentra.begin(); it != fcentra.end(); it++) {
+        it->second->bind(fcenterTable);
+    }
+
+    // Changes made by simulate() are recorded so they can be undone
+    for (std::map<std::string, VaccinationCenter*>::iterator it = fcentra.begin(); it != fcentra.end(); it++) {
+        it->second->setJournal(fjournal);
+    }
+    for (std::vector<Hub*>::iterator it = fhub.begin(); it != fhub.end(); it++) {
+        (*it)->setJournal(fjournal);
+        (*it)->setSchedule(fschedule);
+        (*it)->setAllocation(fallocation);
+        (*it)->bind(fcenterTable);
+    }
+    fschedule->invalidate();
+    delete ftopology;
+    ftopology = new Topology(fcentra, fhub);
+    findComponents();
 }
 
 const std::vector<Hub *> &Simulation::getHub() const {
@@ -93,7 +387,7 @@ const std::vector<Hub *> &Simulation::getHub() const {
     return fhub;
 }
 
-const std::stack<Simulation *> &Simulation::getUndoStack() const {
+const std::stack<Journal::Day *> &Simulation::getUndoStack() const {
 
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
     return undoStack;
@@ -129,28 +423,9 @@ bool Simulation::checkConnections() const {
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
     REQUIRE(checkHub(), "Hub must exist");
 
-    std::map<const std::string, bool> centraChecked;
-
-    // Check whether every VaccinationCenter is connected to an existing Hub in the simulation and vica versa
-    for (std::vector<Hub*>::const_iterator it = this->getHub().begin(); it != this->getHub().end(); it++) {
-
-        const std::map<std::string, VaccinationCenter*> hubCentra = (*it)->getCentra();
-
-        for (std::map<std::string, VaccinationCenter*>::const_iterator ite = hubCentra.begin(); ite != hubCentra.end(); ite++) {
-
-            if (this->fcentra.find(ite->first) == this->fcentra.end()) {
-                return false;
-            }
-            if (centraChecked.find(ite->first) == centraChecked.end()) {
-                centraChecked.insert(std::make_pair(ite->first, true));
-            }
-        }
-    }
-
-    if (centraChecked.size() != this->fcentra.size()) {
-        return false;
-    }
-    return true;
+    // The connections are checked once when the topology is built, a topology of other Hubs or centra isn't valid
+    return ftopology->getHubs() == static_cast<int>(fhub.size()) &&
+           ftopology->getCentra() == static_cast<int>(fcentra.size()) && ftopology->isConnected();
 }
 
 bool Simulation::checkSimulation() const {
@@ -166,35 +441,53 @@ bool Simulation::checkSimulation() const {
 void Simulation::exportFile(const std::string & path) const {
 
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
-    REQUIRE(checkSimulation(), "The simulation must be valid/consistent");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+
+    std::ofstream file;
+    file.open(path.c_str());
+    exportFile(file);
+    file.close();
+
+    ENSURE_FULL(FileExists(path), "File that has been written to must exist");
+    ENSURE(!FileIsEmpty(path), "File that has been written to must not be empty");
+}
+
+void Simulation::exportFile(std::ostream &stream) const {
 
-    std::ofstream exportFile;
-    exportFile.open(path.c_str());
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
 
     // Write hub data
     for (std::vector<Hub*>::const_iterator it = this->fhub.begin(); it != this->fhub.end(); it++) {
 
-        (*it)->print(exportFile);
+        (*it)->print(stream);
     }
 
     // Traverse VaccinationCenters
     for (std::map<std::string, VaccinationCenter*>::const_iterator it = fcentra.begin(); it != fcentra.end(); it++) {
 
-        it->second->print(exportFile);
+        it->second->print(stream);
     }
-    exportFile.close();
-
-    ENSURE(FileExists(path), "File that has been written to must exist");
-    ENSURE(!FileIsEmpty(path), "File that has been written to must not be empty");
 }
 
 void Simulation::generateIni(const std::string &path) const {
 
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
-    REQUIRE(checkSimulation(), "The simulation must be valid/consistent");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+
+    std::ofstream file;
+    file.open(path.c_str());
+    generateIni(file);
+    file.close();
+
+    ENSURE_FULL(FileExists(path), "File that has been written to must exist");
+    ENSURE(!FileIsEmpty(path), "File that has been written to must not be empty");
+}
 
-    std::ofstream ini;
-    ini.open(path.c_str());
+void Simulation::generateIni(std::ostream &ini) const {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
 
     // Write general data to string
     std::string x;
@@ -217,14 +510,11 @@ void Simulation::generateIni(const std::string &path) const {
     int pointCounter = 0; // Holds current point number
     std::string centerPoints; // Holds data for position points of centra
 
-    std::map<std::string, std::pair<double, double> > centerPositions;
-
-    // Traverse center and write to string
+    // Traverse center and write to string, the point of a center is its index in the topology
     int counterCenter = 1;
     for (std::map<std::string, VaccinationCenter*>::const_iterator it = this->fcentra.begin(); it != this->fcentra.end(); it++) {
 
         std::pair<double, double> itPosition = it->second->generateIni(ini, counterFigures, counterCenter, maxHubX);
-        centerPositions[it->first] = itPosition;
         // Write position data of center to string
         centerPoints.append("point" + ToString(pointCounter) + " = (" + ToString(itPosition.first) + ", ");
         centerPoints.append(ToString(itPosition.second) + ", 0)\n");
@@ -236,15 +526,15 @@ void Simulation::generateIni(const std::string &path) const {
     std::string hubPoints;
     std::string lines;
 
-    for (std::vector<Hub*>::const_iterator it = this->fhub.begin(); it != this->fhub.end(); it++) {
+    for (int hub = 0; hub < static_cast<int>(this->fhub.size()); hub++) {
 
         hubPoints.append("point" + ToString(pointCounter) + " = ");
-        hubPoints.append((*it)->generateIni(ini, counterFigures, counterHub));
+        hubPoints.append(fhub[hub]->generateIni(ini, counterFigures, counterHub));
         pointCounter++;
 
-        for (std::map<std::string, VaccinationCenter*>::const_iterator ite = (*it)->getCentra().begin(); ite != (*it)->getCentra().end(); ite++) {
+        for (int edge = ftopology->beginCentra(hub); edge < ftopology->endCentra(hub); edge++) {
 
-            int index = distance(centerPositions.begin(), centerPositions.find(ite->first));
+            int index = ftopology->getEdgeCenter(edge);
 
             lines.append("line" + ToString(lineCounter) + " = ");
             lines.append("(" + ToString(currentHub) + "," + ToString(index) + ")\n");
@@ -271,257 +561,438 @@ void Simulation::generateIni(const std::string &path) const {
 
     ini << x;
     x.clear();
-    ini.close();
-
-    ENSURE(FileExists(path), "File that has been written to must exist");
-    ENSURE(!FileIsEmpty(path), "File that has been written to must not be empty");
 }
 
-void Simulation::simulateTransport(int currentDay, std::ostream &stream) {
+Scene Simulation::generateScene() const {
 
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
-    REQUIRE(checkSimulation(), "The simulation must be valid/consistent");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
 
-    for (std::vector<Hub*>::iterator ite = this->fhub.begin(); ite != this->fhub.end(); ite++) {
+    // Same general data as the .ini file of generateIni
+    Scene scene(1024, Scene::Color(0.169, 0.169, 0.169), Scene::Vector3(200, 60, 70));
 
-        std::map<std::string, VaccinationCenter *> centra = (*ite)->getCentra();
-        for (std::map<std::string, VaccinationCenter *>::iterator it = centra.begin(); it != centra.end(); it++) {
-            (*ite)->distributeRequiredVaccins(it->second, stream);
-        }
+    // Position of every center by its index in the topology
+    std::vector<Scene::Vector3> centerPositions;
+    centerPositions.reserve(fcentra.size());
+    int counterCenter = 1;
+    for (std::map<std::string, VaccinationCenter*>::const_iterator it = this->fcentra.begin(); it != this->fcentra.end(); it++) {
+        centerPositions.push_back(it->second->generateScene(scene, counterCenter));
     }
 
-    for (std::vector<Hub*>::iterator ite = this->fhub.begin(); ite != this->fhub.end(); ite++) {
-        std::map<std::string, VaccinInHub*> vaccins = (*ite)->getVaccins();
-        for (std::map<std::string, VaccinInHub*>::iterator it = vaccins.begin(); it != vaccins.end(); it++) {
-            (*ite)->distributeVaccinsFair(it->second,currentDay, stream);
+    // Line drawing for all Hubs
+    scene.setLineColor(Scene::Color(0, 0.4, 1.0));
+    int counterHub = 0;
+    for (int hub = 0; hub < static_cast<int>(this->fhub.size()); hub++) {
+        Scene::Vector3 hubPosition = fhub[hub]->generateScene(scene, counterHub);
+        for (int edge = ftopology->beginCentra(hub); edge < ftopology->endCentra(hub); edge++) {
+            scene.addLine(hubPosition, centerPositions[ftopology->getEdgeCenter(edge)]);
         }
     }
+    return scene;
+}
+
+Image Simulation::render() const {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+
+    Renderer renderer;
+    return renderer.render(generateScene());
+}
 
-    ENSURE(checkSimulation(), "The simulation must be valid/consistent");
+void Simulation::simulateTransport(int currentDay, std::ostream &stream) {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+
+    TextSink text(stream);
+    text.setDay(currentDay);
+    simulateTransport(currentDay, text);
+}
+
+void Simulation::simulateTransport(int currentDay, EventSink &sink) {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+
+    // Components share no centra, so they are distributed at the same time. The events are recorded in the order of
+    // the Hubs: the transports for second shots of every Hub before the fair transports of every Hub.
+    std::vector<std::vector<EventSink::Event> > required(fhub.size());
+    std::vector<std::vector<EventSink::Event> > fair(fhub.size());
+    TransportTask task(fhub, *ftopology, fcomponents, required, fair, currentDay, sink.getDay());
+    threadPool().run(task, static_cast<int>(fcomponents.size()));
+    recordEvents(required, sink);
+    recordEvents(fair, sink);
+
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
 }
 
 void Simulation::simulateVaccination(std::ostream &stream) {
 
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
-    REQUIRE(checkSimulation(), "The simulation must be valid/consistent");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
 
-    // Traverse VaccinationCentra
-    for (std::map<std::string, VaccinationCenter*>::iterator it = fcentra.begin(); it != fcentra.end(); it++) {
+    TextSink text(stream);
+    text.setDay(iter);
+    simulateVaccination(text);
+}
+
+void Simulation::simulateVaccination(EventSink &sink) {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
 
-        // Vaccinate in center
-        it->second->vaccinateCenter(stream);
+    std::vector<VaccinationCenter*> centra;
+    centra.reserve(fcentra.size());
+    for (std::map<std::string, VaccinationCenter*>::iterator it = fcentra.begin(); it != fcentra.end(); it++) {
+        centra.push_back(it->second);
     }
 
+    // Vaccinate in centra
+    std::vector<std::vector<EventSink::Event> > events(centra.size());
+    VaccinationTask task(centra, events, sink.getDay());
+    threadPool().run(task, static_cast<int>(centra.size()));
+    recordEvents(events, sink);
+
     DayVaccinated[iter] = this->getVaccinated();
 
-    ENSURE(getDayVaccinated().find(getIter()) != getDayVaccinated().end(), "Day is not added to days/vaccinated data");
-    ENSURE(checkSimulation(), "The simulation must be valid/consistent");
+    ENSURE_FULL(getDayVaccinated().find(getIter()) != getDayVaccinated().end(), "Day is not added to days/vaccinated data");
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
 }
 
-void Simulation::increaseIterator() {
+void Simulation::setThreads(int threads) {
+
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
-    iter++;
-    ENSURE(this->getIter() > 0, "Iterator must be possitive");
+    REQUIRE(threads >= 1, "Amount of threads must be positive");
+
+    delete fpool;
+    fpool = NULL;
+    fthreads = threads;
+    ENSURE(getThreads() == threads, "Amount of threads is not set");
 }
 
-void Simulation::automaticSimulation(const int days, std::ostream &stream, bool exportFlag, bool ini) {
+int Simulation::getThreads() const {
 
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
-    REQUIRE(checkSimulation(), "The simulation must be valid/consistent");
-    REQUIRE(days >= 0, "Days can't be negative");
+    return fthreads;
+}
 
-    if (iter == 0) {
-        ENSURE(checkVaccins(),"Hub must have equal amount of vaccins as delivery on day zero");
-    }
+void Simulation::setAllocation(LoadAllocator::Mode mode) {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
 
-    for(std::map<std::string, VaccinationCenter*>::iterator it = fcentra.begin(); it != fcentra.end();it++){
-        REQUIRE(it->second->getVaccins() == 0 && it->second->getVaccinated() == 0,
-                "Amount of vaccins or amount of vaccinated in a center must be 0 at begin of simulation");
+    fallocation = mode;
+    for (std::vector<Hub*>::iterator it = fhub.begin(); it != fhub.end(); it++) {
+        (*it)->setAllocation(mode);
     }
+    ENSURE(getAllocation() == mode, "Allocation is not set");
+}
 
-    while (iter < days) {
-        for (std::vector<Hub*>::iterator it = fhub.begin(); it != fhub.end(); it++) {
+LoadAllocator::Mode Simulation::getAllocation() const {
 
-            Hub* currentHub = (*it);
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    return fallocation;
+}
 
-            for (std::map<std::string, VaccinInHub*>::iterator ite = currentHub->getVaccins().begin();
-                    ite != currentHub->getVaccins().end(); ite++) {
+ThreadPool &Simulation::threadPool() {
 
-                // Interval between deliveries is over
-                if (iter % ite->second->getInterval() == 0 && iter != 0) {
-                    ite->second->updateVaccins();
-                }
-            }
-        }
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
 
-        simulateTransport(iter, stream);
-        simulateVaccination(stream);
+    if (fpool == NULL) {
+        fpool = new ThreadPool(fthreads);
+    }
+    return *fpool;
+}
+
+void Simulation::findComponents() {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
 
-        for (std::vector<Hub*>::iterator ite = this->fhub.begin(); ite != this->fhub.end(); ite++) {
-            (*ite)->printGraphical(stream);
-            std::map<std::string, VaccinationCenter *> centra = (*ite)->getCentra();
-            for (std::map<std::string, VaccinationCenter*>::iterator it = centra.begin(); it != centra.end(); it++) {
-                it->second->updateRenewal();
+    // Union-find on the Hubs, every center joins the Hubs it is connected to
+    std::vector<int> parent(fhub.size());
+    for (unsigned int i = 0; i < fhub.size(); i++) {
+        parent[i] = i;
+    }
+    for (int center = 0; center < ftopology->getCentra(); center++) {
+        for (int edge = ftopology->beginHubs(center) + 1; edge < ftopology->endHubs(center); edge++) {
+            int a = ftopology->getEdgeHub(ftopology->beginHubs(center));
+            int b = ftopology->getEdgeHub(edge);
+            while (parent[a] != a) {
+                a = parent[a];
+            }
+            while (parent[b] != b) {
+                b = parent[b];
+            }
+            // The root is the first Hub of the component
+            if (a < b) {
+                parent[b] = a;
+            }
+            else {
+                parent[a] = b;
             }
         }
+    }
 
-        if (exportFlag) {
-            exportFile("Day-" + ToString(iter) + ".txt");
+    // Components in the order of their first Hub, with their Hubs in the order of fhub
+    fcomponents.clear();
+    std::vector<int> component(fhub.size(), -1);
+    for (unsigned int i = 0; i < fhub.size(); i++) {
+        int root = i;
+        while (parent[root] != root) {
+            root = parent[root];
         }
-        if (ini) {
-            generateIni("Day-" + ToString(iter) + ".ini");
+        if (component[root] == -1) {
+            component[root] = static_cast<int>(fcomponents.size());
+            fcomponents.push_back(std::vector<int>());
         }
-        increaseIterator();
+        fcomponents[component[root]].push_back(i);
     }
-    ENSURE(checkSimulation(), "The simulation must be valid/consistent");
-    ENSURE(this->getIter() >= days, "Total day can not be smaller then the simulated days!");
 }
 
-std::pair<std::string, std::string> Simulation::simulate() {
+const std::vector<std::vector<int> > &Simulation::getComponents() const {
+
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
-    REQUIRE(checkSimulation(), "The simulation must be valid/consistent");
-    REQUIRE(this->iter >= 0, "Days can't be negative");
+    return fcomponents;
+}
 
-    // Create copy of current simulation and push onto the stack
-    Simulation *s = new Simulation();
-    s->iter = this->iter;
-    s->undoStack = this->undoStack;
-    s->DayVaccinated = this->getDayVaccinated();
+const Topology &Simulation::getTopology() const {
 
-    for (std::map<std::string, VaccinationCenter*>::const_iterator it = this->getFcentra().begin(); it != this->getFcentra().end(); it++) {
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    return *ftopology;
+}
 
-        VaccinationCenter *v = new VaccinationCenter();
+const Arena &Simulation::getArena() const {
 
-        v->copyVaccinationCenter(it->second);
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    return *farena;
+}
+
+void Simulation::resetCenterTable() {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
 
-        s->fcentra.insert(std::make_pair(v->getName(), v));
+    if (fownsCenterTable) {
+        fcenterTable->clear();
+    }
+    else {
+        fcenterTable = new CenterTable();
+        fownsCenterTable = true;
     }
-    for (std::vector<Hub*>::const_iterator it = this->getHub().begin(); it != this->getHub().end(); it++) {
+    ENSURE(fcenterTable->getCenters() == 0, "CenterTable must be empty");
+}
+
+void Simulation::releaseObjects() {
 
-        Hub *h = new Hub();
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
 
-        h->copyHub((*it), s->fcentra);
+    // The Vaccins of the centra give their values back to fcenterTable when they are destroyed
+    fcentra.clear();
+    fhub.clear();
+    farena->clear();
+    ENSURE(getFcentra().empty() && getHub().empty(), "Hubs and centra must be removed");
+}
 
-        s->fhub.push_back(h);
+void Simulation::increaseIterator() {
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    iter++;
+    ENSURE(this->getIter() > 0, "Iterator must be possitive");
+}
+
+bool Simulation::isActive() const {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+
+    for (std::vector<Hub*>::const_iterator it = fhub.begin(); it != fhub.end(); it++) {
+        if ((*it)->isActive()) {
+            return true;
+        }
     }
-    undoStack.push(s);
+    for (std::map<std::string, VaccinationCenter*>::const_iterator it = fcentra.begin(); it != fcentra.end(); it++) {
+        if (it->second->isActive()) {
+            return true;
+        }
+    }
+    return false;
+}
 
-    for (std::vector<Hub*>::iterator it = fhub.begin(); it != fhub.end(); it++) {
+void Simulation::simulateDay(EventSink &sink) {
 
-        Hub* currentHub = (*it);
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
 
-        for (std::map<std::string, VaccinInHub*>::iterator ite = currentHub->getVaccins().begin();
-                ite != currentHub->getVaccins().end(); ite++) {
+    sink.setDay(iter);
+    // The schedule follows iter, it is built again after an undo, a loaded snapshot or a changed interval
+    if (!fschedule->isValid(iter)) {
+        fschedule->build(fhub, iter);
+    }
+    std::vector<VaccinInHub*> deliveries;
+    fschedule->takeDeliveries(iter, deliveries);
+    for (std::vector<VaccinInHub*>::iterator it = deliveries.begin(); it != deliveries.end(); it++) {
+        (*it)->updateVaccins();
+        sink.record(EventSink::delivery((*it)->getType(), (*it)->getVaccin()));
+    }
 
-            // Interval between deliveries is over
-            if (iter % ite->second->getInterval() == 0 && iter != 0) {
-                ite->second->updateVaccins();
-            }
+    // Stock only comes from deliveries, so until the next delivery a day without loads in the Hubs and without
+    // stock in the centra has no transports and no vaccinations. The stock and the renewal trackers still change.
+    if (!deliveries.empty() || isActive()) {
+        simulateTransport(iter, sink);
+        simulateVaccination(sink);
+    }
+    else {
+        DayVaccinated[iter] = this->getVaccinated();
+    }
+
+    std::vector<std::vector<EventSink::Event> > stock(fhub.size());
+    StockTask task(fhub, *ftopology, fcomponents, stock, sink.getDay(), sink.getLevel() >= EventSink::kStock);
+    threadPool().run(task, static_cast<int>(fcomponents.size()));
+    recordEvents(stock, sink);
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+}
+
+void Simulation::automaticSimulation(const int days, std::ostream &stream, bool exportFlag, bool ini, bool bmp,
+                                     DayArchive *archive) {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+
+    TextSink text(stream);
+    automaticSimulation(days, text, exportFlag, ini, bmp, archive);
+}
+
+void Simulation::automaticSimulation(const int days, EventSink &sink, bool exportFlag, bool ini, bool bmp,
+                                     DayArchive *archive) {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    REQUIRE(days >= 0, "Days can't be negative");
+
+    if (iter == 0) {
+        ENSURE_FULL(checkVaccins(),"Hub must have equal amount of vaccins as delivery on day zero");
+    }
+
+    // A simulation that is continued from a snapshot or a copy already has vaccins and vaccinated people
+    if (fhistoryStart == 0) {
+        for(std::map<std::string, VaccinationCenter*>::iterator it = fcentra.begin(); it != fcentra.end();it++){
+            REQUIRE_FULL(it->second->getVaccins() == 0 && it->second->getVaccinated() == 0,
+                    "Amount of vaccins or amount of vaccinated in a center must be 0 at begin of simulation");
         }
     }
-    std::stringstream ostream;
-    simulateTransport(iter, ostream);
-    simulateVaccination(ostream);
 
-    for (std::vector<Hub*>::iterator ite = this->fhub.begin(); ite != this->fhub.end(); ite++) {
-        (*ite)->printGraphical(ostream);
-        std::map<std::string, VaccinationCenter *> centra = (*ite)->getCentra();
-        for (std::map<std::string, VaccinationCenter*>::iterator it = centra.begin(); it != centra.end(); it++) {
-            it->second->updateRenewal();
+    while (iter < days) {
+        simulateDay(sink);
+
+        if (archive != NULL) {
+            archiveDay(*archive, iter, exportFlag, ini, bmp);
+        }
+        else {
+            if (exportFlag) {
+                exportFile("Day-" + ToString(iter) + ".txt");
+            }
+            if (ini) {
+                generateIni("Day-" + ToString(iter) + ".ini");
+            }
+            if (bmp) {
+                generateBmp("Day-" + ToString(iter) + ".bmp");
+            }
         }
+        increaseIterator();
     }
-    std::string path = "Day-" + ToString(iter) + ".ini";
-    generateIni(path);
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    ENSURE(this->getIter() >= days, "Total day can not be smaller then the simulated days!");
+}
 
-    increaseIterator();
-    std::string output = ostream.str();
-    ENSURE(checkSimulation(), "The simulation must be valid/consistent");
-    ENSURE(FileExists(path), "No ini file created");
-    ENSURE(undoStack.size() == iter, "Wrong history size");
-    return std::make_pair("Day-" + ToString((iter-1)) + ".ini", output);
+std::pair<std::string, std::string> Simulation::simulate(bool ini) {
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    REQUIRE(this->iter >= 0, "Days can't be negative");
+
+    std::ostringstream ostream;
+    TextSink text(ostream);
+    std::string path = simulate(text, ini);
+    return std::make_pair(path, ostream.str());
 }
 
-int Simulation::getVaccinated() const {
-    int vaccinated = 0;
+std::string Simulation::simulate(EventSink &sink, bool ini) {
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    REQUIRE(this->iter >= 0, "Days can't be negative");
 
-    for (std::map<std::string, VaccinationCenter*>::const_iterator it = fcentra.begin(); it != fcentra.end(); it++) {
-        vaccinated += it->second->getVaccinated();
+    // Record the old value of everything that changes today, the recorded day is pushed onto the stack
+    fjournal->startDay(this->iter, this->DayVaccinated);
+
+    simulateDay(sink);
+    std::string path;
+    if (ini) {
+        path = "Day-" + ToString(iter) + ".ini";
+        generateIni(path);
     }
 
-    return vaccinated;
+    undoStack.push(fjournal->endDay());
+    increaseIterator();
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    ENSURE_FULL(!ini || FileExists(path), "No ini file created");
+    ENSURE(undoStack.size() == iter - fhistoryStart, "Wrong history size");
+    return path;
+}
+
+int Simulation::getVaccinated() const {
+
+    return fcenterTable->getTotalVaccinated();
 }
 
 int Simulation::getVaccinatedPercent() const {
 
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
-    REQUIRE(checkSimulation(), "The simulation must be valid/consistent");
-
-    int vaccinated = 0;
-    int population = 0;
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
 
-    for (std::map<std::string, VaccinationCenter*>::const_iterator it = fcentra.begin(); it != fcentra.end(); it++) {
-        vaccinated += it->second->getVaccinated();
-        population += it->second->getPopulation();
-    }
+    int vaccinated = fcenterTable->getTotalVaccinated();
+    int population = fcenterTable->getTotalPopulation();
 
-    ENSURE(checkSimulation(), "The simulation must be valid/consistent");
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
     return ToPercent(vaccinated, population);
 }
 
 bool Simulation::undoSimulation() {
 
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
-    REQUIRE(checkSimulation(), "The simulation must be valid/consistent");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
 
     if (undoStack.empty()) {
         return false;
     }
 
-    this->iter = undoStack.top()->iter;
-
-    std::vector<Hub*> &hub = undoStack.top()->fhub;
-    std::map<std::string, VaccinationCenter*> &centra = undoStack.top()->fcentra;
-
-    this->fcentra.clear();
-    for (std::map<std::string, VaccinationCenter*>::const_iterator it = centra.begin(); it != centra.end(); it++) {
-
-        VaccinationCenter *v = new VaccinationCenter();
-        v->copyVaccinationCenter(it->second);
-        this->fcentra.insert(std::make_pair(v->getName(), v));
-    }
-    this->fhub.clear();
-    for (std::vector<Hub*>::const_iterator it = hub.begin(); it != hub.end(); it++) {
-
-        Hub *h = new Hub();
-        h->copyHub((*it), this->fcentra);
-        this->fhub.push_back(h);
-    }
-    this->DayVaccinated = undoStack.top()->getDayVaccinated();
+    Journal::Day *day = undoStack.top();
+    fjournal->rewind(day, this->DayVaccinated);
+    this->iter = day->iter;
     undoStack.pop();
-    ENSURE(checkSimulation(), "The simulation must be valid/consistent");
-    ENSURE(undoStack.size() == iter, "Wrong history size");
+    delete day;
+    ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    ENSURE(undoStack.size() == iter - fhistoryStart, "Wrong history size");
     return true;
 }
 
-void Simulation::clearSimulation(const bool clearStack) {
+void Simulation::clearSimulation() {
 
     REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
 
     this->iter = 0;
-    this->fcentra.clear();
-    this->fhub.clear();
+    this->fhistoryStart = 0;
+    releaseObjects();
+    resetCenterTable();
+    this->fcomponents.clear();
+    delete this->ftopology;
+    this->ftopology = new Topology();
+    this->fschedule->invalidate();
     this->DayVaccinated.clear();
-    if (clearStack) {
-        while(!undoStack.empty()){
-            delete undoStack.top();
-            undoStack.pop();
-        }
+    // The recorded days point to the objects that are released, so they can't be undone anymore
+    while (!undoStack.empty()) {
+        delete undoStack.top();
+        undoStack.pop();
     }
     ENSURE(getIter() == 0, "Iter must be zero");
     ENSURE(getFcentra().empty(), "Centra must be empty");
     ENSURE(getHub().empty(), "Hub must be empty");
     ENSURE(getDayVaccinated().empty(), "Day/Vaccinated must be empty");
-    ENSURE(!clearStack || getUndoStack().empty(), "undoStack must be empty");
+    ENSURE(getUndoStack().empty(), "undoStack must be empty");
 }
 
 std::map<const std::string, int> Simulation::getVaccinData() const {
@@ -540,15 +1011,40 @@ std::map<const std::string, int> Simulation::getVaccinData() const {
     return vaccinsData;
 }
 
-std::string Simulation::generateBmp(const std::string &path) const {
+void Simulation::generateBmp(const std::string &path) const {
+
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+
+    if (!render().writeBmp(path)) {
+        throw Exception("Could not write bmp: " + path);
+    }
+    ENSURE(FileExists(path), "BMP was not generated");
+}
 
-    REQUIRE(FileExists(path), ("Ini file not found: " + path).c_str());
-    REQUIRE(FileExists("./engine"), "engine not found");
+void Simulation::archiveDay(DayArchive &archive, int day, bool exportFlag, bool ini, bool bmp) const {
 
-    std::system(("./engine " + path).c_str());
-    std::string fileName = path.substr(0,  path.find("."));
-    ENSURE(FileExists(fileName + ".bmp"), "BMP was not generated");
-    return fileName + ".bmp";
+    REQUIRE(properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    REQUIRE(archive.isOpen(), "Archive must be open");
+    REQUIRE(day >= 0, "Day can't be negative");
+
+    if (exportFlag) {
+        std::ostringstream text;
+        exportFile(text);
+        archive.append(day, DayArchive::kText, text.str());
+    }
+    if (ini) {
+        std::ostringstream file;
+        generateIni(file);
+        archive.append(day, DayArchive::kIni, file.str());
+    }
+    if (bmp) {
+        std::ostringstream image(std::ios::out | std::ios::binary);
+        render().writeBmp(image);
+        archive.append(day, DayArchive::kBmp, image.str());
+    }
+    ENSURE(!bmp || archive.contains(day, DayArchive::kBmp), "Day is not archived");
 }
 
 const std::map<int, int> Simulation::getDayVaccinated() const {
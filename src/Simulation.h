@@ -17,10 +17,23 @@
 #include <ctime>
 #include <unistd.h>
 #include "XMLReader.h"
+#include "XMLStreamReader.h"
+#include "Snapshot.h"
+#include "Scene.h"
+#include "Renderer.h"
+#include "Image.h"
+#include "DayArchive.h"
+#include "EventSink.h"
 #include "DesignByContract.h"
 #include "Utils.h"
 #include "VaccinationCenter.h"
 #include "Hub.h"
+#include "Journal.h"
+#include "ThreadPool.h"
+#include "CenterTable.h"
+#include "DeliverySchedule.h"
+#include "Topology.h"
+#include "Arena.h"
 
 /**
  * Class used to holds the simulation of different VaccinationCenters and Hubs
@@ -30,8 +43,19 @@ class Simulation {
 private:
     std::map<std::string, VaccinationCenter*> fcentra; ///< vector with pointers to VaccinationCenter
     std::vector<Hub*> fhub; ///< Vector containing pointers to Hub object
+    Arena *farena; ///< Owner of the Hubs and centra that are imported, a copy owns none of the objects it shares
+    Topology *ftopology; ///< Connections between fhub and fcentra, built when the simulation is imported
+    std::vector<std::vector<int> > fcomponents; ///< Indices in fhub of the Hubs of every connected component
     int iter;               ///< Iterator that holds the amount of iterations in the Simulation
-    std::stack<Simulation*> undoStack; ///< Stack that holds the previous simulations
+    std::stack<Journal::Day*> undoStack; ///< Stack that holds the recorded changes of the previous days
+    int fhistoryStart; ///< Iterator of the oldest day that can be undone, the day of a loaded snapshot
+    Journal *fjournal; ///< Journal that records the changes of simulate() for undoSimulation()
+    DeliverySchedule *fschedule; ///< Next deliveries of the Vaccins, built again when it isn't valid for iter
+    int fthreads; ///< Amount of threads used to vaccinate the centra and to simulate the components
+    LoadAllocator::Mode fallocation; ///< Way the Hubs divide their loads over the centra
+    ThreadPool *fpool; ///< Threads of the Simulation, started on first use
+    CenterTable *fcenterTable; ///< Values of the centra, every VaccinationCenter is a row
+    bool fownsCenterTable; ///< fcenterTable is deleted with the Simulation, false when it is shared with a copy
     Simulation *_initCheck;
     std::map<int, int> DayVaccinated;
 
@@ -46,6 +70,81 @@ private:
      */
     void increaseIterator();
 
+    /**
+     * \brief Remove every VaccinationCenter from fcenterTable, a table shared with a copy is left to the copy
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     *
+     * @post
+     * ENSURE(fcenterTable->getCenters() == 0, "CenterTable must be empty")
+     */
+    void resetCenterTable();
+
+    /**
+     * \brief Remove the Hubs and centra and destroy the objects of farena, before fcenterTable is reset
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     *
+     * @post
+     * ENSURE(getFcentra().empty() && getHub().empty(), "Hubs and centra must be removed")
+     */
+    void releaseObjects();
+
+    /**
+     * \brief Move the imported centra to fcenterTable and record the changes of the Hubs and centra in fjournal
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     */
+    void bindObjects();
+
+    /**
+     * \brief Divide the Hubs in connected components, Hubs that share a VaccinationCenter are in the same component
+     *
+     * Hubs of different components share no centra, so their transports, stock and renewals don't change each other
+     * and the components can be simulated at the same time.
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     */
+    void findComponents();
+
+    /**
+     * \brief Get the ThreadPool that simulates the components and vaccinates the centra, started on first use
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     */
+    ThreadPool &threadPool();
+
+    /**
+     * \brief Read the Hubs and centra of a .xml file, the XMLStreamReader is used when it supports the file
+     *
+     * @param path The path to the .xml file that needs to read from
+     * @param schema Allowed tags of the .xml file, NULL when the tags are not checked
+     * @param errorStream Output-stream for errors
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     */
+    void readXmlFile(const char *path, const TagSchema *schema, std::ostream &errorStream);
+
+    /**
+     * \brief Simulate the deliveries, transports and vaccinations of the current day without increasing the iterator
+     *
+     * @param sink Sink for the events of the day, its day is set to the current day
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     *
+     * @post
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     */
+    void simulateDay(EventSink &sink);
+
 public:
     /**
      * \brief Default constructor for a Simulation object
@@ -73,7 +172,7 @@ public:
      *
      * @post
      * ENSURE(properlyInitialized(), "Copy constructor must end in properlyInitialized state")
-     * ENSURE(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
      * ENSURE(this->getIter() == s.getIter(), "Iter must be the same");
      */
     Simulation(const Simulation &s);
@@ -121,9 +220,9 @@ public:
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
      *
-     * @return Stack containing all the previous Simulations
+     * @return Stack containing the recorded changes of all the previous days
      */
-    const std::stack<Simulation *> &getUndoStack() const;
+    const std::stack<Journal::Day *> &getUndoStack() const;
 
     /**
      * \brief Imports a vaccin distribution simulation from a .xml file
@@ -138,11 +237,89 @@ public:
      * REQUIRE(!FileIsEmpty(path), "The file that needs to be read must not be empty")
      *
      * @post
-     * ENSURE(checkSimulation(), "The simulation must be valid/consistent")
-     * ENSURE(checkVaccins(),"Hub must have equal amount of vaccins as delivery on day zero")
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE_FULL(checkVaccins(),"Hub must have equal amount of vaccins as delivery on day zero")
      */
     void importXmlFile(const char* path,const char *knownTagsPad="", std::ostream &errorStream = std::cerr);
 
+    /**
+     * \brief Imports a vaccin distribution simulation from a .xml file and checks its tags, the tags are checked while
+     *        the file is read
+     *
+     * @param path The path to the .xml file that needs to read from
+     * @param schema Allowed tags of the .xml file, the same schema can be used for any number of files
+     * @param errorStream Output-stream for errors, std = std::cerr
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE(FileExists(path), "The file that needs to be read must exist")
+     * REQUIRE(!FileIsEmpty(path), "The file that needs to be read must not be empty")
+     *
+     * @post
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE_FULL(checkVaccins(),"Hub must have equal amount of vaccins as delivery on day zero")
+     */
+    void importXmlFile(const char* path, const TagSchema &schema, std::ostream &errorStream = std::cerr);
+
+    /**
+     * \brief Write the Hubs, centra and the state of the simulated days to a snapshot, see Snapshot
+     *
+     * @param path Path of the snapshot, throws an Exception when it can't be written
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     *
+     * @post
+     * ENSURE(FileExists(path), "Snapshot must be written")
+     */
+    void saveSnapshot(const std::string &path) const;
+
+    /**
+     * \brief Load the Hubs, centra and the state of the simulated days from a snapshot, the simulation continues on
+     *        the day the snapshot was written, earlier days can't be undone
+     *
+     * @param path Path of the snapshot, throws an Exception when it is not a valid snapshot
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE(FileExists(path), "The snapshot that needs to be read must exist")
+     * REQUIRE(getFcentra().empty() && getHub().empty() && getIter() == 0, "Simulation must be empty")
+     *
+     * @post
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE(getUndoStack().empty(), "undoStack must be empty")
+     */
+    void loadSnapshot(const std::string &path);
+
+    /**
+     * \brief Give the bytes of a snapshot of the Simulation without writing a file, a cheap copy of the Hubs and centra
+     *        that can be loaded by loadSnapshotData() as often as needed
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     *
+     * @return Bytes of the snapshot
+     */
+    std::string getSnapshotData() const;
+
+    /**
+     * \brief Load the Hubs, centra and the state of the simulated days from the bytes of getSnapshotData(), like
+     *        loadSnapshot()
+     *
+     * @param data Bytes of the snapshot, throws an Exception when they are not a valid snapshot
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE(getFcentra().empty() && getHub().empty() && getIter() == 0, "Simulation must be empty")
+     *
+     * @post
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE(getUndoStack().empty(), "undoStack must be empty")
+     */
+    void loadSnapshotData(const std::string &data);
+
     /**
      * \brief Check if all Hubs have an equal amount of vaccins to their respective amount of deliveries of each Vaccin
      *
@@ -175,7 +352,8 @@ public:
 
     /**
      * \brief Check whether every VaccinationCenter is connected to a Hub and
-     *        every connection from a Hub to a VaccinationCenter is valid
+     *        every connection from a Hub to a VaccinationCenter is valid, the connections are checked when the
+     *        topology is built on import
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
@@ -204,7 +382,7 @@ public:
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
-     * REQUIRE(checkSimulation(), "The simulation must be valid/consistent")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
      *
      * @post
      * ENSURE(FileExists(), "File that has been written to must exist")
@@ -213,6 +391,17 @@ public:
      */
     void exportFile(const std::string & path) const;
 
+    /**
+     * \brief Write all the information of the Simulation to a stream, in the format of exportFile
+     *
+     * @param stream Output-stream
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     */
+    void exportFile(std::ostream &stream) const;
+
     /**
      * \brief Generate a .ini file of the current situation the Simulation is in
      *
@@ -220,7 +409,7 @@ public:
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
-     * REQUIRE(checkSimulation(), "The simulation must be valid/consistent")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
      *
      * @post
      * ENSURE(FileExists(), "File that has been written to must exist")
@@ -229,19 +418,71 @@ public:
     void generateIni(const std::string & path) const;
 
     /**
-     * \brief Generate a .bmp file of the given ini file unsing a grapic engine
+     * \brief Write the .ini file of the current situation the Simulation is in to a stream, see generateIni
      *
-     * @param path The path of the ini file
+     * @param ini Output-stream
      *
-     * @return path of bmp file
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     */
+    void generateIni(std::ostream &ini) const;
+
+    /**
+     * \brief Build a Scene of the current situation the Simulation is in, with the figures of generateIni
      *
      * @pre
-     * REQUIRE(FileExists(path), "Ini file not found")
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     *
+     * @return The Scene
+     */
+    Scene generateScene() const;
+
+    /**
+     * \brief Draw the current situation the Simulation is in, without writing a .ini file or starting the engine
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     *
+     * @return The Image
+     */
+    Image render() const;
+
+    /**
+     * \brief Generate a .bmp file of the current situation the Simulation is in, see render
+     *
+     * @param path The path of the .bmp file, throws an Exception when it can't be written
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
      *
      * @post
-     * ENSURE(FileExists(), "File that has been written to must exist")
+     * ENSURE(FileExists(path), "BMP was not generated")
+     */
+    void generateBmp(const std::string & path) const;
+
+    /**
+     * \brief Append the files of a day to an archive, with the data of exportFile, generateIni and generateBmp
+     *
+     * @param archive The archive, throws an Exception when it can't be written
+     * @param day Day of the files
+     * @param exportFlag Archive the data of the Hubs and VaccinationCenters
+     * @param ini Archive the .ini file
+     * @param bmp Archive the drawing
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * REQUIRE(archive.isOpen(), "Archive must be open")
+     * REQUIRE(day >= 0, "Day can't be negative")
+     *
+     * @post
+     * ENSURE(!bmp || archive.contains(day, DayArchive::kBmp), "Day is not archived")
      */
-    std::string generateBmp(const std::string & path) const;
+    void archiveDay(DayArchive &archive, int day, bool exportFlag, bool ini, bool bmp) const;
 
     /**
      * \brief Simulate transport of vaccins between Hub and centra
@@ -251,28 +492,145 @@ public:
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
-     * REQUIRE(checkSimulation(), "The simulation must be valid/consistent")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
      *
      * @post
-     * ENSURE(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
      */
     void simulateTransport(int currentDay, std::ostream &stream);
 
+    /**
+     * \brief Simulate transport of vaccins between Hub and centra and record the transports, the connected components of
+     *        the Hubs are distributed on the threads of the Simulation
+     *
+     * @param currentDay Current day of simulation
+     * @param sink Sink for the transports
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     *
+     * @post
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     */
+    void simulateTransport(int currentDay, EventSink &sink);
+
     /**
     * \brief Simulate vaccination in centra, and update day numbers
     *
+    * Every VaccinationCenter only changes its own data, so the centra are vaccinated on several threads. The output of
+    * each VaccinationCenter is buffered and written in the order of the names of the centra.
+    *
     * @param stream Output-stream
     *
     * @pre
     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
-    * REQUIRE(checkSimulation(), "The simulation must be valid/consistent")
+    * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
     *
     * @post
-    * ENSURE(getDayVaccinated().find(getIter()) != getDayVaccinated().end(), "Day is not added to days/vaccinated data");
-    * ENSURE(checkSimulation(), "The simulation must be valid/consistent");
+    * ENSURE_FULL(getDayVaccinated().find(getIter()) != getDayVaccinated().end(), "Day is not added to days/vaccinated data");
+    * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
     */
     void simulateVaccination(std::ostream &stream);
 
+    /**
+    * \brief Simulate vaccination in centra and record the vaccinations, the events of every VaccinationCenter are
+    *        buffered and recorded in the order of the names of the centra
+    *
+    * @param sink Sink for the vaccinations, the events get the day of the sink
+    *
+    * @pre
+    * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+    * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+    *
+    * @post
+    * ENSURE_FULL(getDayVaccinated().find(getIter()) != getDayVaccinated().end(), "Day is not added to days/vaccinated data");
+    * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
+    */
+    void simulateVaccination(EventSink &sink);
+
+    /**
+     * \brief Check if a Hub can transport a Vaccin or a VaccinationCenter has to be vaccinated
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     *
+     * @return true when a day without deliveries has transports or vaccinations
+     */
+    bool isActive() const;
+
+    /**
+     * \brief Set amount of threads used to vaccinate the centra and to simulate the components of the Hubs
+     *
+     * @param threads Amount of threads, 1 simulates everything on the calling thread
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE(threads >= 1, "Amount of threads must be positive")
+     *
+     * @post
+     * ENSURE(getThreads() == threads, "Amount of threads is not set")
+     */
+    void setThreads(int threads);
+
+    /**
+     * \brief Get amount of threads used to vaccinate the centra and to simulate the components of the Hubs
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     *
+     * @return Amount of threads as int
+     */
+    int getThreads() const;
+
+    /**
+     * \brief Set the way the Hubs divide their loads over the centra, every mode gives the same simulation
+     *
+     * @param mode LoadAllocator::kWaterFilling (default) or LoadAllocator::kSequential, the one load at a time
+     *             distribution of older versions
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     *
+     * @post
+     * ENSURE(getAllocation() == mode, "Allocation is not set")
+     */
+    void setAllocation(LoadAllocator::Mode mode);
+
+    /**
+     * \brief Get the connected components of the Hubs, found when the simulation is imported
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     *
+     * @return Indices in getHub() of the Hubs of every component, components in the order of their first Hub
+     */
+    const std::vector<std::vector<int> > &getComponents() const;
+
+    /**
+     * \brief Get the connections between the Hubs and centra, built when the simulation is imported
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     */
+    const Topology &getTopology() const;
+
+    /**
+     * \brief Get the Arena that owns the imported Hubs and centra
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     */
+    const Arena &getArena() const;
+
+    /**
+     * \brief Get the way the Hubs divide their loads over the centra
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     */
+    LoadAllocator::Mode getAllocation() const;
+
     /**
      * \brief Simulation for amount of days
      *
@@ -280,47 +638,102 @@ public:
      * @param stream Output-stream
      * @param export Export a file with data every day
      * @param ini Export a .ini file every day
+     * @param bmp Export a .bmp file every day, drawn by render
+     * @param archive Archive for the exported files, a Day-<n> file is written for every file when it is NULL
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE_FULL(checkVaccins(),"Hub must have equal amount of vaccins as delivery on day zero")
+     * REQUIRE(days >= 0, "Days can't be negative");
+     * REQUIRE_FULL(it->second->getVaccins() == 0 && it->second->getVaccinated() == 0,
+                "Amount of vaccins or amount of vaccinated in a center must be 0 at begin of the simulation"),
+                not for a simulation that is continued from a snapshot or a copy
+     *
+     * @post
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE(this->getIter() >= days, "Total day can not be smaller then the simulated days!");
+     */
+    void automaticSimulation(int days, std::ostream &stream, bool exportFlag, bool ini, bool bmp = false,
+                             DayArchive *archive = NULL);
+
+    /**
+     * \brief Simulation for amount of days, the events of every day are recorded in a sink
+     *
+     * The text of automaticSimulation(int, std::ostream &, ...) is written by a TextSink, a NullSink simulates without
+     * formatting any output.
+     *
+     * @param days Amount of days needed to be simulated
+     * @param sink Sink for the events of every day
+     * @param export Export a file with data every day
+     * @param ini Export a .ini file every day
+     * @param bmp Export a .bmp file every day, drawn by render
+     * @param archive Archive for the exported files, a Day-<n> file is written for every file when it is NULL
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
-     * REQUIRE(checkSimulation(), "The simulation must be valid/consistent")
-     * ENSURE(checkVaccins(),"Hub must have equal amount of vaccins as delivery on day zero")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE_FULL(checkVaccins(),"Hub must have equal amount of vaccins as delivery on day zero")
      * REQUIRE(days >= 0, "Days can't be negative");
-     * REQUIRE(it->second->getVaccins() == 0 && it->second->getVaccinated() == 0,
-                "Amount of vaccins or amount of vaccinated in a center must be 0 at begin of the simulation")
+     * REQUIRE_FULL(it->second->getVaccins() == 0 && it->second->getVaccinated() == 0,
+                "Amount of vaccins or amount of vaccinated in a center must be 0 at begin of the simulation"),
+                not for a simulation that is continued from a snapshot or a copy
      *
      * @post
-     * ENSURE(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
      * ENSURE(this->getIter() >= days, "Total day can not be smaller then the simulated days!");
      */
-    void automaticSimulation(int days, std::ostream &stream, bool exportFlag, bool ini);
+    void automaticSimulation(int days, EventSink &sink, bool exportFlag, bool ini, bool bmp = false,
+                             DayArchive *archive = NULL);
 
     /**
      * \brief Simulate for one day and generate .ini file
      *
+     * @param ini Generate the .ini file, the image of the day can be drawn by render without it
+     *
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
-     * REQUIRE(checkSimulation(), "The simulation must be valid/consistent")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
      * REQUIRE(this->iter >= 0, "Days can't be negative")
      *
      * @post
-     * ENSURE(checkSimulation(), "The simulation must be valid/consistent")
-     * ENSURE(FileExists(path), "No ini file created");
-     * ENSURE(undoStack.size() == iter, "Wrong history size");
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE_FULL(!ini || FileExists(path), "No ini file created");
+     * ENSURE(undoStack.size() == iter - fhistoryStart, "Wrong history size");
      *
-     * @return Pair of strings <Name of .ini file, output stream>
+     * @return Pair of strings <Name of .ini file, output stream>, the name is empty when no .ini file is generated
      */
-    std::pair<std::string, std::string> simulate();
+    std::pair<std::string, std::string> simulate(bool ini = true);
+
+    /**
+     * \brief Simulate for one day, record the events of the day in a sink and generate .ini file
+     *
+     * @param sink Sink for the events of the day
+     * @param ini Generate the .ini file
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * REQUIRE(this->iter >= 0, "Days can't be negative")
+     *
+     * @post
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE_FULL(!ini || FileExists(path), "No ini file created");
+     * ENSURE(undoStack.size() == iter - fhistoryStart, "Wrong history size");
+     *
+     * @return Name of the .ini file, empty when no .ini file is generated
+     */
+    std::string simulate(EventSink &sink, bool ini = false);
 
     /**
      * /brief Get total amount of persons vaccinated of all centra
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
-     * REQUIRE(checkSimulation(), "The simulation must be valid/consistent")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
      *
      * @post
-     * ENSURE(checkSimulation(), "The simulation must be valid/consistent");
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
      *
      * @return total
      * */
@@ -331,34 +744,32 @@ public:
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
-     * REQUIRE(checkSimulation(), "The simulation must be valid/consistent")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
      *
      * @post
-     * ENSURE(checkSimulation(), "The simulation must be valid/consistent");
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent");
      *
      * @return total in percent
      */
     int getVaccinatedPercent() const;
 
     /**
-     * \brief Undo the simulation one day
+     * \brief Undo the simulation one day by putting back the old values of the changes recorded on that day
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
-     * REQUIRE(checkSimulation(), "The simulation must be valid/consistent")
+     * REQUIRE_FULL(checkSimulation(), "The simulation must be valid/consistent")
      *
      * @post
-     * ENSURE(checkSimulation(), "The simulation must be valid/consistent")
-     * ENSURE(undoStack.size() == iter, "Wrong history size");
+     * ENSURE_FULL(checkSimulation(), "The simulation must be valid/consistent")
+     * ENSURE(undoStack.size() == iter - fhistoryStart, "Wrong history size");
      *
      * @return False if undoStack is empty, true if undo is success
      */
     bool undoSimulation();
 
     /**
-     * \brief Clear simulation
-     *
-     * @param clearStack Clear undoStack with previous versions
+     * \brief Clear simulation, the recorded changes of the previous days are cleared with the objects they change
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
@@ -368,9 +779,9 @@ public:
      * ENSURE(getFcentra().empty(), "Centra must be empty");
      * ENSURE(getHub().empty(), "Hub must be empty");
      * ENSURE(getDayVaccinated().empty(), "Day/Vaccinated must be empty");
-     * ENSURE(!clearStack || getUndoStack().empty(), "undoStack must be empty");
+     * ENSURE(getUndoStack().empty(), "undoStack must be empty");
      */
-    void clearSimulation(const bool clearStack);
+    void clearSimulation();
 
     /**
      * \brief Get for each Vaccin in simulation total amount delivered Vaccins
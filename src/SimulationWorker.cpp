@@ -0,0 +1,117 @@
+/**
+ * @file SimulationWorker.cpp
+ * @brief This file contains the definitions of the members of the SimulationWorker class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include <QElapsedTimer>
+#include <QMutexLocker>
+#include "SimulationWorker.h"
+
+SimulationWorker::SimulationWorker(Simulation *simulation, int days, int delay, DayArchive *archive) :
+    fsimulation(simulation), fdays(days), fdelay(delay), farchive(archive), fpaused(false), fpause(0), fstopped(false)
+{
+    REQUIRE(simulation->properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE(days >= 0 && delay >= 0, "Days and delay can't be negative");
+
+    // Needed to copy a DayResult into the queued connection
+    qRegisterMetaType<SimulationWorker::DayResult>("SimulationWorker::DayResult");
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+}
+
+bool SimulationWorker::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+int SimulationWorker::setPaused(bool paused) {
+
+    REQUIRE(properlyInitialized(), "SimulationWorker object must be properly initialized");
+
+    QMutexLocker locker(&fmutex);
+    if (paused && !fpaused) {
+        fpause++;
+    }
+    fpaused = paused;
+    fchanged.wakeAll();
+    return fpause;
+}
+
+void SimulationWorker::stop() {
+
+    REQUIRE(properlyInitialized(), "SimulationWorker object must be properly initialized");
+
+    QMutexLocker locker(&fmutex);
+    fstopped = true;
+    fchanged.wakeAll();
+}
+
+bool SimulationWorker::waitForNextDay(unsigned long delay) {
+
+    QMutexLocker locker(&fmutex);
+
+    QElapsedTimer timer;
+    timer.start();
+    int announced = 0;
+    while (!fstopped) {
+        unsigned long elapsed = static_cast<unsigned long>(timer.elapsed());
+        if (fpaused) {
+            // The connection is queued, so the MainWindow gets the signal after the mutex is released
+            if (announced != fpause) {
+                announced = fpause;
+                emit paused(fpause);
+            }
+            fchanged.wait(&fmutex);
+        }
+        else if (elapsed < delay) {
+            fchanged.wait(&fmutex, delay - elapsed);
+        }
+        else {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SimulationWorker::run() {
+
+    REQUIRE(properlyInitialized(), "SimulationWorker object must be properly initialized");
+
+    // The first day starts at once, unless the simulation is paused
+    unsigned long delay = 0;
+    for (int i = 0; i < fdays && waitForNextDay(delay); i++) {
+        delay = static_cast<unsigned long>(fdelay) * 1000;
+        try {
+            DayResult result;
+            result.log = QString::fromStdString(fsimulation->simulate(false).second);
+            result.day = fsimulation->getIter();
+
+            // The QImage uses the pixels of the Image, the copy owns its pixels
+            Image image = fsimulation->render();
+            result.image = QImage(image.getPixels(), image.getWidth(), image.getHeight(), image.getWidth() * 3,
+                                  QImage::Format_RGB888).copy();
+            if (farchive != nullptr) {
+                std::ostringstream bmp(std::ios::out | std::ios::binary);
+                image.writeBmp(bmp);
+                try {
+                    farchive->append(result.day - 1, DayArchive::kBmp, bmp.str());
+                }
+                catch (Exception ex) {
+                    // A day that is not in the archive is drawn again by the previous button
+                }
+            }
+            result.vaccinatedPercent = fsimulation->getVaccinatedPercent();
+            result.vaccinData = fsimulation->getVaccinData();
+            result.dayVaccinated = fsimulation->getDayVaccinated();
+            emit dayFinished(result);
+        }
+        catch (Exception ex) {
+            emit failed(QString::fromStdString(ex.value()));
+            break;
+        }
+    }
+
+    emit finished();
+}
@@ -0,0 +1,151 @@
+/**
+ * @file SimulationWorker.h
+ * @brief This header file contains the declarations and the members of the SimulationWorker class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef SIMULATIONWORKER_H
+#define SIMULATIONWORKER_H
+
+#include <QObject>
+#include <QString>
+#include <QImage>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QMetaType>
+#include <map>
+#include <string>
+#include "Simulation.h"
+
+/**
+ * @brief Class implemented to run the automatic simulation of the MainWindow on its own QThread
+ *
+ * The worker simulates and draws every day and sends the result of the day with the dayFinished signal. The
+ * connection to the MainWindow is queued, so the MainWindow only updates its widgets on the GUI thread. Between two
+ * days the worker waits on a QWaitCondition for the delay, for the end of a pause or for stop(). A pause doesn't wait
+ * for the day that is simulated, the worker sends paused when it stops between two days.
+ */
+class SimulationWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Result of one simulated day, a copy that doesn't change when the Simulation goes on
+     */
+    struct DayResult {
+        int day; ///< Day that was simulated
+        QString log; ///< Output of the day
+        QImage image; ///< Drawing of the Simulation after the day
+        int vaccinatedPercent; ///< Percentage of the population that is vaccinated
+        std::map<const std::string, int> vaccinData; ///< Total delivered vaccins of every type
+        std::map<int, int> dayVaccinated; ///< Vaccinated people of every day
+    };
+
+    /**
+     * @brief Constructor for a SimulationWorker object
+     *
+     * @param simulation Simulation to simulate, must not be used by other threads while the worker runs
+     * @param days Amount of days to simulate
+     * @param delay Seconds between two days
+     * @param archive Archive for the image of every day, nullptr when the images are not kept
+     *
+     * @pre
+     * REQUIRE(simulation->properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE(days >= 0 && delay >= 0, "Days and delay can't be negative")
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     */
+    SimulationWorker(Simulation *simulation, int days, int delay, DayArchive *archive = nullptr);
+
+    /**
+     * @brief Check if SimulationWorker object is correctly inialized
+     *
+     * @return true if success
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * @brief Pause or continue the simulation, returns at once. The Simulation can be read from paused with the
+     *        number of the pause until the simulation continues
+     *
+     * @param paused true to pause, false to continue
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "SimulationWorker object must be properly initialized")
+     *
+     * @return Number of the pause, the number of the last pause when the simulation continues
+     */
+    int setPaused(bool paused);
+
+    /**
+     * @brief Stop the simulation after the current day, finished is sent when the worker stops
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "SimulationWorker object must be properly initialized")
+     */
+    void stop();
+
+public slots:
+    /**
+     * @brief Simulate the days, runs on the thread of the worker
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "SimulationWorker object must be properly initialized")
+     */
+    void run();
+
+signals:
+    /**
+     * @brief Sent after every simulated day
+     *
+     * @param result Result of the day
+     */
+    void dayFinished(const SimulationWorker::DayResult &result);
+
+    /**
+     * @brief Sent when a day can't be simulated, the worker stops after it
+     *
+     * @param message Message of the Exception
+     */
+    void failed(const QString &message);
+
+    /**
+     * @brief Sent when the worker is paused between two days, it doesn't use the Simulation until it continues
+     *
+     * @param pause Number of the pause given by setPaused
+     */
+    void paused(int pause);
+
+    /**
+     * @brief Sent when the worker stops
+     */
+    void finished();
+
+private:
+    Simulation *fsimulation;
+    int fdays;
+    int fdelay;
+    DayArchive *farchive;
+    QMutex fmutex; ///< Guards fpaused, fpause and fstopped
+    QWaitCondition fchanged; ///< Wakes the worker on setPaused() and stop()
+    bool fpaused;
+    int fpause; ///< Number of the last pause
+    bool fstopped;
+    SimulationWorker *_initCheck;
+
+    /**
+     * @brief Wait for the delay after a day and for the end of a pause
+     *
+     * @param delay Milliseconds to wait
+     *
+     * @return false when the worker is stopped
+     */
+    bool waitForNextDay(unsigned long delay);
+};
+
+Q_DECLARE_METATYPE(SimulationWorker::DayResult)
+
+#endif // SIMULATIONWORKER_H
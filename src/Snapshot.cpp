@@ -0,0 +1,496 @@
+/**
+ * @file Snapshot.cpp
+ * @brief This file contains the definitions of the members of the Snapshot class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "Snapshot.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Vaccin.h"
+#include "CenterTable.h"
+
+const char Snapshot::kMagic[8] = {'V', 'D', 'S', 'N', 'A', 'P', '\0', '\0'};
+const int32_t Snapshot::kVersion;
+const int32_t Snapshot::kByteOrder;
+
+namespace {
+
+/**
+ * \brief File mapped in memory for reading, unmapped when the object is destroyed
+ */
+class MappedFile {
+private:
+    const char *fdata;
+    size_t fsize;
+
+    MappedFile(const MappedFile &);
+    MappedFile &operator=(const MappedFile &);
+
+public:
+    explicit MappedFile(const std::string &path) : fdata(NULL), fsize(0) {
+        int file = open(path.c_str(), O_RDONLY);
+        if (file < 0) {
+            throw Exception("Snapshot " + path + " can't be opened");
+        }
+        struct stat status;
+        if (fstat(file, &status) != 0) {
+            close(file);
+            throw Exception("Snapshot " + path + " can't be opened");
+        }
+        fsize = static_cast<size_t>(status.st_size);
+        if (fsize > 0) {
+            void *data = mmap(NULL, fsize, PROT_READ, MAP_PRIVATE, file, 0);
+            if (data == MAP_FAILED) {
+                close(file);
+                throw Exception("Snapshot " + path + " can't be mapped in memory");
+            }
+            fdata = static_cast<const char *>(data);
+        }
+        close(file);
+    }
+
+    ~MappedFile() {
+        if (fdata != NULL) {
+            munmap(const_cast<char *>(fdata), fsize);
+        }
+    }
+
+    const char *data() const { return fdata; }
+    size_t size() const { return fsize; }
+};
+
+/**
+ * \brief Throw an Exception for an invalid snapshot when a condition does not hold
+ */
+void check(bool condition, const char *message) {
+    if (!condition) {
+        throw Exception(std::string("Invalid snapshot: ") + message);
+    }
+}
+
+/**
+ * \brief Gives the string on an offset of the table of strings, NULL when there is no non-empty string on the offset
+ */
+const char *stringAt(const char *strings, int32_t size, int32_t offset) {
+    // The table ends with '\0', so every offset in the table starts a string that ends in the table
+    if (offset < 0 || offset >= size || strings[offset] == '\0') {
+        return NULL;
+    }
+    return strings + offset;
+}
+
+/**
+ * \brief Gives the offset of a string in the table of strings, the string is added when it is not in the table yet
+ */
+int32_t addString(std::string &strings, std::map<std::string, int32_t> &offsets, const std::string &value) {
+    std::map<std::string, int32_t>::iterator it = offsets.find(value);
+    if (it != offsets.end()) {
+        return it->second;
+    }
+    int32_t offset = static_cast<int32_t>(strings.size());
+    strings.append(value.c_str(), value.size() + 1);
+    offsets.insert(std::make_pair(value, offset));
+    return offset;
+}
+
+/**
+ * \brief Append the records of a vector to the bytes of a snapshot
+ */
+template<typename T>
+void writeRecords(std::string &data, const std::vector<T> &records) {
+    if (!records.empty()) {
+        data.append(reinterpret_cast<const char *>(&records[0]), records.size() * sizeof(T));
+    }
+}
+
+/**
+ * \brief Gives the start of an array of records in the file, offset is moved to the end of the array
+ */
+template<typename T>
+const T *records(const char *data, size_t &offset, int32_t count) {
+    const T *start = reinterpret_cast<const T *>(data + offset);
+    offset += static_cast<size_t>(count) * sizeof(T);
+    return start;
+}
+
+}
+
+Snapshot::Snapshot() : farena(NULL) {
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+}
+
+bool Snapshot::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+void Snapshot::setArena(Arena *arena) {
+
+    REQUIRE(properlyInitialized(), "Snapshot object must be properly initialized");
+    farena = arena;
+}
+
+bool Snapshot::isSnapshot(const std::string &path) {
+
+    std::ifstream stream(path.c_str(), std::ios::binary);
+    char magic[sizeof(kMagic)];
+    if (!stream.read(magic, sizeof(magic))) {
+        return false;
+    }
+    return std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+void Snapshot::write(const std::string &path, const std::vector<Hub*> &hubs,
+                     const std::map<std::string, VaccinationCenter*> &centra, int iter,
+                     const std::map<int, int> &dayVaccinated) const {
+
+    REQUIRE(properlyInitialized(), "Snapshot object must be properly initialized");
+    REQUIRE(iter >= 0, "Iter can't be negative");
+
+    std::string data = encode(hubs, centra, iter, dayVaccinated);
+    std::ofstream stream(path.c_str(), std::ios::binary | std::ios::trunc);
+    stream.write(data.data(), data.size());
+    stream.close();
+    if (!stream) {
+        throw Exception("Snapshot " + path + " can't be written");
+    }
+
+    ENSURE(isSnapshot(path), "Snapshot must be written");
+}
+
+std::string Snapshot::encode(const std::vector<Hub*> &hubs, const std::map<std::string, VaccinationCenter*> &centra,
+                             int iter, const std::map<int, int> &dayVaccinated) const {
+
+    REQUIRE(properlyInitialized(), "Snapshot object must be properly initialized");
+    REQUIRE(iter >= 0, "Iter can't be negative");
+
+    std::string strings;
+    std::map<std::string, int32_t> offsets;
+
+    std::vector<CenterRecord> centerRecords;
+    std::vector<CenterVaccinRecord> centerVaccinRecords;
+    std::vector<int32_t> ringDays;
+    // A Hub reports its transports in the order the centra were created in, so they are created again in that order
+    std::map<unsigned long, const VaccinationCenter*> created;
+    for (std::map<std::string, VaccinationCenter*>::const_iterator it = centra.begin(); it != centra.end(); it++) {
+        created[it->second->getCreated()] = it->second;
+    }
+    std::map<const VaccinationCenter*, int32_t> centerIndex;
+    for (std::map<unsigned long, const VaccinationCenter*>::const_iterator it = created.begin(); it != created.end(); it++) {
+        const VaccinationCenter *center = it->second;
+        centerIndex[center] = static_cast<int32_t>(centerRecords.size());
+
+        const std::map<const std::string, VaccinInCenter*> &vaccins = center->vaccinsType();
+        CenterRecord record;
+        record.name = addString(strings, offsets, center->getName());
+        record.address = addString(strings, offsets, center->getAddress());
+        record.population = center->getPopulation();
+        record.capacity = center->getCapacity();
+        record.vaccinated = center->getVaccinated();
+        record.vaccins = static_cast<int32_t>(vaccins.size());
+        centerRecords.push_back(record);
+
+        for (std::map<const std::string, VaccinInCenter*>::const_iterator ite = vaccins.begin(); ite != vaccins.end(); ite++) {
+            const VaccinInCenter *vaccin = ite->second;
+            CenterVaccinRecord vaccinRecord;
+            vaccinRecord.type = addString(strings, offsets, vaccin->getType());
+            vaccinRecord.temperature = vaccin->getTemperature();
+            vaccinRecord.renewal = vaccin->getRenewal();
+            vaccinRecord.amount = vaccin->getVaccin();
+            vaccinRecord.backlog = vaccin->totalFirstVaccination();
+            vaccinRecord.requiredDay = vaccin->frequiredDay;
+            vaccinRecord.requiredDaySet = vaccin->frequiredDaySet ? 1 : 0;
+            centerVaccinRecords.push_back(vaccinRecord);
+
+            // The tracker is written from day -renewal, so it is read back with its start on index 0
+            for (int day = -vaccin->getRenewal(); day < 0; day++) {
+                ringDays.push_back(vaccin->ringDay(day));
+            }
+        }
+    }
+
+    std::vector<HubRecord> hubRecords;
+    std::vector<HubVaccinRecord> hubVaccinRecords;
+    std::vector<int32_t> hubCentra;
+    for (std::vector<Hub*>::const_iterator it = hubs.begin(); it != hubs.end(); it++) {
+        const std::map<std::string, VaccinInHub*> &vaccins = (*it)->getVaccins();
+        const std::map<std::string, VaccinationCenter*> &connected = (*it)->getCentra();
+        HubRecord record;
+        record.vaccins = static_cast<int32_t>(vaccins.size());
+        record.centra = static_cast<int32_t>(connected.size());
+        hubRecords.push_back(record);
+
+        for (std::map<std::string, VaccinInHub*>::const_iterator ite = vaccins.begin(); ite != vaccins.end(); ite++) {
+            const VaccinInHub *vaccin = ite->second;
+            HubVaccinRecord vaccinRecord;
+            vaccinRecord.type = addString(strings, offsets, vaccin->getType());
+            vaccinRecord.delivery = vaccin->getDelivery();
+            vaccinRecord.interval = vaccin->getInterval();
+            vaccinRecord.transport = vaccin->getTransport();
+            vaccinRecord.renewal = vaccin->getRenewal();
+            vaccinRecord.temperature = vaccin->getTemperature();
+            vaccinRecord.amount = vaccin->getVaccin();
+            vaccinRecord.delivered = vaccin->getDelivered();
+            hubVaccinRecords.push_back(vaccinRecord);
+        }
+        for (std::map<std::string, VaccinationCenter*>::const_iterator ite = connected.begin(); ite != connected.end(); ite++) {
+            std::map<const VaccinationCenter*, int32_t>::const_iterator index = centerIndex.find(ite->second);
+            REQUIRE(index != centerIndex.end(), "VaccinationCenter of a Hub must be in centra");
+            hubCentra.push_back(index->second);
+        }
+    }
+
+    std::vector<DayRecord> dayRecords;
+    for (std::map<int, int>::const_iterator it = dayVaccinated.begin(); it != dayVaccinated.end(); it++) {
+        DayRecord record;
+        record.day = it->first;
+        record.vaccinated = it->second;
+        dayRecords.push_back(record);
+    }
+
+    Header header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byteOrder = kByteOrder;
+    header.iter = iter;
+    header.hubs = static_cast<int32_t>(hubRecords.size());
+    header.hubVaccins = static_cast<int32_t>(hubVaccinRecords.size());
+    header.hubCentra = static_cast<int32_t>(hubCentra.size());
+    header.centra = static_cast<int32_t>(centerRecords.size());
+    header.centerVaccins = static_cast<int32_t>(centerVaccinRecords.size());
+    header.ringDays = static_cast<int32_t>(ringDays.size());
+    header.days = static_cast<int32_t>(dayRecords.size());
+    header.strings = static_cast<int32_t>(strings.size());
+
+    std::string data;
+    data.reserve(sizeof(header) + hubRecords.size() * sizeof(HubRecord) +
+                 hubVaccinRecords.size() * sizeof(HubVaccinRecord) + hubCentra.size() * sizeof(int32_t) +
+                 centerRecords.size() * sizeof(CenterRecord) + centerVaccinRecords.size() * sizeof(CenterVaccinRecord) +
+                 ringDays.size() * sizeof(int32_t) + dayRecords.size() * sizeof(DayRecord) + strings.size());
+    data.append(reinterpret_cast<const char *>(&header), sizeof(header));
+    writeRecords(data, hubRecords);
+    writeRecords(data, hubVaccinRecords);
+    writeRecords(data, hubCentra);
+    writeRecords(data, centerRecords);
+    writeRecords(data, centerVaccinRecords);
+    writeRecords(data, ringDays);
+    writeRecords(data, dayRecords);
+    data.append(strings.data(), strings.size());
+    return data;
+}
+
+void Snapshot::read(const std::string &path, std::vector<Hub*> &hubs,
+                    std::map<std::string, VaccinationCenter*> &centra, int &iter,
+                    std::map<int, int> &dayVaccinated) const {
+
+    REQUIRE(properlyInitialized(), "Snapshot object must be properly initialized");
+    REQUIRE(FileExists(path), "Snapshot must exist");
+    REQUIRE(hubs.empty() && centra.empty() && dayVaccinated.empty(), "Containers must be empty");
+
+    MappedFile file(path);
+    read(file.data(), file.size(), path, hubs, centra, iter, dayVaccinated);
+
+    ENSURE(iter >= 0, "Iter can't be negative");
+}
+
+void Snapshot::decode(const std::string &data, std::vector<Hub*> &hubs,
+                      std::map<std::string, VaccinationCenter*> &centra, int &iter,
+                      std::map<int, int> &dayVaccinated) const {
+
+    REQUIRE(properlyInitialized(), "Snapshot object must be properly initialized");
+    REQUIRE(hubs.empty() && centra.empty() && dayVaccinated.empty(), "Containers must be empty");
+
+    read(data.data(), data.size(), "in memory", hubs, centra, iter, dayVaccinated);
+
+    ENSURE(iter >= 0, "Iter can't be negative");
+}
+
+void Snapshot::read(const char *data, size_t size, const std::string &path, std::vector<Hub*> &hubs,
+                    std::map<std::string, VaccinationCenter*> &centra, int &iter,
+                    std::map<int, int> &dayVaccinated) const {
+
+    if (size < sizeof(Header) || std::memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+        throw Exception(path + " is not a snapshot");
+    }
+    const Header *header = reinterpret_cast<const Header *>(data);
+    if (header->byteOrder != kByteOrder) {
+        throw Exception("Snapshot " + path + " was written on a machine with another byte order");
+    }
+    if (header->version != kVersion) {
+        throw Exception("Snapshot " + path + " has version " + ToString(header->version) + ", version " +
+                        ToString(kVersion) + " is supported");
+    }
+
+    check(header->iter >= 0 && header->hubs >= 0 && header->hubVaccins >= 0 && header->hubCentra >= 0 &&
+          header->centra >= 0 && header->centerVaccins >= 0 && header->ringDays >= 0 && header->days >= 0 &&
+          header->strings >= 0, "negative amount in header");
+    unsigned long long expected = sizeof(Header) +
+            static_cast<unsigned long long>(header->hubs) * sizeof(HubRecord) +
+            static_cast<unsigned long long>(header->hubVaccins) * sizeof(HubVaccinRecord) +
+            static_cast<unsigned long long>(header->hubCentra) * sizeof(int32_t) +
+            static_cast<unsigned long long>(header->centra) * sizeof(CenterRecord) +
+            static_cast<unsigned long long>(header->centerVaccins) * sizeof(CenterVaccinRecord) +
+            static_cast<unsigned long long>(header->ringDays) * sizeof(int32_t) +
+            static_cast<unsigned long long>(header->days) * sizeof(DayRecord) +
+            static_cast<unsigned long long>(header->strings);
+    check(expected == size, "size does not match header");
+
+    // Every array starts on a multiple of 4 bytes from the start of the data, which is aligned like a mapped page or
+    // like memory of new
+    size_t offset = sizeof(Header);
+    const HubRecord *hubRecords = records<HubRecord>(data, offset, header->hubs);
+    const HubVaccinRecord *hubVaccinRecords = records<HubVaccinRecord>(data, offset, header->hubVaccins);
+    const int32_t *hubCentra = records<int32_t>(data, offset, header->hubCentra);
+    const CenterRecord *centerRecords = records<CenterRecord>(data, offset, header->centra);
+    const CenterVaccinRecord *centerVaccinRecords = records<CenterVaccinRecord>(data, offset, header->centerVaccins);
+    const int32_t *ringDays = records<int32_t>(data, offset, header->ringDays);
+    const DayRecord *dayRecords = records<DayRecord>(data, offset, header->days);
+    const char *strings = data + offset;
+    check(header->strings == 0 || strings[header->strings - 1] == '\0', "table of strings does not end");
+
+    // Everything except the names of the centra is checked before the objects are built, so their contracts hold
+    int32_t vaccin = 0;
+    int32_t ring = 0;
+    for (int32_t i = 0; i < header->centra; i++) {
+        const CenterRecord &center = centerRecords[i];
+        const char *name = stringAt(strings, header->strings, center.name);
+        check(name != NULL && stringAt(strings, header->strings, center.address) != NULL, "center without name or address");
+        check(center.population >= 0 && center.capacity >= 0 && center.vaccinated >= 0, "negative value of center");
+        check(center.vaccins >= 0 && center.vaccins <= header->centerVaccins - vaccin, "too many vaccins of centra");
+        long long stock = 0;
+        long long waiting = 0;
+        for (int32_t j = vaccin; j < vaccin + center.vaccins; j++) {
+            const CenterVaccinRecord &record = centerVaccinRecords[j];
+            const char *type = stringAt(strings, header->strings, record.type);
+            check(type != NULL, "vaccin of center without type");
+            check(j == vaccin || std::strcmp(strings + centerVaccinRecords[j - 1].type, type) < 0,
+                  "vaccins of center not sorted on type");
+            check(record.renewal >= 0 && record.amount >= 0 && record.backlog >= 0 && record.requiredDay >= 0,
+                  "negative value of vaccin of center");
+            check(record.requiredDaySet == 1 || (record.requiredDaySet == 0 && record.requiredDay == 0),
+                  "invalid day 0 of tracker");
+            check(record.renewal <= header->ringDays - ring, "too many days of trackers");
+            long long backlog = record.requiredDay;
+            for (int32_t day = ring; day < ring + record.renewal; day++) {
+                check(ringDays[day] >= 0, "negative day of tracker");
+                backlog += ringDays[day];
+            }
+            check(backlog == record.backlog, "tracker does not match people waiting for their second shot");
+            stock += record.amount;
+            waiting += backlog;
+            ring += record.renewal;
+        }
+        check(stock <= 2LL * center.capacity, "more vaccins than the capacity of center");
+        check(center.vaccinated + waiting <= center.population, "more vaccinated people than population");
+        vaccin += center.vaccins;
+    }
+    check(vaccin == header->centerVaccins && ring == header->ringDays, "unused vaccins of centra");
+
+    vaccin = 0;
+    int32_t connected = 0;
+    std::vector<int32_t> connectedHub(header->centra, -1);
+    for (int32_t i = 0; i < header->hubs; i++) {
+        const HubRecord &hub = hubRecords[i];
+        check(hub.vaccins >= 0 && hub.vaccins <= header->hubVaccins - vaccin, "too many vaccins of hubs");
+        check(hub.centra >= 0 && hub.centra <= header->hubCentra - connected, "too many centra of hubs");
+        for (int32_t j = vaccin; j < vaccin + hub.vaccins; j++) {
+            const HubVaccinRecord &record = hubVaccinRecords[j];
+            const char *type = stringAt(strings, header->strings, record.type);
+            check(type != NULL, "vaccin of hub without type");
+            check(j == vaccin || std::strcmp(strings + hubVaccinRecords[j - 1].type, type) < 0,
+                  "vaccins of hub not sorted on type");
+            check(record.delivery >= 0 && record.interval >= 0 && record.transport >= 0 && record.renewal >= 0 &&
+                  record.amount >= 0 && record.delivered >= 0, "negative value of vaccin of hub");
+        }
+        for (int32_t j = connected; j < connected + hub.centra; j++) {
+            check(hubCentra[j] >= 0 && hubCentra[j] < header->centra, "unknown center of hub");
+            check(connectedHub[hubCentra[j]] != i, "duplicate center of hub");
+            connectedHub[hubCentra[j]] = i;
+        }
+        vaccin += hub.vaccins;
+        connected += hub.centra;
+    }
+    check(vaccin == header->hubVaccins && connected == header->hubCentra, "unused vaccins or centra of hubs");
+
+    for (int32_t i = 1; i < header->days; i++) {
+        check(dayRecords[i - 1].day < dayRecords[i].day, "days not sorted");
+    }
+
+    std::vector<VaccinationCenter*> built;
+    vaccin = 0;
+    ring = 0;
+    for (int32_t i = 0; i < header->centra; i++) {
+        const CenterRecord &record = centerRecords[i];
+        VaccinationCenter *center = farena != NULL
+                ? farena->createCenter(strings + record.name, strings + record.address, record.population,
+                                       record.capacity)
+                : new VaccinationCenter(strings + record.name, strings + record.address, record.population,
+                                        record.capacity);
+        built.push_back(center);
+        if (!centra.insert(std::make_pair(center->getName(), center)).second) {
+            for (std::vector<VaccinationCenter*>::iterator it = built.begin(); it != built.end(); it++) {
+                if (farena != NULL) {
+                    farena->destroy(*it);
+                }
+                else {
+                    delete *it;
+                }
+            }
+            centra.clear();
+            check(false, "duplicate center");
+        }
+        center->setVaccinated(record.vaccinated);
+        for (int32_t j = vaccin; j < vaccin + record.vaccins; j++) {
+            const CenterVaccinRecord &vaccinRecord = centerVaccinRecords[j];
+            VaccinInCenter *vaccinType = new VaccinInCenter(strings + vaccinRecord.type, vaccinRecord.temperature,
+                                                            vaccinRecord.renewal, vaccinRecord.amount);
+            std::copy(ringDays + ring, ringDays + ring + vaccinRecord.renewal, vaccinType->fring.begin());
+            vaccinType->frequiredDay = vaccinRecord.requiredDay;
+            vaccinType->frequiredDaySet = vaccinRecord.requiredDaySet != 0;
+            vaccinType->setBacklog(vaccinRecord.backlog);
+            if (center->ftable != NULL) {
+                vaccinType->bind(center->ftable, center->findex);
+            }
+            center->insertVaccinType(vaccinType);
+            ring += vaccinRecord.renewal;
+        }
+        vaccin += record.vaccins;
+    }
+
+    vaccin = 0;
+    connected = 0;
+    for (int32_t i = 0; i < header->hubs; i++) {
+        const HubRecord &record = hubRecords[i];
+        Hub *hub = farena != NULL ? farena->createHub() : new Hub();
+        for (int32_t j = vaccin; j < vaccin + record.vaccins; j++) {
+            const HubVaccinRecord &vaccinRecord = hubVaccinRecords[j];
+            VaccinInHub *vaccinType = new VaccinInHub(strings + vaccinRecord.type, vaccinRecord.delivery,
+                                                      vaccinRecord.interval, vaccinRecord.transport,
+                                                      vaccinRecord.renewal, vaccinRecord.temperature);
+            hub->addVaccin(vaccinType);
+            vaccinType->setVaccinAmount(vaccinRecord.amount);
+            vaccinType->fdelivered = vaccinRecord.delivered;
+        }
+        for (int32_t j = connected; j < connected + record.centra; j++) {
+            VaccinationCenter *center = built[hubCentra[j]];
+            hub->addCenter(center->getName(), center);
+        }
+        vaccin += record.vaccins;
+        connected += record.centra;
+        hubs.push_back(hub);
+    }
+
+    for (int32_t i = 0; i < header->days; i++) {
+        dayVaccinated.insert(dayVaccinated.end(), std::make_pair(dayRecords[i].day, dayRecords[i].vaccinated));
+    }
+    iter = header->iter;
+}
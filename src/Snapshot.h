@@ -0,0 +1,230 @@
+/**
+ * @file Snapshot.h
+ * @brief This header file contains the declarations and the members of the Snapshot class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_SNAPSHOT_H
+#define VACCINDISTRIBUTOR_SNAPSHOT_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <stdint.h>
+#include "DesignByContract.h"
+#include "Exception.h"
+#include "Utils.h"
+#include "Hub.h"
+#include "VaccinationCenter.h"
+#include "Arena.h"
+
+/**
+ * \brief Class implemented to write the Hubs, VaccinationCenters and the state of a Simulation to a binary file and
+ *        to rebuild them from that file
+ *
+ * A snapshot holds the topology of the simulation file together with everything that changes while simulating, so
+ * a simulation file is converted once and a simulation can be continued from any day. The file is a Header followed
+ * by arrays of fixed size records and a table of strings, it is read by mapping it in memory.
+ * Numbers are written in the byte order of the machine, a snapshot from a machine with another byte order is refused.
+ */
+class Snapshot {
+
+private:
+    /**
+     * \brief Start of a snapshot, the amount of records of every array that follows
+     */
+    struct Header {
+        char magic[8]; ///< kMagic
+        int32_t version; ///< kVersion
+        int32_t byteOrder; ///< kByteOrder as written by the machine
+        int32_t iter; ///< Iterator of the Simulation
+        int32_t hubs; ///< Amount of HubRecords
+        int32_t hubVaccins; ///< Amount of HubVaccinRecords
+        int32_t hubCentra; ///< Amount of centra of the Hubs, indices in the CenterRecords
+        int32_t centra; ///< Amount of CenterRecords
+        int32_t centerVaccins; ///< Amount of CenterVaccinRecords
+        int32_t ringDays; ///< Amount of days of the renewal trackers
+        int32_t days; ///< Amount of DayRecords
+        int32_t strings; ///< Size of the table of strings in bytes
+    };
+
+    /**
+     * \brief Hub, its Vaccins and centra follow those of the previous Hub
+     */
+    struct HubRecord {
+        int32_t vaccins; ///< Amount of Vaccins of the Hub
+        int32_t centra; ///< Amount of VaccinationCenters connected to the Hub
+    };
+
+    /**
+     * \brief Vaccin of a Hub, sorted on type within the Hub
+     */
+    struct HubVaccinRecord {
+        int32_t type; ///< Offset of the type in the table of strings
+        int32_t delivery;
+        int32_t interval;
+        int32_t transport;
+        int32_t renewal;
+        int32_t temperature;
+        int32_t amount; ///< Amount of vaccins in the Hub
+        int32_t delivered; ///< Amount of vaccins delivered to the Hub
+    };
+
+    /**
+     * \brief VaccinationCenter, in the order the VaccinationCenters were created, its Vaccins follow those of the
+     *        previous VaccinationCenter
+     */
+    struct CenterRecord {
+        int32_t name; ///< Offset of the name in the table of strings
+        int32_t address; ///< Offset of the address in the table of strings
+        int32_t population;
+        int32_t capacity;
+        int32_t vaccinated;
+        int32_t vaccins; ///< Amount of Vaccins of the VaccinationCenter
+    };
+
+    /**
+     * \brief Vaccin of a VaccinationCenter, sorted on type within the VaccinationCenter, its renewal tracker holds
+     *        renewal days that follow those of the previous Vaccin
+     */
+    struct CenterVaccinRecord {
+        int32_t type; ///< Offset of the type in the table of strings
+        int32_t temperature;
+        int32_t renewal;
+        int32_t amount; ///< Amount of vaccins in the VaccinationCenter
+        int32_t backlog; ///< Amount of people waiting for their second shot
+        int32_t requiredDay; ///< Amount of people with a first shot on day 0
+        int32_t requiredDaySet; ///< Day 0 is used in the tracker
+    };
+
+    /**
+     * \brief Amount of vaccinated people at the end of a day
+     */
+    struct DayRecord {
+        int32_t day;
+        int32_t vaccinated;
+    };
+
+    static const char kMagic[8]; ///< First bytes of every snapshot
+    static const int32_t kVersion = 1; ///< Version of the format, increased with every change of the records
+    static const int32_t kByteOrder = 0x01020304; ///< Written as a number to detect the byte order
+
+    Arena *farena; ///< Owner of the Hubs and VaccinationCenters that are rebuilt, NULL when the caller owns them
+    Snapshot *_initCheck;
+
+    /**
+     * \brief Check the bytes of a snapshot and rebuild the Hubs, VaccinationCenters and the state of a Simulation
+     *
+     * @param data Bytes of the snapshot, aligned to 4 bytes
+     * @param size Amount of bytes
+     * @param path Name of the snapshot in the messages of the Exceptions
+     */
+    void read(const char *data, size_t size, const std::string &path, std::vector<Hub*> &hubs,
+              std::map<std::string, VaccinationCenter*> &centra, int &iter, std::map<int, int> &dayVaccinated) const;
+
+public:
+    /**
+     * \brief Default constructor for a Snapshot object
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     */
+    Snapshot();
+
+    /**
+     * \brief Check whether the Snapshot object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Check whether a file starts like a snapshot, the rest of the file is checked when it is read
+     *
+     * @param path Path of the file
+     *
+     * @return true when the file starts with the bytes of a snapshot, false when not
+     */
+    static bool isSnapshot(const std::string &path);
+
+    /**
+     * \brief Set the Arena that owns the Hubs and VaccinationCenters that are rebuilt, without one they are created
+     *        with new and deleted by the caller
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Snapshot object must be properly initialized")
+     */
+    void setArena(Arena *arena);
+
+    /**
+     * \brief Write Hubs, VaccinationCenters and the state of a Simulation to a snapshot
+     *
+     * @param path Path of the snapshot, throws an Exception when it can't be written
+     * @param hubs Hubs of the Simulation
+     * @param centra VaccinationCenters of the Simulation, every VaccinationCenter of a Hub must be in centra
+     * @param iter Iterator of the Simulation
+     * @param dayVaccinated Amount of vaccinated people at the end of every day
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Snapshot object must be properly initialized")
+     * REQUIRE(iter >= 0, "Iter can't be negative")
+     *
+     * @post
+     * ENSURE(isSnapshot(path), "Snapshot must be written")
+     */
+    void write(const std::string &path, const std::vector<Hub*> &hubs,
+               const std::map<std::string, VaccinationCenter*> &centra, int iter,
+               const std::map<int, int> &dayVaccinated) const;
+
+    /**
+     * \brief Rebuild Hubs, VaccinationCenters and the state of a Simulation from a snapshot, the file is checked
+     *        before anything is built and an Exception is thrown when it is not a valid snapshot
+     *
+     * @param path Path of the snapshot
+     * @param hubs Filled with the Hubs, owned by the Arena of setArena() or deleted by the caller
+     * @param centra Filled with the VaccinationCenters, owned by the Arena of setArena() or deleted by the caller
+     * @param iter Set to the iterator of the Simulation
+     * @param dayVaccinated Filled with the amount of vaccinated people at the end of every day
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Snapshot object must be properly initialized")
+     * REQUIRE(FileExists(path), "Snapshot must exist")
+     * REQUIRE(hubs.empty() && centra.empty() && dayVaccinated.empty(), "Containers must be empty")
+     *
+     * @post
+     * ENSURE(iter >= 0, "Iter can't be negative")
+     */
+    void read(const std::string &path, std::vector<Hub*> &hubs, std::map<std::string, VaccinationCenter*> &centra,
+              int &iter, std::map<int, int> &dayVaccinated) const;
+
+    /**
+     * \brief Give the bytes of a snapshot of Hubs, VaccinationCenters and the state of a Simulation, without writing
+     *        a file
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Snapshot object must be properly initialized")
+     * REQUIRE(iter >= 0, "Iter can't be negative")
+     *
+     * @return Bytes of the snapshot, the same bytes as the file of write()
+     */
+    std::string encode(const std::vector<Hub*> &hubs, const std::map<std::string, VaccinationCenter*> &centra,
+                       int iter, const std::map<int, int> &dayVaccinated) const;
+
+    /**
+     * \brief Rebuild Hubs, VaccinationCenters and the state of a Simulation from the bytes of encode(), like read()
+     *
+     * @param data Bytes of the snapshot
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Snapshot object must be properly initialized")
+     * REQUIRE(hubs.empty() && centra.empty() && dayVaccinated.empty(), "Containers must be empty")
+     *
+     * @post
+     * ENSURE(iter >= 0, "Iter can't be negative")
+     */
+    void decode(const std::string &data, std::vector<Hub*> &hubs, std::map<std::string, VaccinationCenter*> &centra,
+                int &iter, std::map<int, int> &dayVaccinated) const;
+};
+
+#endif //VACCINDISTRIBUTOR_SNAPSHOT_H
@@ -0,0 +1,376 @@
+/**
+ * @file Sweep.cpp
+ * @brief This file contains the definitions of the members of the Sweep class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "Sweep.h"
+#include <set>
+#include <sstream>
+#include "ThreadPool.h"
+
+namespace {
+
+/**
+ * \brief Names of the targets in a file with scenarios
+ */
+const char *const kTargetNames[] = {"capacity", "delivery", "interval", "transport", "renewal"};
+
+/**
+ * \brief Simulate one scenario for every index, every scenario has its own Simulation
+ */
+class ScenarioTask : public ThreadPool::Task {
+private:
+    const std::string &fdata; ///< Bytes of the snapshot every scenario starts from
+    const std::vector<Sweep::Scenario> &fscenarios;
+    std::vector<Sweep::Result> &fresults;
+    int fdays;
+
+public:
+    ScenarioTask(const std::string &data, const std::vector<Sweep::Scenario> &scenarios,
+                 std::vector<Sweep::Result> &results, int days) :
+        fdata(data), fscenarios(scenarios), fresults(results), fdays(days) {}
+
+    void run(int index) {
+        const Sweep::Scenario &scenario = fscenarios[index];
+        Sweep::Result &result = fresults[index];
+        result.name = scenario.name;
+        result.vaccinated = 0;
+        try {
+            // The scenarios already use every thread, so the centra of a scenario are vaccinated on its own thread
+            Simulation simulation;
+            simulation.setThreads(1);
+            simulation.loadSnapshotData(fdata);
+            for (std::vector<Sweep::Override>::const_iterator it = scenario.overrides.begin();
+                 it != scenario.overrides.end(); it++) {
+                Sweep::apply(simulation, *it);
+            }
+            NullSink sink;
+            simulation.automaticSimulation(fdays, sink, false, false);
+            result.vaccinated = simulation.getVaccinated();
+            result.dayVaccinated = simulation.getDayVaccinated();
+            result.vaccinData = simulation.getVaccinData();
+        }
+        catch (Exception ex) {
+            result.error = ex.value();
+        }
+    }
+};
+
+/**
+ * \brief Split a line in words separated by spaces, a part between double quotes is kept together without its quotes
+ */
+std::vector<std::string> splitWords(const std::string &line) {
+    std::vector<std::string> words;
+    std::string word;
+    bool quoted = false;
+    bool started = false;
+    for (std::string::const_iterator it = line.begin(); it != line.end(); it++) {
+        if (*it == '"') {
+            quoted = !quoted;
+            started = true;
+        }
+        else if (!quoted && (*it == ' ' || *it == '\t' || *it == '\r')) {
+            if (started) {
+                words.push_back(word);
+            }
+            word.clear();
+            started = false;
+        }
+        else {
+            word += *it;
+            started = true;
+        }
+    }
+    if (quoted) {
+        throw Exception("quote is not closed");
+    }
+    if (started) {
+        words.push_back(word);
+    }
+    return words;
+}
+
+/**
+ * \brief Read an override <target>:<name>=<values>, the values are separated by commas
+ */
+void readOverride(const std::string &word, Sweep::Override &override, std::vector<int> &values) {
+    std::string::size_type colon = word.find(':');
+    std::string::size_type equals = word.rfind('=');
+    if (colon == std::string::npos || equals == std::string::npos || equals < colon) {
+        throw Exception("override " + word + " is not <target>:<name>=<values>");
+    }
+    std::string target = word.substr(0, colon);
+    int targets = sizeof(kTargetNames) / sizeof(kTargetNames[0]);
+    int found = 0;
+    while (found < targets && target != kTargetNames[found]) {
+        found++;
+    }
+    if (found == targets) {
+        throw Exception("unknown target " + target);
+    }
+    override.target = static_cast<Sweep::Override::Target>(found);
+    override.name = word.substr(colon + 1, equals - colon - 1);
+    if (override.name.empty()) {
+        throw Exception("override " + word + " has no name");
+    }
+
+    values.clear();
+    std::stringstream stream(word.substr(equals + 1));
+    std::string part;
+    while (std::getline(stream, part, ',')) {
+        int value;
+        try {
+            value = ToInt(part);
+        }
+        catch (Exception ex) {
+            throw Exception("invalid value " + part + " of " + target);
+        }
+        if (part.empty() || !Sweep::validValue(override.target, value)) {
+            throw Exception("invalid value " + part + " of " + target);
+        }
+        values.push_back(value);
+    }
+    if (values.empty()) {
+        throw Exception("override " + word + " has no values");
+    }
+}
+
+}
+
+Sweep::Sweep(const Simulation &simulation) {
+
+    REQUIRE(simulation.properlyInitialized(), "Simulation object must be properly initialized");
+
+    fdata = simulation.getSnapshotData();
+    fthreads = ThreadPool::hardwareThreads();
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(getScenarios().empty(), "Scenarios must be empty");
+}
+
+bool Sweep::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+void Sweep::addScenario(const Scenario &scenario) {
+
+    REQUIRE(properlyInitialized(), "Sweep object must be properly initialized");
+    for (std::vector<Override>::const_iterator it = scenario.overrides.begin(); it != scenario.overrides.end(); it++) {
+        REQUIRE(validValue(it->target, it->value), "Invalid value of override");
+    }
+
+    fscenarios.push_back(scenario);
+    ENSURE(getScenarios().back().name == scenario.name, "Scenario is not added");
+}
+
+void Sweep::readScenarios(std::istream &stream) {
+
+    REQUIRE(properlyInitialized(), "Sweep object must be properly initialized");
+
+    // The scenarios are only added when every line is valid
+    std::vector<Scenario> scenarios;
+    std::string line;
+    int number = 0;
+    while (std::getline(stream, line)) {
+        number++;
+        try {
+            std::vector<std::string> words = splitWords(line);
+            if (words.empty() || words[0][0] == '#') {
+                continue;
+            }
+            std::vector<Override> overrides(words.size() - 1);
+            std::vector<std::vector<int> > values(words.size() - 1);
+            for (unsigned int i = 1; i < words.size(); i++) {
+                readOverride(words[i], overrides[i - 1], values[i - 1]);
+            }
+
+            // Every combination of values is a scenario, the last override changes first
+            std::vector<unsigned int> chosen(overrides.size(), 0);
+            while (true) {
+                Scenario scenario;
+                scenario.name = words[0];
+                scenario.overrides = overrides;
+                for (unsigned int i = 0; i < overrides.size(); i++) {
+                    scenario.overrides[i].value = values[i][chosen[i]];
+                    if (values[i].size() > 1) {
+                        scenario.name += "/" + words[i + 1].substr(0, words[i + 1].rfind('=') + 1) +
+                                ToString(values[i][chosen[i]]);
+                    }
+                }
+                scenarios.push_back(scenario);
+
+                int i = static_cast<int>(overrides.size()) - 1;
+                while (i >= 0 && ++chosen[i] == values[i].size()) {
+                    chosen[i] = 0;
+                    i--;
+                }
+                if (i < 0) {
+                    break;
+                }
+            }
+        }
+        catch (Exception ex) {
+            throw Exception("Line " + ToString(number) + " of the scenarios: " + ex.value());
+        }
+    }
+    fscenarios.insert(fscenarios.end(), scenarios.begin(), scenarios.end());
+}
+
+const std::vector<Sweep::Scenario> &Sweep::getScenarios() const {
+
+    REQUIRE(properlyInitialized(), "Sweep object must be properly initialized");
+    return fscenarios;
+}
+
+void Sweep::setThreads(int threads) {
+
+    REQUIRE(properlyInitialized(), "Sweep object must be properly initialized");
+    REQUIRE(threads >= 1, "Amount of threads must be positive");
+    fthreads = threads;
+    ENSURE(getThreads() == threads, "Amount of threads is not set");
+}
+
+int Sweep::getThreads() const {
+
+    REQUIRE(properlyInitialized(), "Sweep object must be properly initialized");
+    return fthreads;
+}
+
+void Sweep::run(int days) {
+
+    REQUIRE(properlyInitialized(), "Sweep object must be properly initialized");
+    REQUIRE(days >= 0, "Days can't be negative");
+
+    fresults.clear();
+    fresults.resize(fscenarios.size());
+    int threads = fthreads < static_cast<int>(fscenarios.size()) ? fthreads : static_cast<int>(fscenarios.size());
+    if (threads > 0) {
+        ThreadPool pool(threads);
+        ScenarioTask task(fdata, fscenarios, fresults, days);
+        pool.run(task, static_cast<int>(fscenarios.size()));
+    }
+    ENSURE(getResults().size() == getScenarios().size(), "Every scenario must have a result");
+}
+
+const std::vector<Sweep::Result> &Sweep::getResults() const {
+
+    REQUIRE(properlyInitialized(), "Sweep object must be properly initialized");
+    return fresults;
+}
+
+void Sweep::writeCsv(std::ostream &stream) const {
+
+    REQUIRE(properlyInitialized(), "Sweep object must be properly initialized");
+
+    // A column for every type and day of any scenario, a scenario without the type or day leaves its value empty
+    std::set<std::string> types;
+    std::set<int> days;
+    for (std::vector<Result>::const_iterator it = fresults.begin(); it != fresults.end(); it++) {
+        for (std::map<const std::string, int>::const_iterator ite = it->vaccinData.begin(); ite != it->vaccinData.end(); ite++) {
+            types.insert(ite->first);
+        }
+        for (std::map<int, int>::const_iterator ite = it->dayVaccinated.begin(); ite != it->dayVaccinated.end(); ite++) {
+            days.insert(ite->first);
+        }
+    }
+
+    stream << "scenario,error,vaccinated";
+    for (std::set<std::string>::const_iterator it = types.begin(); it != types.end(); it++) {
+        stream << ',' << CsvField("delivered " + *it);
+    }
+    for (std::set<int>::const_iterator it = days.begin(); it != days.end(); it++) {
+        stream << ",day " << *it;
+    }
+    stream << '\n';
+
+    for (std::vector<Result>::const_iterator it = fresults.begin(); it != fresults.end(); it++) {
+        stream << CsvField(it->name) << ',' << CsvField(it->error) << ',';
+        if (it->error.empty()) {
+            stream << it->vaccinated;
+        }
+        for (std::set<std::string>::const_iterator ite = types.begin(); ite != types.end(); ite++) {
+            stream << ',';
+            std::map<const std::string, int>::const_iterator value = it->vaccinData.find(*ite);
+            if (value != it->vaccinData.end()) {
+                stream << value->second;
+            }
+        }
+        for (std::set<int>::const_iterator ite = days.begin(); ite != days.end(); ite++) {
+            stream << ',';
+            std::map<int, int>::const_iterator value = it->dayVaccinated.find(*ite);
+            if (value != it->dayVaccinated.end()) {
+                stream << value->second;
+            }
+        }
+        stream << '\n';
+    }
+}
+
+bool Sweep::validValue(Override::Target target, int value) {
+
+    // The day of a delivery is computed modulo the interval and loads are computed by dividing by the transport
+    if (target == Override::kInterval || target == Override::kTransport) {
+        return value >= 1;
+    }
+    return value >= 0;
+}
+
+void Sweep::apply(Simulation &simulation, const Override &override) {
+
+    REQUIRE(simulation.properlyInitialized(), "Simulation object must be properly initialized");
+    REQUIRE(validValue(override.target, override.value), "Invalid value of override");
+
+    bool all = override.name == "*";
+    bool found = false;
+    if (override.target == Override::kCapacity) {
+        const std::map<std::string, VaccinationCenter*> &centra = simulation.getFcentra();
+        for (std::map<std::string, VaccinationCenter*>::const_iterator it = centra.begin(); it != centra.end(); it++) {
+            if (all || it->first == override.name) {
+                it->second->setCapacity(override.value);
+                found = true;
+            }
+        }
+        if (!found) {
+            throw Exception("Unknown VaccinationCenter " + override.name);
+        }
+        return;
+    }
+
+    const std::vector<Hub*> &hubs = simulation.getHub();
+    for (std::vector<Hub*>::const_iterator it = hubs.begin(); it != hubs.end(); it++) {
+        const std::map<std::string, VaccinInHub*> &vaccins = (*it)->getVaccins();
+        for (std::map<std::string, VaccinInHub*>::const_iterator ite = vaccins.begin(); ite != vaccins.end(); ite++) {
+            if (!all && ite->first != override.name) {
+                continue;
+            }
+            found = true;
+            VaccinInHub *vaccin = ite->second;
+            switch (override.target) {
+                case Override::kDelivery:
+                    vaccin->setDelivery(override.value);
+                    // On day 0 a Hub has one delivery of every Vaccin
+                    if (simulation.getIter() == 0) {
+                        vaccin->setVaccinAmount(override.value);
+                    }
+                    break;
+                case Override::kInterval:
+                    vaccin->setInterval(override.value);
+                    break;
+                case Override::kTransport:
+                    vaccin->setTransport(override.value);
+                    break;
+                case Override::kRenewal:
+                    vaccin->setRenewal(override.value);
+                    break;
+                case Override::kCapacity:
+                    break;
+            }
+        }
+    }
+    if (!found) {
+        throw Exception("Unknown Vaccin " + override.name);
+    }
+}
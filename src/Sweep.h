@@ -0,0 +1,207 @@
+/**
+ * @file Sweep.h
+ * @brief This header file contains the declarations and the members of the Sweep class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_SWEEP_H
+#define VACCINDISTRIBUTOR_SWEEP_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <iostream>
+#include "DesignByContract.h"
+#include "Exception.h"
+#include "Utils.h"
+#include "Simulation.h"
+
+/**
+ * \brief Class implemented to simulate many variations of one Simulation, e.g. a grid of capacities and deliveries
+ *
+ * The Simulation is imported once and kept as the bytes of a snapshot. Every scenario loads its own copy from those
+ * bytes, changes it with the setters of the VaccinationCenters and Vaccins and is simulated without output. The
+ * scenarios are simulated on a ThreadPool, one scenario per thread, and their results are written to one .csv file.
+ */
+class Sweep {
+
+public:
+    /**
+     * \brief Change of a value of the Simulation before a scenario is simulated
+     */
+    struct Override {
+        /**
+         * \brief Value that is changed
+         */
+        enum Target {
+            kCapacity = 0, ///< VaccinationCenter::setCapacity of a VaccinationCenter
+            kDelivery = 1, ///< VaccinInHub::setDelivery of a Vaccin in every Hub
+            kInterval = 2, ///< VaccinInHub::setInterval of a Vaccin in every Hub
+            kTransport = 3, ///< VaccinInHub::setTransport of a Vaccin in every Hub
+            kRenewal = 4 ///< VaccinInHub::setRenewal of a Vaccin in every Hub, used by the centra that get the Vaccin
+                         ///< after the override
+        };
+
+        Target target;
+        std::string name; ///< Name of the VaccinationCenter or type of the Vaccin, "*" for all of them
+        int value;
+    };
+
+    /**
+     * \brief Variation of the Simulation
+     */
+    struct Scenario {
+        std::string name;
+        std::vector<Override> overrides; ///< Applied in order
+    };
+
+    /**
+     * \brief Result of a simulated scenario
+     */
+    struct Result {
+        std::string name; ///< Name of the scenario
+        std::string error; ///< Message of the Exception when the scenario can't be simulated, empty when it is
+        int vaccinated; ///< Amount of vaccinated people after the last day
+        std::map<int, int> dayVaccinated; ///< Simulation::getDayVaccinated
+        std::map<const std::string, int> vaccinData; ///< Simulation::getVaccinData
+    };
+
+private:
+    std::string fdata; ///< Bytes of the snapshot every scenario starts from
+    std::vector<Scenario> fscenarios;
+    std::vector<Result> fresults;
+    int fthreads; ///< Amount of scenarios simulated at the same time
+    Sweep *_initCheck;
+
+public:
+    /**
+     * \brief Constructor for a Sweep object, the scenarios start from the current day of the Simulation
+     *
+     * @param simulation The Simulation, it is not used after the constructor
+     *
+     * @pre
+     * REQUIRE(simulation.properlyInitialized(), "Simulation object must be properly initialized")
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(getScenarios().empty(), "Scenarios must be empty")
+     */
+    explicit Sweep(const Simulation &simulation);
+
+    /**
+     * \brief Check whether the Sweep object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Add a scenario, a scenario without overrides simulates the Simulation itself
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Sweep object must be properly initialized")
+     * REQUIRE(validValue(every override), "Invalid value of override")
+     *
+     * @post
+     * ENSURE(getScenarios().back().name == scenario.name, "Scenario is not added")
+     */
+    void addScenario(const Scenario &scenario);
+
+    /**
+     * \brief Add the scenarios of a file, throws an Exception with the number of the line when a line is invalid
+     *
+     * Every line is a name followed by overrides <target>:<name>=<values>, e.g. "big capacity:*=5000
+     * delivery:Pfizer=1000,2000". The target is capacity, delivery, interval, transport or renewal. An override with
+     * several values gives a scenario for every combination of values, its name is followed by the chosen values.
+     * Empty lines and lines starting with # are skipped.
+     *
+     * @param stream Input-stream with the scenarios
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Sweep object must be properly initialized")
+     */
+    void readScenarios(std::istream &stream);
+
+    /**
+     * \brief Get the scenarios in the order they were added
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Sweep object must be properly initialized")
+     */
+    const std::vector<Scenario> &getScenarios() const;
+
+    /**
+     * \brief Set amount of scenarios simulated at the same time
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Sweep object must be properly initialized")
+     * REQUIRE(threads >= 1, "Amount of threads must be positive")
+     *
+     * @post
+     * ENSURE(getThreads() == threads, "Amount of threads is not set")
+     */
+    void setThreads(int threads);
+
+    /**
+     * \brief Get amount of scenarios simulated at the same time, all cores by default
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Sweep object must be properly initialized")
+     */
+    int getThreads() const;
+
+    /**
+     * \brief Simulate every scenario until a day, the results of an earlier run are replaced
+     *
+     * @param days Day to simulate until, like Simulation::automaticSimulation
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Sweep object must be properly initialized")
+     * REQUIRE(days >= 0, "Days can't be negative")
+     *
+     * @post
+     * ENSURE(getResults().size() == getScenarios().size(), "Every scenario must have a result")
+     */
+    void run(int days);
+
+    /**
+     * \brief Get the results of run(), in the order of the scenarios
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Sweep object must be properly initialized")
+     */
+    const std::vector<Result> &getResults() const;
+
+    /**
+     * \brief Write the results to a .csv file, a line for every scenario with the total amount of vaccinated people,
+     *        the delivered vaccins of every type and the vaccinated people at the end of every day
+     *
+     * @param stream Output-stream
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Sweep object must be properly initialized")
+     */
+    void writeCsv(std::ostream &stream) const;
+
+    /**
+     * \brief Check whether a value can be given to the setter of a target
+     *
+     * @return true when the value is valid, false when not
+     */
+    static bool validValue(Override::Target target, int value);
+
+    /**
+     * \brief Change a value of a Simulation, throws an Exception when the VaccinationCenter or Vaccin doesn't exist
+     *
+     * @param simulation The Simulation
+     * @param override The change
+     *
+     * @pre
+     * REQUIRE(simulation.properlyInitialized(), "Simulation object must be properly initialized")
+     * REQUIRE(validValue(override.target, override.value), "Invalid value of override")
+     */
+    static void apply(Simulation &simulation, const Override &override);
+};
+
+#endif //VACCINDISTRIBUTOR_SWEEP_H
@@ -0,0 +1,133 @@
+/**
+ * @file TagSchema.cpp
+ * @brief This file contains the definitions of the members of the TagSchema class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include <cstring>
+#include "TagSchema.h"
+#include "xml/tinyxml.h"
+
+/**
+ * \brief Allow an element, its siblings after it and all their children
+ *
+ * @param schema The TagSchema
+ * @param element The first element
+ * @param depth Nested depth of the element
+ */
+static void addElements(TagSchema &schema, const TiXmlElement *element, int depth) {
+
+    while (element != NULL) {
+        schema.addTag(element->Value(), depth);
+        addElements(schema, element->FirstChildElement(), depth + 1);
+        element = element->NextSiblingElement();
+    }
+}
+
+TagSchema::TagSchema() : fslots(16), ftags(0) {
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(getTags() == 0, "TagSchema must be empty");
+}
+
+TagSchema::TagSchema(const char *path, std::ostream &errorStream) : fslots(16), ftags(0) {
+
+    _initCheck = this;
+
+    if (!FileExists(path)) {
+        errorStream << "cannot find file with accepted tags" << std::endl;
+    }
+    TiXmlDocument document;
+    if (!document.LoadFile(path)) {
+        errorStream << "error in find file with accepted tags: " << document.ErrorDesc() << std::endl;
+    }
+    addElements(*this, document.FirstChildElement(), 0);
+
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+}
+
+bool TagSchema::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+unsigned int TagSchema::hash(const char *name, size_t length, int depth) {
+
+    // FNV-1a over the bytes of the name, followed by the depth
+    unsigned int hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ static_cast<unsigned char>(name[i])) * 16777619u;
+    }
+    return (hash ^ static_cast<unsigned int>(depth)) * 16777619u;
+}
+
+size_t TagSchema::findSlot(const char *name, size_t length, int depth, unsigned int hash) const {
+
+    // Linear probing, the table is never full so a free slot ends the search
+    size_t mask = fslots.size() - 1;
+    size_t slot = hash & mask;
+    while (fslots[slot].depth != -1) {
+        const Tag &tag = fslots[slot];
+        if (tag.hash == hash && tag.depth == depth && tag.name.size() == length &&
+            std::memcmp(tag.name.data(), name, length) == 0) {
+            return slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void TagSchema::addTag(const std::string &name, int depth) {
+
+    REQUIRE(properlyInitialized(), "TagSchema object must be properly initialized");
+    REQUIRE(!name.empty(), "Name can't be empty");
+    REQUIRE(depth >= 0, "Depth can't be negative");
+
+    unsigned int tagHash = hash(name.data(), name.size(), depth);
+    size_t slot = findSlot(name.data(), name.size(), depth, tagHash);
+    if (fslots[slot].depth == -1) {
+        fslots[slot].name = name;
+        fslots[slot].depth = depth;
+        fslots[slot].hash = tagHash;
+        ftags++;
+
+        // Keep at least half of the slots free, so a search ends quickly
+        if (static_cast<size_t>(ftags) * 2 > fslots.size()) {
+            std::vector<Tag> old;
+            old.swap(fslots);
+            fslots.resize(old.size() * 2);
+            for (std::vector<Tag>::iterator it = old.begin(); it != old.end(); it++) {
+                if (it->depth != -1) {
+                    size_t newSlot = findSlot(it->name.data(), it->name.size(), it->depth, it->hash);
+                    fslots[newSlot].name.swap(it->name);
+                    fslots[newSlot].depth = it->depth;
+                    fslots[newSlot].hash = it->hash;
+                }
+            }
+        }
+    }
+    ENSURE(isKnown(name, depth), "Tag must be known");
+}
+
+bool TagSchema::isKnown(const char *name, size_t length, int depth) const {
+
+    REQUIRE(properlyInitialized(), "TagSchema object must be properly initialized");
+
+    return fslots[findSlot(name, length, depth, hash(name, length, depth))].depth != -1;
+}
+
+bool TagSchema::isKnown(const std::string &name, int depth) const {
+
+    REQUIRE(properlyInitialized(), "TagSchema object must be properly initialized");
+
+    return isKnown(name.data(), name.size(), depth);
+}
+
+int TagSchema::getTags() const {
+
+    REQUIRE(properlyInitialized(), "TagSchema object must be properly initialized");
+
+    return ftags;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file TagSchema.h
+ * @brief This header file contains the declarations and the members of the TagSchema class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_TAGSCHEMA_H
+#define VACCINDISTRIBUTOR_TAGSCHEMA_H
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstddef>
+#include "DesignByContract.h"
+#include "Utils.h"
+
+/**
+ * \brief Class implemented for the tags that are allowed in a .xml file, every tag is a name at a nested depth
+ *
+ * The tags are read once from an example file with all the allowed tags, the root elements have depth 0. The schema
+ * can be used to check any number of files. The tags are stored in a hash table with open addressing, so a tag is
+ * found without comparing it to all the other tags.
+ */
+class TagSchema {
+
+private:
+    /**
+     * \brief Slot of the hash table, free when depth is -1
+     */
+    struct Tag {
+        std::string name;
+        int depth;
+        unsigned int hash;
+
+        Tag() : depth(-1), hash(0) {}
+    };
+
+    std::vector<Tag> fslots; ///< Hash table, the size is a power of two and at least twice the amount of tags
+    int ftags; ///< Amount of tags in the hash table
+    TagSchema *_initCheck;
+
+    /**
+     * \brief Hash of a tag
+     *
+     * @param name Name of the tag, not ended by '\0'
+     * @param length Length of the name
+     * @param depth Nested depth of the tag
+     *
+     * @return The hash
+     */
+    static unsigned int hash(const char *name, size_t length, int depth);
+
+    /**
+     * \brief Slot of a tag, the slot of the tag when it is in the hash table, else the free slot it belongs in
+     *
+     * @param name Name of the tag, not ended by '\0'
+     * @param length Length of the name
+     * @param depth Nested depth of the tag
+     * @param hash Hash of the tag
+     *
+     * @return Index of the slot
+     */
+    size_t findSlot(const char *name, size_t length, int depth, unsigned int hash) const;
+
+public:
+    /**
+     * \brief Constructor for a TagSchema object without tags
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(getTags() == 0, "TagSchema must be empty")
+     */
+    TagSchema();
+
+    /**
+     * \brief Constructor for a TagSchema object with all the tags of a file, the schema is empty when the file can't
+     *        be read
+     *
+     * @param path Path of the example file with all the allowed tags
+     * @param errorStream Output-stream for the errors of reading the file
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     */
+    TagSchema(const char *path, std::ostream &errorStream);
+
+    /**
+     * \brief Check whether the TagSchema object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Allow a tag, allowing a tag twice has no effect
+     *
+     * @param name Name of the tag
+     * @param depth Nested depth of the tag
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "TagSchema object must be properly initialized")
+     * REQUIRE(!name.empty(), "Name can't be empty")
+     * REQUIRE(depth >= 0, "Depth can't be negative")
+     *
+     * @post
+     * ENSURE(isKnown(name, depth), "Tag must be known")
+     */
+    void addTag(const std::string &name, int depth);
+
+    /**
+     * \brief Check whether a tag is allowed
+     *
+     * @param name Name of the tag, not ended by '\0'
+     * @param length Length of the name
+     * @param depth Nested depth of the tag
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "TagSchema object must be properly initialized")
+     *
+     * @return true when the tag is allowed, false when not
+     */
+    bool isKnown(const char *name, size_t length, int depth) const;
+
+    /**
+     * \brief Check whether a tag is allowed
+     *
+     * @param name Name of the tag
+     * @param depth Nested depth of the tag
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "TagSchema object must be properly initialized")
+     *
+     * @return true when the tag is allowed, false when not
+     */
+    bool isKnown(const std::string &name, int depth) const;
+
+    /**
+     * \brief Get the amount of allowed tags
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "TagSchema object must be properly initialized")
+     *
+     * @return Amount of tags
+     */
+    int getTags() const;
+};
+
+#endif //VACCINDISTRIBUTOR_TAGSCHEMA_H
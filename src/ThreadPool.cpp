@@ -0,0 +1,154 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief This file contains the definitions of the members of the ThreadPool class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "ThreadPool.h"
+#include <unistd.h>
+
+ThreadPool::ThreadPool(int threads) {
+
+    REQUIRE(threads >= 1, "ThreadPool needs at least one thread");
+
+    pthread_mutex_init(&fmutex, NULL);
+    pthread_cond_init(&fstart, NULL);
+    pthread_cond_init(&fdone, NULL);
+    ftask = NULL;
+    fnext = 0;
+    fcount = 0;
+    fbusy = 0;
+    fgeneration = 0;
+    fstop = false;
+    _initCheck = this;
+
+    for (int i = 1; i < threads; i++) {
+        pthread_t thread;
+        // Work is still done by the threads that could be started
+        if (pthread_create(&thread, NULL, &ThreadPool::work, this) != 0) {
+            break;
+        }
+        fworkers.push_back(thread);
+    }
+
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(getThreads() <= threads, "Too many threads are started");
+}
+
+ThreadPool::~ThreadPool() {
+
+    REQUIRE(properlyInitialized(), "ThreadPool must be properly initialized");
+
+    pthread_mutex_lock(&fmutex);
+    fstop = true;
+    pthread_cond_broadcast(&fstart);
+    pthread_mutex_unlock(&fmutex);
+
+    for (std::vector<pthread_t>::iterator it = fworkers.begin(); it != fworkers.end(); it++) {
+        pthread_join(*it, NULL);
+    }
+    pthread_cond_destroy(&fdone);
+    pthread_cond_destroy(&fstart);
+    pthread_mutex_destroy(&fmutex);
+}
+
+bool ThreadPool::properlyInitialized() const {
+
+    return ThreadPool::_initCheck == this;
+}
+
+int ThreadPool::getThreads() const {
+
+    REQUIRE(properlyInitialized(), "ThreadPool must be properly initialized");
+    return static_cast<int>(fworkers.size()) + 1;
+}
+
+void *ThreadPool::work(void *pool) {
+
+    ThreadPool *threadPool = static_cast<ThreadPool*>(pool);
+    unsigned long generation = 0;
+
+    pthread_mutex_lock(&threadPool->fmutex);
+    while (true) {
+        while (!threadPool->fstop && (threadPool->ftask == NULL || threadPool->fgeneration == generation)) {
+            pthread_cond_wait(&threadPool->fstart, &threadPool->fmutex);
+        }
+        if (threadPool->fstop) {
+            break;
+        }
+        generation = threadPool->fgeneration;
+        threadPool->fbusy++;
+        Task *task = threadPool->ftask;
+        pthread_mutex_unlock(&threadPool->fmutex);
+
+        threadPool->runIndices(task);
+
+        pthread_mutex_lock(&threadPool->fmutex);
+        threadPool->fbusy--;
+        if (threadPool->fbusy == 0) {
+            pthread_cond_signal(&threadPool->fdone);
+        }
+    }
+    pthread_mutex_unlock(&threadPool->fmutex);
+    return NULL;
+}
+
+void ThreadPool::runIndices(ThreadPool::Task *task) {
+
+    while (true) {
+        pthread_mutex_lock(&fmutex);
+        int index = fnext;
+        if (index < fcount) {
+            fnext++;
+        }
+        pthread_mutex_unlock(&fmutex);
+
+        if (index >= fcount) {
+            return;
+        }
+        task->run(index);
+    }
+}
+
+void ThreadPool::run(ThreadPool::Task &task, int count) {
+
+    REQUIRE(properlyInitialized(), "ThreadPool must be properly initialized");
+    REQUIRE(count >= 0, "Range can not be negative");
+
+    // Not worth waking the workers
+    if (fworkers.empty() || count <= 1) {
+        for (int i = 0; i < count; i++) {
+            task.run(i);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&fmutex);
+    ftask = &task;
+    fnext = 0;
+    fcount = count;
+    fgeneration++;
+    fbusy++;
+    pthread_cond_broadcast(&fstart);
+    pthread_mutex_unlock(&fmutex);
+
+    runIndices(&task);
+
+    pthread_mutex_lock(&fmutex);
+    fbusy--;
+    while (fbusy > 0) {
+        pthread_cond_wait(&fdone, &fmutex);
+    }
+    ftask = NULL;
+    pthread_mutex_unlock(&fmutex);
+}
+
+int ThreadPool::hardwareThreads() {
+
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1) {
+        return 1;
+    }
+    return static_cast<int>(threads);
+}
@@ -0,0 +1,126 @@
+/**
+ * @file ThreadPool.h
+ * @brief This header file contains the declarations and the members of the ThreadPool class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_THREADPOOL_H
+#define VACCINDISTRIBUTOR_THREADPOOL_H
+
+#include <vector>
+#include <pthread.h>
+#include "DesignByContract.h"
+
+/**
+ * \brief Class implemented to run independent pieces of work on a fixed group of threads
+ *
+ * The threads are started once and wait between two calls of run(), so a day of the Simulation does not pay for
+ * creating threads.
+ */
+class ThreadPool {
+
+public:
+    /**
+     * \brief Piece of work that can be run for every index of a range
+     */
+    class Task {
+    public:
+        virtual ~Task() {}
+
+        /**
+         * \brief Run the work for one index, called at most once for every index and from any thread
+         *
+         * @param index Index in the range of run()
+         */
+        virtual void run(int index) = 0;
+    };
+
+private:
+    std::vector<pthread_t> fworkers; ///< Started threads, the thread that calls run() also does work
+    pthread_mutex_t fmutex; ///< Protects all members below
+    pthread_cond_t fstart; ///< Signals the workers that there is new work or that they must stop
+    pthread_cond_t fdone; ///< Signals the caller of run() that all work is done
+    Task *ftask; ///< Task that is being run, NULL when there is no work
+    int fnext; ///< Next index of the range that is not taken yet
+    int fcount; ///< Size of the range
+    int fbusy; ///< Amount of workers that are working on the current task
+    unsigned long fgeneration; ///< Increased for every call of run(), so workers do not run the same task twice
+    bool fstop; ///< The workers must stop
+    ThreadPool *_initCheck;
+
+    /**
+     * \brief Entry point of the started threads
+     *
+     * @param pool Pointer to ThreadPool object
+     */
+    static void *work(void *pool);
+
+    /**
+     * \brief Take indices of the current task and run them until there are none left
+     *
+     * @param task Task that is being run
+     */
+    void runIndices(Task *task);
+
+public:
+    /**
+     * \brief Constructor for a ThreadPool object
+     *
+     * @param threads Amount of threads that work on a task, including the thread that calls run()
+     *
+     * @pre
+     * REQUIRE(threads >= 1, "ThreadPool needs at least one thread")
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(getThreads() <= threads, "Too many threads are started")
+     */
+    ThreadPool(int threads);
+
+    /**
+     * \brief Deconstructor for a ThreadPool object, stops and joins all threads
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ThreadPool must be properly initialized")
+     */
+    ~ThreadPool();
+
+    /**
+     * \brief Check whether the ThreadPool object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Get amount of threads that work on a task
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ThreadPool must be properly initialized")
+     *
+     * @return Amount of threads as int
+     */
+    int getThreads() const;
+
+    /**
+     * \brief Run task for every index in [0, count) and wait until all indices are done
+     *
+     * @param task Task to run
+     * @param count Size of the range
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "ThreadPool must be properly initialized")
+     * REQUIRE(count >= 0, "Range can not be negative")
+     */
+    void run(Task &task, int count);
+
+    /**
+     * \brief Get amount of threads the hardware can run at the same time
+     *
+     * @return Amount of threads as int, at least 1
+     */
+    static int hardwareThreads();
+};
+
+#endif //VACCINDISTRIBUTOR_THREADPOOL_H
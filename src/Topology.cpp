@@ -0,0 +1,137 @@
+/**
+ * @file Topology.cpp
+ * @brief This file contains the definitions of the members of the Topology class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include "Topology.h"
+#include "Hub.h"
+
+Topology::Topology() : fhubEdges(1, 0), fcenterEdges(1, 0), fconnected(true) {
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(getHubs() == 0 && getCentra() == 0, "Topology must be empty");
+}
+
+Topology::Topology(const std::map<std::string, VaccinationCenter*> &centra, const std::vector<Hub*> &hubs)
+        : fhubEdges(1, 0), fconnected(true) {
+
+    std::map<std::string, int> indices;
+    fcentra.reserve(centra.size());
+    for (std::map<std::string, VaccinationCenter*>::const_iterator it = centra.begin(); it != centra.end(); it++) {
+        indices.insert(indices.end(), std::make_pair(it->first, static_cast<int>(fcentra.size())));
+        fcentra.push_back(it->second);
+    }
+
+    // Centra of every Hub, a center that isn't in the Simulation has no index
+    std::vector<int> hubCount(fcentra.size(), 0);
+    fhubEdges.reserve(hubs.size() + 1);
+    for (std::vector<Hub*>::const_iterator it = hubs.begin(); it != hubs.end(); it++) {
+        const std::map<std::string, VaccinationCenter*> &connected = (*it)->getCentra();
+        for (std::map<std::string, VaccinationCenter*>::const_iterator ite = connected.begin(); ite != connected.end(); ite++) {
+            std::map<std::string, int>::const_iterator index = indices.find(ite->first);
+            if (index == indices.end()) {
+                fconnected = false;
+                continue;
+            }
+            fhubCentra.push_back(index->second);
+            hubCount[index->second]++;
+        }
+        fhubEdges.push_back(static_cast<int>(fhubCentra.size()));
+    }
+
+    // Hubs of every center, the edges are grouped by center with a counting sort
+    fcenterEdges.assign(fcentra.size() + 1, 0);
+    for (unsigned int center = 0; center < fcentra.size(); center++) {
+        if (hubCount[center] == 0) {
+            fconnected = false;
+        }
+        fcenterEdges[center + 1] = fcenterEdges[center] + hubCount[center];
+    }
+    fcenterHubs.resize(fhubCentra.size());
+    std::vector<int> next(fcenterEdges.begin(), fcenterEdges.end() - 1);
+    for (unsigned int hub = 0; hub + 1 < fhubEdges.size(); hub++) {
+        for (int edge = fhubEdges[hub]; edge < fhubEdges[hub + 1]; edge++) {
+            fcenterHubs[next[fhubCentra[edge]]++] = hub;
+        }
+    }
+
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
+    ENSURE(getHubs() == static_cast<int>(hubs.size()) && getCentra() == static_cast<int>(centra.size()),
+           "Every Hub and center must have an index");
+}
+
+bool Topology::properlyInitialized() const {
+
+    return _initCheck == this;
+}
+
+int Topology::getHubs() const {
+
+    REQUIRE(properlyInitialized(), "Topology must be properly initialized");
+    return static_cast<int>(fhubEdges.size()) - 1;
+}
+
+int Topology::getCentra() const {
+
+    REQUIRE(properlyInitialized(), "Topology must be properly initialized");
+    return static_cast<int>(fcentra.size());
+}
+
+VaccinationCenter *Topology::getCenter(int center) const {
+
+    REQUIRE(properlyInitialized(), "Topology must be properly initialized");
+    REQUIRE(center >= 0 && center < getCentra(), "Center must exist");
+    return fcentra[center];
+}
+
+int Topology::beginCentra(int hub) const {
+
+    REQUIRE(properlyInitialized(), "Topology must be properly initialized");
+    REQUIRE(hub >= 0 && hub < getHubs(), "Hub must exist");
+    return fhubEdges[hub];
+}
+
+int Topology::endCentra(int hub) const {
+
+    REQUIRE(properlyInitialized(), "Topology must be properly initialized");
+    REQUIRE(hub >= 0 && hub < getHubs(), "Hub must exist");
+    return fhubEdges[hub + 1];
+}
+
+int Topology::getEdgeCenter(int edge) const {
+
+    REQUIRE(properlyInitialized(), "Topology must be properly initialized");
+    REQUIRE(edge >= 0 && edge < static_cast<int>(fhubCentra.size()), "Edge must exist");
+    return fhubCentra[edge];
+}
+
+int Topology::beginHubs(int center) const {
+
+    REQUIRE(properlyInitialized(), "Topology must be properly initialized");
+    REQUIRE(center >= 0 && center < getCentra(), "Center must exist");
+    return fcenterEdges[center];
+}
+
+int Topology::endHubs(int center) const {
+
+    REQUIRE(properlyInitialized(), "Topology must be properly initialized");
+    REQUIRE(center >= 0 && center < getCentra(), "Center must exist");
+    return fcenterEdges[center + 1];
+}
+
+int Topology::getEdgeHub(int edge) const {
+
+    REQUIRE(properlyInitialized(), "Topology must be properly initialized");
+    REQUIRE(edge >= 0 && edge < static_cast<int>(fcenterHubs.size()), "Edge must exist");
+    return fcenterHubs[edge];
+}
+
+bool Topology::isConnected() const {
+
+    REQUIRE(properlyInitialized(), "Topology must be properly initialized");
+    return fconnected;
+}
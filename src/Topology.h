@@ -0,0 +1,156 @@
+/**
+ * @file Topology.h
+ * @brief This header file contains the declarations and the members of the Topology class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef VACCINDISTRIBUTOR_TOPOLOGY_H
+#define VACCINDISTRIBUTOR_TOPOLOGY_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include "DesignByContract.h"
+
+class Hub;
+class VaccinationCenter;
+
+/**
+ * \brief Class implemented for the connections between the Hubs and VaccinationCenters of a Simulation
+ *
+ * Hubs are numbered in the order of the Simulation, VaccinationCenters in the order of their names. The connections
+ * are stored twice in compressed sparse row form: the centra of a Hub are the edges from beginCentra(hub) to
+ * endCentra(hub), in the order of their names, the Hubs of a center are the edges from beginHubs(center) to
+ * endHubs(center), in the order of the Hubs. The topology is built once when the Simulation is imported and doesn't
+ * change afterwards, so it is checked when it is built.
+ */
+class Topology {
+
+private:
+    std::vector<VaccinationCenter*> fcentra; ///< VaccinationCenter of every index
+    std::vector<int> fhubEdges; ///< First edge of every Hub in fhubCentra, followed by the amount of edges
+    std::vector<int> fhubCentra; ///< Index of the VaccinationCenter of every edge, grouped by Hub
+    std::vector<int> fcenterEdges; ///< First edge of every VaccinationCenter in fcenterHubs, followed by the amount of edges
+    std::vector<int> fcenterHubs; ///< Index of the Hub of every edge, grouped by VaccinationCenter
+    bool fconnected; ///< Every Hub supplies existing centra and every center is supplied by a Hub
+    Topology *_initCheck;
+
+public:
+    /**
+     * \brief Default constructor for a Topology object without Hubs and centra
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(getHubs() == 0 && getCentra() == 0, "Topology must be empty")
+     */
+    Topology();
+
+    /**
+     * \brief Constructor for the Topology object of the Hubs and centra of a Simulation
+     *
+     * @param centra VaccinationCenters of the Simulation by name
+     * @param hubs Hubs of the Simulation
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state")
+     * ENSURE(getHubs() == hubs.size() && getCentra() == centra.size(), "Every Hub and center must have an index")
+     */
+    Topology(const std::map<std::string, VaccinationCenter*> &centra, const std::vector<Hub*> &hubs);
+
+    /**
+     * \brief Check whether the Topology object is properly initialised
+     *
+     * @return true when object is properly initialised, false when not
+     */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Get the amount of Hubs
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Topology must be properly initialized")
+     */
+    int getHubs() const;
+
+    /**
+     * \brief Get the amount of VaccinationCenters
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Topology must be properly initialized")
+     */
+    int getCentra() const;
+
+    /**
+     * \brief Get the VaccinationCenter with an index
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Topology must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCentra(), "Center must exist")
+     */
+    VaccinationCenter *getCenter(int center) const;
+
+    /**
+     * \brief Get the first edge of a Hub
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Topology must be properly initialized")
+     * REQUIRE(hub >= 0 && hub < getHubs(), "Hub must exist")
+     */
+    int beginCentra(int hub) const;
+
+    /**
+     * \brief Get the edge after the last edge of a Hub
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Topology must be properly initialized")
+     * REQUIRE(hub >= 0 && hub < getHubs(), "Hub must exist")
+     */
+    int endCentra(int hub) const;
+
+    /**
+     * \brief Get the index of the VaccinationCenter of an edge of a Hub
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Topology must be properly initialized")
+     * REQUIRE(edge >= 0 && edge < amount of edges, "Edge must exist")
+     */
+    int getEdgeCenter(int edge) const;
+
+    /**
+     * \brief Get the first edge of a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Topology must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCentra(), "Center must exist")
+     */
+    int beginHubs(int center) const;
+
+    /**
+     * \brief Get the edge after the last edge of a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Topology must be properly initialized")
+     * REQUIRE(center >= 0 && center < getCentra(), "Center must exist")
+     */
+    int endHubs(int center) const;
+
+    /**
+     * \brief Get the index of the Hub of an edge of a VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Topology must be properly initialized")
+     * REQUIRE(edge >= 0 && edge < amount of edges, "Edge must exist")
+     */
+    int getEdgeHub(int edge) const;
+
+    /**
+     * \brief Check whether every Hub supplies centra of the Simulation and every center is supplied by a Hub
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Topology must be properly initialized")
+     */
+    bool isConnected() const;
+};
+
+#endif //VACCINDISTRIBUTOR_TOPOLOGY_H
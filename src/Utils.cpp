@@ -128,4 +128,20 @@ std::string ProgressBar(const int x, const int barWidth) {
     }
     progressBar.append("]");
     return progressBar;
-}
\ No newline at end of file
+}
+
+std::string CsvField(const std::string &value) {
+
+    if (value.find_first_of(",\"\n") == std::string::npos) {
+        return value;
+    }
+    std::string field = "\"";
+    for (std::string::const_iterator it = value.begin(); it != value.end(); it++) {
+        if (*it == '"') {
+            field += '"';
+        }
+        field += *it;
+    }
+    field += '"';
+    return field;
+}
@@ -57,6 +57,15 @@ int ToPercent(const int x, const int max);
  */
 std::string ProgressBar(const int x, const int barWidth);
 
+/**
+ * \brief Convert a string to a value of a .csv file, between quotes when it contains a comma, a quote or a newline
+ *
+ * @param value The string
+ *
+ * @return The value, with every quote doubled when it is between quotes
+ */
+std::string CsvField(const std::string &value);
+
 // Closing of the ``header guard''.
 
 #endif //TTT_UTILS_H
@@ -6,6 +6,10 @@
  */
 
 #include "Vaccin.h"
+#include "Journal.h"
+#include "CenterTable.h"
+#include "Hub.h"
+#include "DeliverySchedule.h"
 
 bool Vaccin::properlyInitialized() const {
     return _initCheck == this;
@@ -28,6 +32,10 @@ VaccinInHub::VaccinInHub(std::string type, const int delivery, const int interva
     this->fvaccinTemperature = temp;
     this->fdelivered = 0;
     this->fvaccinAmount = this->fdelivery; //amount of vaccins = delivery on day "zero" of simulation
+    this->fhub = NULL;
+    this->ftypeTable = NULL;
+    this->ftypeIndex = -1;
+    this->fjournal = NULL;
     _initCheck = this;
 
     ENSURE(properlyInitialized(), "Vaccin must end in properlyInitialized state");
@@ -60,6 +68,10 @@ void VaccinInHub::copyVaccin(const VaccinInHub *v) {
     this->fvaccinTemperature = v->getTemperature();
     this->fvaccinAmount = v->getVaccin();
     this->fdelivered = v->getDelivered();
+    this->fhub = NULL;
+    this->ftypeTable = NULL;
+    this->ftypeIndex = -1;
+    this->fjournal = NULL;
 
     this->_initCheck = this;
     ENSURE(properlyInitialized(), "Vaccin must end in properlyInitialized state");
@@ -83,6 +95,9 @@ void VaccinInHub::setDelivery(const int &newDelivery) {
 
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
     REQUIRE(newDelivery >= 0, "Delivery must not be negative");
+    if (fhub != NULL) {
+        fhub->ftotalDelivery += newDelivery - fdelivery;
+    }
     this->fdelivery = newDelivery;
 }
 
@@ -97,6 +112,9 @@ void VaccinInHub::setInterval(const int &newInterval) {
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
     REQUIRE(newInterval >= 0, "Interval must not be negative");
     this->finterval = newInterval;
+    if (fhub != NULL && fhub->fschedule != NULL) {
+        fhub->fschedule->invalidate();
+    }
 }
 
 int VaccinInHub::getTransport() const {
@@ -133,6 +151,19 @@ int Vaccin::getRenewal() const {
     return fvaccinRenewal;
 }
 
+void Vaccin::setJournal(Journal *journal) {
+    REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
+    this->fjournal = journal;
+}
+
+void VaccinInHub::setVaccinAmount(int amount) {
+
+    if (fhub != NULL) {
+        fhub->ftotalVaccins += amount - fvaccinAmount;
+    }
+    fvaccinAmount = amount;
+}
+
 int VaccinInHub::getDelivered() const {
 
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
@@ -142,8 +173,10 @@ int VaccinInHub::getDelivered() const {
 void VaccinInHub::updateVaccins() {
 
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
-    fvaccinAmount += fdelivery;
-    std::cout << fvaccinAmount <<std::endl;
+    if (fjournal != NULL) {
+        fjournal->recordHubVaccin(this);
+    }
+    setVaccinAmount(fvaccinAmount + fdelivery);
     ENSURE(this->getVaccin() >= this->getDelivery(), "The amount of vaccins must be bigger delivery amount (fvaccin += fdelivery)");
 }
 
@@ -153,7 +186,10 @@ void VaccinInHub::updateVaccinsTransport(int transportAmount) {
     REQUIRE(transportAmount % this->getTransport() == 0, "Wrong transport amount, Cargo amount must be a int");
 
     // Update amount of vaccins in Hub and Center
-    fvaccinAmount -= transportAmount;
+    if (fjournal != NULL) {
+        fjournal->recordHubVaccin(this);
+    }
+    setVaccinAmount(fvaccinAmount - transportAmount);
     fdelivered += transportAmount;
     ENSURE(this->getVaccin() >= 0, "fvaccinAmount can not be negative (fvaccinAmount -= transportAmount)");
     ENSURE(this->getDelivered() >= transportAmount, "fdelivered must be lager then transportAmount (this->getDelivered() >= transportAmount)");
@@ -172,7 +208,17 @@ bool VaccinInHub::checkUnderZero() {
     return getTemperature() < 0;
 }
 
+int VaccinInHub::getTypeIndex(const CenterTable *table) const {
+
+    REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
+    return table == ftypeTable ? ftypeIndex : -1;
+}
+
 VaccinInHub::VaccinInHub() {
+    this->fhub = NULL;
+    this->ftypeTable = NULL;
+    this->ftypeIndex = -1;
+    this->fjournal = NULL;
     this->_initCheck = this;
     ENSURE(properlyInitialized(), "Vaccin must end in properlyInitialized state");
 }
@@ -180,60 +226,178 @@ VaccinInHub::VaccinInHub() {
 void VaccinInCenter::copyVaccin(const VaccinInCenter *v) {
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
     REQUIRE(v->ftype != "", "Vaccin type must not be empty");
-    REQUIRE(v->fvaccinAmount >= 0, "Vaccin must not be negative");
+    REQUIRE(v->getVaccin() >= 0, "Vaccin must not be negative");
     REQUIRE(v->fvaccinRenewal >= 0, "Vaccin renewal must not be negative");
 
     this->ftype = v->getType();
     this->fvaccinTemperature = v->getTemperature();
-    this->fvaccinAmount = v->getVaccin();
+    this->setVaccinAmount(v->getVaccin());
     this->fvaccinRenewal = v->getRenewal();
-    this->ftracker = v->getTracker();
+    this->fring = v->fring;
+    this->fringStart = v->fringStart;
+    this->frequiredDay = v->frequiredDay;
+    this->frequiredDaySet = v->frequiredDaySet;
+    this->setBacklog(v->totalFirstVaccination());
+    this->fjournal = NULL;
 
     this->_initCheck = this;
     ENSURE(properlyInitialized(), "Copy constructor must end in properlyInitialized state");
     ENSURE(this->ftype == v->getType(), "type must be the same!");
     ENSURE(this->fvaccinRenewal == v->getRenewal(), "vaccinRenewal must be the same");
     ENSURE(this->fvaccinTemperature == v->getTemperature(), "vaccinTemperature must be the same");
-    ENSURE(this->fvaccinAmount == v->getVaccin(), "vaccinAmount must be the same");
+    ENSURE(this->getVaccin() == v->getVaccin(), "vaccinAmount must be the same");
+}
+
+VaccinInCenter::~VaccinInCenter() {
+    if (ftable != NULL) {
+        ftable->setStock(fcenter, ftypeIndex, 0);
+        ftable->setBacklog(fcenter, ftypeIndex, 0);
+    }
 }
 
-int &VaccinInCenter::getVaccinAmount() {
+void VaccinInCenter::setBacklog(int people) {
+    if (ftable != NULL) {
+        ftable->setBacklog(fcenter, ftypeIndex, people);
+    }
+    else {
+        fbacklog = people;
+    }
+}
+
+void VaccinInCenter::bind(CenterTable *table, int center) {
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
-    return fvaccinAmount;
+    REQUIRE(table != NULL, "CenterTable must exist");
+    REQUIRE(center >= 0 && center < table->getCenters(), "VaccinationCenter must be in the table");
+
+    int amount = this->getVaccin();
+    int totalFirstVaccination = this->totalFirstVaccination();
+    int typeIndex = table->addType(ftype);
+    table->setStock(center, typeIndex, amount);
+    table->setBacklog(center, typeIndex, totalFirstVaccination);
+    ftable = table;
+    fcenter = center;
+    ftypeIndex = typeIndex;
+
+    ENSURE(this->getVaccin() == amount, "vaccinAmount must be the same");
 }
 
-const std::map<int, int> &VaccinInCenter::getTracker() const {
+int VaccinInCenter::getVaccin() const {
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
-    return ftracker;
+    return ftable != NULL ? ftable->getStock(fcenter, ftypeIndex) : fvaccinAmount;
 }
 
-std::map<int, int> &VaccinInCenter::getTracker() {
+const CenterTable *VaccinInCenter::getTable() const {
+
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
-    return ftracker;
+    return ftable;
 }
 
-void VaccinInCenter::addDay(){
+int VaccinInCenter::getTypeIndex() const {
+
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
-    std::map<int, int> newTracker;
-    newTracker[0] = 0;
-    for (std::map<int, int>::iterator it = ftracker.begin(); it != ftracker.end(); it++){
-        if(it->first + 1 <= 0) {
-            newTracker[it->first + 1] = it->second;
-        }
-        else{
-            newTracker[0] += it->second;
+    return ftypeIndex;
+}
+
+int VaccinInCenter::getVaccinAmount() const {
+    REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
+    return ftable != NULL ? ftable->getStock(fcenter, ftypeIndex) : fvaccinAmount;
+}
+
+void VaccinInCenter::setVaccinAmount(int amount) {
+    REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
+    if (ftable != NULL) {
+        ftable->setStock(fcenter, ftypeIndex, amount);
+    }
+    else {
+        fvaccinAmount = amount;
+    }
+    ENSURE(this->getVaccinAmount() == amount, "vaccinAmount is not set to given value");
+}
+
+int &VaccinInCenter::ringDay(int day) {
+    return fring[(fringStart + day + fvaccinRenewal) % fvaccinRenewal];
+}
+
+int VaccinInCenter::ringDay(int day) const {
+    return fring[(fringStart + day + fvaccinRenewal) % fvaccinRenewal];
+}
+
+std::map<int, int> VaccinInCenter::getTracker() const {
+    REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
+    std::map<int, int> tracker;
+    for (int day = -static_cast<int>(fring.size()); day < 0; day++) {
+        if (ringDay(day) != 0) {
+            tracker[day] = ringDay(day);
         }
     }
-    ftracker = newTracker;
+    if (frequiredDaySet) {
+        tracker[0] = frequiredDay;
+    }
+    return tracker;
+}
+
+bool VaccinInCenter::isTrackerEmpty() const {
+    REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
+    // Days before day 0 are only used with a positive amount of people
+    return !frequiredDaySet && totalFirstVaccination() == 0;
+}
+
+bool VaccinInCenter::hasRequiredDay() const {
+    REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
+    return frequiredDaySet;
+}
+
+int VaccinInCenter::getRequiredDay() const {
+    REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
+    return frequiredDay;
+}
+
+void VaccinInCenter::removeRequiredDay(int people) {
+    REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
+    REQUIRE(hasRequiredDay(), "Day 0 must be used in tracker");
+    REQUIRE(people >= 0 && people <= getRequiredDay(), "Amount of people must be between 0 and the people on day 0");
+    if (fjournal != NULL) {
+        fjournal->recordTrackerEntry(this, 0);
+    }
+    frequiredDay -= people;
+    setBacklog(totalFirstVaccination() - people);
+    ENSURE(hasRequiredDay(), "Day 0 must be used in tracker");
+}
+
+void VaccinInCenter::addDay(){
+    REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
+    if (fjournal != NULL) {
+        fjournal->recordTrackerShift(this);
+    }
+    // People of day -1 can get their second shot, the emptied place becomes day -renewal
+    if (!fring.empty()) {
+        int &minusOne = ringDay(-1);
+        frequiredDay += minusOne;
+        minusOne = 0;
+        fringStart = (fringStart + fvaccinRenewal - 1) % fvaccinRenewal;
+    }
+    frequiredDaySet = true;
+    ENSURE(hasRequiredDay(), "Day 0 must be used in tracker");
 }
 
 void VaccinInCenter::insertRequiredDay(int day, int requiredPeople){
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
+    REQUIRE(day <= 0 && day >= -getRenewal(), "Day left of renewal must be between -renewal and 0");
     REQUIRE(requiredPeople >= 0, "Amount of peaple can not be negative");
     if(requiredPeople > 0){
-        ftracker[day] += requiredPeople;
+        if (fjournal != NULL) {
+            fjournal->recordTrackerEntry(this, day);
+        }
+        if (day == 0) {
+            frequiredDay += requiredPeople;
+            frequiredDaySet = true;
+        }
+        else {
+            ringDay(day) += requiredPeople;
+        }
+        setBacklog(totalFirstVaccination() + requiredPeople);
     }
-    ENSURE(requiredPeople == 0 || ftracker.find(day) != ftracker.end(),"Day not added");
+    ENSURE(requiredPeople == 0 || (day == 0 ? hasRequiredDay() : ringDay(day) > 0),"Day not added");
 }
 
 bool VaccinInCenter::isRenewal() const {
@@ -243,16 +407,15 @@ bool VaccinInCenter::isRenewal() const {
 
 int VaccinInCenter::totalFirstVaccination() const  {
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
-    int total = 0;
-    for (std::map<int, int>::const_iterator it = ftracker.begin(); it != ftracker.end(); it++){
-        total += it->second;
-    }
-    return total;
+    return ftable != NULL ? ftable->getBacklog(fcenter, ftypeIndex) : fbacklog;
 }
 
 void VaccinInCenter::removeVaccin(){
     REQUIRE(properlyInitialized(), "Vaccin must be properly initialized");
-    this->fvaccinAmount = 0;
+    if (fjournal != NULL) {
+        fjournal->recordVaccinAmount(this);
+    }
+    this->setVaccinAmount(0);
     ENSURE(this->getVaccinAmount() == 0, "fvaccinAmount is not set to 0");
 }
 
@@ -261,16 +424,35 @@ VaccinInCenter::VaccinInCenter(const std::string &vaccinType, int vaccinTemperat
     this->ftype = vaccinType;
     this->fvaccinTemperature = vaccinTemperature;
     this->fvaccinRenewal = vaccinRenewal;
-    this->fvaccinAmount = vaccinAmount;
+    this->fring.assign(vaccinRenewal > 0 ? vaccinRenewal : 0, 0);
+    this->fringStart = 0;
+    this->frequiredDay = 0;
+    this->frequiredDaySet = false;
+    this->ftable = NULL;
+    this->fcenter = -1;
+    this->ftypeIndex = -1;
+    this->fvaccinAmount = 0;
+    this->fbacklog = 0;
+    this->fjournal = NULL;
     this->_initCheck = this;
+    this->setVaccinAmount(vaccinAmount);
     ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
     ENSURE(this->ftype == vaccinType, "type is not set to given value");
     ENSURE(this->fvaccinRenewal == vaccinRenewal, "vaccinRenewal is not set to given value");
     ENSURE(this->fvaccinTemperature == vaccinTemperature, "vaccinTemperature is not set to given value");
-    ENSURE(this->fvaccinAmount == vaccinAmount, "vaccinAmount is not set to given value");
+    ENSURE(this->getVaccin() == vaccinAmount, "vaccinAmount is not set to given value");
 }
 
 VaccinInCenter::VaccinInCenter() {
+    this->fringStart = 0;
+    this->frequiredDay = 0;
+    this->frequiredDaySet = false;
+    this->ftable = NULL;
+    this->fcenter = -1;
+    this->ftypeIndex = -1;
+    this->fvaccinAmount = 0;
+    this->fbacklog = 0;
+    this->fjournal = NULL;
     this->_initCheck = this;
     ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
 }
@@ -11,9 +11,14 @@
 #include "DesignByContract.h"
 #include <string>
 #include <fstream>
+#include <vector>
 #include "VaccinationCenter.h"
 
 class VaccinationCenter;
+class Journal;
+class Snapshot;
+class CenterTable;
+class Hub;
 
 class Vaccin{
 public:
@@ -67,12 +72,25 @@ public:
      */
     int getVaccin() const;
 
+    /**
+     * \brief Set the Journal that records the changes of the Vaccin
+     *
+     * @param journal Pointer to Journal object, NULL to stop recording
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
+     */
+    void setJournal(Journal *journal);
+
 protected:
     std::string ftype; ///< Type of the vaccin
     int fvaccinTemperature; ///< Temperature required to store the Vaccin
     int fvaccinAmount; ///< Amount of vaccins from this type currently in the hub
     int fvaccinRenewal; ///< Interval between two shots of the Vaccin
+    Journal *fjournal; ///< Journal that records the changes for undo, NULL when changes are not recorded
     Vaccin* _initCheck;
+
+    friend class Journal;
 };
 
 /**
@@ -84,6 +102,21 @@ private:
     int finterval; ///< Time between deliveries
     int ftransport; ///< Amount of vaccins from this type delivered to other VaccinationCenters
     int fdelivered; ///< Total delivered amount of vaccins
+    Hub *fhub; ///< Hub of the Vaccin, its totals are changed with the Vaccin, NULL when not in a Hub
+    const CenterTable *ftypeTable; ///< Table with the column of the Vaccin type, NULL when the Hub isn't bound to one
+    int ftypeIndex; ///< Column of the Vaccin type in ftypeTable
+
+    friend class Journal;
+    friend class Snapshot;
+    friend class Hub;
+    friend class Sweep;
+
+    /**
+     * \brief Set amount of vaccins and change the total of the Hub
+     *
+     * @param amount Amount of vaccins as int
+     */
+    void setVaccinAmount(int amount);
 
 public:
     /**
@@ -185,7 +218,7 @@ public:
     int getInterval() const;
 
     /**
-     * \brief Set interval between deliveries
+     * \brief Set interval between deliveries, the DeliverySchedule of the Hub is built again before the next day
      *
      * @param newInterval New interval between deliveries as int
      *
@@ -274,6 +307,18 @@ public:
      *              false -> (temp >= 0)
      */
     bool checkUnderZero();
+
+    /**
+     * \brief Get the column of the Vaccin type in a CenterTable, set when the Hub of the Vaccin is bound to the table
+     *
+     * @param table Table of the centra the Vaccin is compared with
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
+     *
+     * @return Column of the Vaccin type, -1 when the Vaccin isn't bound to the table
+     */
+    int getTypeIndex(const CenterTable *table) const;
 };
 
 class VaccinInCenter: public Vaccin{
@@ -281,7 +326,45 @@ class VaccinInCenter: public Vaccin{
  * \brief struct implemented to hold every type of Vaccin that the Center has stored
  */
 private:
-    std::map<int, int> ftracker; ///< <Days till second shot, amount of people with first shot>
+    // Tracker <days till second shot, amount of people with first shot>. Days -renewal to -1 are stored in a circular
+    // buffer, so moving a day only moves fringStart. Day 0 holds the people that can get their second shot.
+    std::vector<int> fring; ///< Amount of people with first shot for days -renewal to -1, 0 when the day is not used
+    int fringStart; ///< Index in fring of day -renewal
+    int frequiredDay; ///< Amount of people with first shot on day 0
+    bool frequiredDaySet; ///< Day 0 is used in the tracker
+    // Stock and amount of people with first shot on all days are stored in the row of the VaccinationCenter, a Vaccin
+    // that isn't bound to a table keeps them in fvaccinAmount and fbacklog
+    CenterTable *ftable; ///< Table with the stock and people waiting for their second shot, NULL when not bound
+    int fcenter; ///< Row of the VaccinationCenter in ftable
+    int ftypeIndex; ///< Column of the Vaccin type in ftable
+    int fbacklog; ///< Amount of people with first shot on all days when ftable is NULL
+
+    friend class Journal;
+    friend class Snapshot;
+
+    /**
+     * \brief Get amount of people with first shot on a day from -renewal to -1
+     *
+     * @param day Days till second shot
+     *
+     * @return Reference to the amount in fring
+     */
+    int &ringDay(int day);
+
+    /**
+     * \brief Get amount of people with first shot on a day from -renewal to -1 (const)
+     *
+     * @param day Days till second shot
+     *
+     * @return Amount of people
+     */
+    int ringDay(int day) const;
+
+    /**
+     * \brief Set amount of people with first shot on all days, in ftable when the Vaccin is bound to it
+     */
+    void setBacklog(int people);
+
 public:
     /**
      * \brief Constructor for vaccinType object
@@ -296,7 +379,7 @@ public:
      * ENSURE(this->ftype == vaccinType, "type is not set to given value");
      * ENSURE(this->fvaccinRenewal == vaccinRenewal, "vaccinRenewal is not set to given value");
      * ENSURE(this->fvaccinTemperature == vaccinTemperature, "vaccinTemperature is not set to given value");
-     * ENSURE(this->fvaccinAmount == vaccinAmount, "vaccinAmount is not set to given value");
+     * ENSURE(this->getVaccin() == vaccinAmount, "vaccinAmount is not set to given value");
      */
     VaccinInCenter(const std::string &vaccinType, int vaccinTemperature, int vaccinRenewal, int vaccinAmount);
 
@@ -317,7 +400,7 @@ public:
      * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
      * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
      * REQUIRE(v->fvaccinType != "", "Vaccin type must not be empty")
-     * REQUIRE(v->fvaccinAmount >= 0, "Vaccin must not be negative")
+     * REQUIRE(v->getVaccin() >= 0, "Vaccin must not be negative")
      * REQUIRE(v->fvaccinRenewal >= 0, "Vaccin renewal must not be negative")
      *
      * @post
@@ -325,11 +408,58 @@ public:
      * ENSURE(this->ftype == v->getType(), "type must be the same!");
      * ENSURE(this->fvaccinRenewal == v->getRenewal(), "vaccinRenewal must be the same");
      * ENSURE(this->fvaccinTemperature == v->getTemperature(), "vaccinTemperature must be the same");
-     * ENSURE(this->fvaccinAmount == v->getVaccin(), "vaccinAmount must be the same");
+     * ENSURE(this->getVaccin() == v->getVaccin(), "vaccinAmount must be the same");
      *
      */
     void copyVaccin(const VaccinInCenter *v);
 
+    /**
+     * \brief Destructor for vaccinType object, its stock and people with first shot are removed from the table
+     */
+    ~VaccinInCenter();
+
+    /**
+     * \brief Move the stock and people waiting for their second shot to a row of a CenterTable
+     *
+     * @param table Pointer to CenterTable object
+     * @param center Row of the VaccinationCenter of the Vaccin
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
+     * REQUIRE(table != NULL, "CenterTable must exist")
+     * REQUIRE(center >= 0 && center < table->getCenters(), "VaccinationCenter must be in the table")
+     *
+     * @post
+     * ENSURE(this->getVaccin() == amount, "vaccinAmount must be the same")
+     */
+    void bind(CenterTable *table, int center);
+
+    /**
+     * \brief Get amount of vaccins currently of this type
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
+     *
+     * @return Amount of vaccins as int
+     */
+    int getVaccin() const;
+
+    /**
+     * \brief Get the table with the stock and people waiting for their second shot, NULL when the Vaccin isn't bound
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
+     */
+    const CenterTable *getTable() const;
+
+    /**
+     * \brief Get the column of the Vaccin type in getTable(), -1 when the Vaccin isn't bound
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
+     */
+    int getTypeIndex() const;
+
     /**
      * \brief Get vaccinType amount
      *
@@ -338,27 +468,75 @@ public:
      *
      * @return Amount of Vaccins as int
      */
-    int &getVaccinAmount();
+    int getVaccinAmount() const;
 
     /**
-     * \brief Get vaccinType tracker (const)
+     * \brief Set vaccinType amount
+     *
+     * @param amount Amount of Vaccins as int
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
      *
-     * @return <days left of renewal, amount vaccinated> as std::map<int, int>
+     * @post
+     * ENSURE(this->getVaccinAmount() == amount, "vaccinAmount is not set to given value")
      */
-    const std::map<int, int> &getTracker() const;
+    void setVaccinAmount(int amount);
 
     /**
-     * \brief Get vaccinType tracker
+     * \brief Get vaccinType tracker, only the used days are in the map
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
      *
      * @return <days left of renewal, amount vaccinated> as std::map<int, int>
      */
-    std::map<int, int> &getTracker();
+    std::map<int, int> getTracker() const;
+
+    /**
+     * \brief Check if no day of the tracker is used yet
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
+     *
+     * @return true if getTracker() is empty
+     */
+    bool isTrackerEmpty() const;
+
+    /**
+     * \brief Check if day 0 of the tracker is used, the day of the people that can get their second shot
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
+     *
+     * @return true if day 0 is in getTracker()
+     */
+    bool hasRequiredDay() const;
+
+    /**
+     * \brief Get amount of people that can get their second shot
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
+     *
+     * @return Amount of people on day 0 of the tracker, 0 when the day is not used
+     */
+    int getRequiredDay() const;
+
+    /**
+     * \brief Remove people that got their second shot from day 0 of the tracker
+     *
+     * @param people Amount of people that got their second shot
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
+     * REQUIRE(hasRequiredDay(), "Day 0 must be used in tracker")
+     * REQUIRE(people >= 0 && people <= getRequiredDay(), "Amount of people must be between 0 and the people on day 0")
+     *
+     * @post
+     * ENSURE(hasRequiredDay(), "Day 0 must be used in tracker")
+     */
+    void removeRequiredDay(int people);
 
     /**
      * \brief Update every renewal in tracker and merge if zero
@@ -366,6 +544,8 @@ public:
      * @pre
      * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
      *
+     * @post
+     * ENSURE(hasRequiredDay(), "Day 0 must be used in tracker")
      */
     void addDay();
 
@@ -374,10 +554,11 @@ public:
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Vaccin must be properly initialized")
+     * REQUIRE(day <= 0 && day >= -getRenewal(), "Day left of renewal must be between -renewal and 0");
      * REQUIRE(requiredPeople >= 0, "Amount of peaple can not be negative");
      *
      * @post
-     * ENSURE(requiredPeople == 0 || ftracker.find(day) != ftracker.end(),"Day not added");
+     * ENSURE(requiredPeople == 0 || getTracker().find(day) != getTracker().end(),"Day not added");
      *
      * @param day Day left of renewal to be inserted in map
      * @param requiredPeople Amount of vaccinated people to add or remove
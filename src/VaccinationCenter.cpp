@@ -7,10 +7,26 @@
 
 #include "VaccinationCenter.h"
 #include "Vaccin.h"
+#include "Journal.h"
+#include "CenterTable.h"
+#include <pthread.h>
+
+/**
+ * \brief Sum of the stock or of the people waiting for their second shot of the Vaccin types of a VaccinationCenter
+ *        that isn't bound to a CenterTable
+ */
+static int sumVaccins(const std::map<const std::string, VaccinInCenter*> &vaccins, bool backlog) {
+
+    int total = 0;
+    for (std::map<const std::string, VaccinInCenter*>::const_iterator it = vaccins.begin(); it != vaccins.end(); it++) {
+        total += backlog ? it->second->totalFirstVaccination() : it->second->getVaccinAmount();
+    }
+    return total;
+}
 
 VaccinationCenter::VaccinationCenter(const std::string &fname, const std::string &faddress, int fpopulation
                                      ,int fcapacity) :
-    fname(fname), faddress(faddress), fpopulation(fpopulation),fcapacity(fcapacity){
+    fname(fname), faddress(faddress), fpopulation(fpopulation), fcapacity(fcapacity) {
 
     REQUIRE(fname.length() > 0, "Name can't be empty");
     REQUIRE(faddress.length() > 0, "Adres can't be empty");
@@ -18,8 +34,12 @@ VaccinationCenter::VaccinationCenter(const std::string &fname, const std::string
     REQUIRE(fcapacity >= 0, "Negative capacity");
 
     _initCheck = this;
+    fcreated = countCreated();
+    ftable = NULL;
+    findex = -1;
     fvaccinated = 0;
     fvaccinsType.clear();
+    fjournal = NULL;
 
     ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
     ENSURE(this->getName() == fname, "Value of fname not set");
@@ -42,20 +62,31 @@ void VaccinationCenter::copyVaccinationCenter(const VaccinationCenter *v) {
 
     this->fname = v->getName();
     this->faddress = v->getAddress();
-    this->fpopulation = v->getPopulation();
-    this->fcapacity = v->getCapacity();
-    this->fvaccinated = v->getVaccinated();
+    if (ftable != NULL) {
+        ftable->setPopulation(findex, v->getPopulation());
+        ftable->setCapacity(findex, v->getCapacity());
+    }
+    else {
+        this->fpopulation = v->getPopulation();
+        this->fcapacity = v->getCapacity();
+    }
+    this->setVaccinated(v->getVaccinated());
+    this->fjournal = NULL;
 
-    std::map<const std::string, VaccinInCenter*> vaccins = v->getVaccin(true);
-    std::map<const std::string, VaccinInCenter*> notZeroVaccins = v->getVaccin(false);
-    vaccins.insert(notZeroVaccins.begin(), notZeroVaccins.end());
+    // Vaccin types stored at zero degrees are not part of either list and are not copied
+    for (int zeroVaccin = 0; zeroVaccin < 2; zeroVaccin++) {
 
-    for (std::map<const std::string, VaccinInCenter*>::const_iterator it = vaccins.begin(); it != vaccins.end(); it++) {
+        const std::vector<VaccinInCenter*> &vaccins = v->getVaccinTypes(zeroVaccin == 1);
+        for (std::vector<VaccinInCenter*>::const_iterator it = vaccins.begin(); it != vaccins.end(); it++) {
 
-        VaccinInCenter *vt = new VaccinInCenter();
+            VaccinInCenter *vt = new VaccinInCenter();
 
-        vt->copyVaccin(it->second);
-        this->fvaccinsType.insert(std::make_pair(vt->getType(), vt));
+            vt->copyVaccin(*it);
+            if (ftable != NULL) {
+                vt->bind(ftable, findex);
+            }
+            insertVaccinType(vt);
+        }
     }
     this->_initCheck = this;
     ENSURE(properlyInitialized(), "Copy constructor must end in properlyInitialized state");
@@ -86,48 +117,110 @@ const std::string &VaccinationCenter::getAddress() const {
 int VaccinationCenter::getPopulation() const {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
-    return this->fpopulation;
+    return ftable != NULL ? ftable->getPopulation(findex) : fpopulation;
 }
 
 int VaccinationCenter::getCapacity() const {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
-    return this->fcapacity;
+    return ftable != NULL ? ftable->getCapacity(findex) : fcapacity;
 }
 
 void VaccinationCenter::setCapacity(const int &newCapacity) {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
     REQUIRE(newCapacity >= 0, "Negative capacity");
-    this->fcapacity = newCapacity;
+    if (ftable != NULL) {
+        ftable->setCapacity(findex, newCapacity);
+    }
+    else {
+        fcapacity = newCapacity;
+    }
 }
 
-int VaccinationCenter::getVaccins() const {
+void VaccinationCenter::setJournal(Journal *journal) {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+    this->fjournal = journal;
+    for (std::map<const std::string, VaccinInCenter*>::iterator it = fvaccinsType.begin(); it != fvaccinsType.end(); it++) {
+        it->second->setJournal(journal);
+    }
+}
+
+void VaccinationCenter::bind(CenterTable *table) {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
-    int totalVaccins = 0;
+    REQUIRE(table != NULL, "CenterTable must exist");
 
-    for (std::map<const std::string, VaccinInCenter*>::const_iterator it = fvaccinsType.begin(); it != fvaccinsType.end(); it++) {
-        totalVaccins += it->second->getVaccinAmount();
+    if (table == ftable) {
+        return;
+    }
+    int index = table->addCenter(fname);
+    table->setPopulation(index, this->getPopulation());
+    table->setCapacity(index, this->getCapacity());
+    table->setVaccinated(index, this->getVaccinated());
+    for (std::map<const std::string, VaccinInCenter*>::iterator it = fvaccinsType.begin(); it != fvaccinsType.end(); it++) {
+        it->second->bind(table, index);
+    }
+    ftable = table;
+    findex = index;
+    // The columns of the types are those of the new table
+    ftypes.assign(table->getTypes(), NULL);
+    for (std::map<const std::string, VaccinInCenter*>::iterator it = fvaccinsType.begin(); it != fvaccinsType.end(); it++) {
+        ftypes[it->second->getTypeIndex()] = it->second;
     }
-    ENSURE(checkAmountVaccins(), "Wrong amount of vaccins");
+
+    ENSURE(getTable() == table, "VaccinationCenter is not bound to the table");
+}
+
+const CenterTable *VaccinationCenter::getTable() const {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+    return ftable;
+}
+
+int VaccinationCenter::getIndex() const {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+    return findex;
+}
+
+int VaccinationCenter::getVaccins() const {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+    // Vaccin types the VaccinationCenter does not have are 0 in its row
+    int totalVaccins = ftable != NULL ? ftable->getCenterStock(findex) : sumVaccins(fvaccinsType, false);
+    ENSURE_FULL(checkAmountVaccins(), "Wrong amount of vaccins");
     return totalVaccins;
 }
 
+bool VaccinationCenter::isActive() const {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+    return getVaccins() != 0 || getVaccinated() + totalWaitingForSeccondPrik() > getPopulation();
+}
+
 bool VaccinationCenter::checkAmountVaccins() const {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
-    int totalVaccins = 0;
-    for (std::map<const std::string, VaccinInCenter*>::const_iterator it = fvaccinsType.begin(); it != fvaccinsType.end(); it++) {
-        totalVaccins += it->second->getVaccinAmount();
-    }
+    int totalVaccins = ftable != NULL ? ftable->getCenterStock(findex) : sumVaccins(fvaccinsType, false);
     return totalVaccins <= getCapacity() * 2;
 }
 
 int VaccinationCenter::getVaccinated() const {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
-    return this->fvaccinated;
+    return ftable != NULL ? ftable->getVaccinated(findex) : fvaccinated;
+}
+
+void VaccinationCenter::setVaccinated(int vaccinated) {
+
+    if (ftable != NULL) {
+        ftable->setVaccinated(findex, vaccinated);
+    }
+    else {
+        fvaccinated = vaccinated;
+    }
 }
 
 void VaccinationCenter::addVaccins(const int amount, const VaccinInHub* vaccin) {
@@ -136,22 +229,32 @@ void VaccinationCenter::addVaccins(const int amount, const VaccinInHub* vaccin)
     REQUIRE(amount + this->getVaccins() <= (this->getCapacity() * 2),
                 "Amount of vaccins must not exceed capacity of Center");
 
-    if (this->fvaccinsType.find(vaccin->getType()) == this->fvaccinsType.end()) {
+    VaccinInCenter *vaccinType = findVaccinType(vaccin);
+    if (vaccinType == NULL) {
 
-        VaccinInCenter* vaccinStruct = new VaccinInCenter(vaccin->getType(),vaccin->getTemperature(),
-                                                          vaccin->getRenewal(), 0);
+        vaccinType = new VaccinInCenter(vaccin->getType(),vaccin->getTemperature(), vaccin->getRenewal(), 0);
 
-        this->fvaccinsType.insert(std::make_pair(vaccinStruct->getType(), vaccinStruct));
+        vaccinType->setJournal(fjournal);
+        if (ftable != NULL) {
+            vaccinType->bind(ftable, findex);
+        }
+        insertVaccinType(vaccinType);
+        if (fjournal != NULL) {
+            fjournal->recordVaccinAdded(this, vaccinType);
+        }
+    }
+    if (fjournal != NULL) {
+        fjournal->recordVaccinAmount(vaccinType);
     }
-    this->fvaccinsType.find(vaccin->getType())->second->getVaccinAmount() += amount;
+    vaccinType->setVaccinAmount(vaccinType->getVaccinAmount() + amount);
 
-    ENSURE(checkAmountVaccins(), "Amount of vaccins must not exceed capacity of Center");
-    ENSURE(vaccinsType().find(vaccin->getType())->second->getVaccinAmount() >= amount, "Amount of vaccins must be bigger then the added amount (+= amount)");
+    ENSURE_FULL(checkAmountVaccins(), "Amount of vaccins must not exceed capacity of Center");
+    ENSURE_FULL(vaccinsType().find(vaccin->getType())->second->getVaccinAmount() >= amount, "Amount of vaccins must be bigger then the added amount (+= amount)");
 }
 
 int VaccinationCenter::calculateVaccinationAmount() const {
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
-    int notVaccinated = this->fpopulation - (this->fvaccinated + totalWaitingForSeccondPrik());
+    int notVaccinated = this->getPopulation() - (this->getVaccinated() + totalWaitingForSeccondPrik());
     int smallest = std::min(this->getVaccins(), this->getCapacity());
     return std::min(smallest, notVaccinated);
 }
@@ -160,7 +263,7 @@ int VaccinationCenter::calculateVaccinationAmount(const VaccinInCenter* vaccin,
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
 
-    int notVaccinated = this->fpopulation - (this->fvaccinated + totalWaitingForSeccondPrik());
+    int notVaccinated = this->getPopulation() - (this->getVaccinated() + totalWaitingForSeccondPrik());
     int smallest = std::min(vaccin->getVaccin(), this->getCapacity() - vaccinsUsed);
     return std::min(smallest, notVaccinated);
 }
@@ -171,27 +274,30 @@ int VaccinationCenter::calculateVaccinationAmountSecondShot(VaccinInCenter* vacc
     REQUIRE(firstShot >= 0, "Amount of people recieved first shot must not be negative");
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
 
-    int smallest = std::min(vaccin->getVaccinAmount(), this->fcapacity);
+    int smallest = std::min(vaccin->getVaccinAmount(), this->getCapacity());
     smallest = std::min(smallest, firstShot);
-    int secondShot = std::min(smallest, this->fcapacity - vaccinsUsed);
-    secondShot = std::min(secondShot, this->fpopulation - this->fvaccinated);
+    int secondShot = std::min(smallest, this->getCapacity() - vaccinsUsed);
+    secondShot = std::min(secondShot, this->getPopulation() - this->getVaccinated());
 
     vaccinated += secondShot;
     vaccinsUsed += secondShot;
-    vaccin->getVaccinAmount() -= secondShot;
+    if (fjournal != NULL) {
+        fjournal->recordVaccinAmount(vaccin);
+    }
+    vaccin->setVaccinAmount(vaccin->getVaccinAmount() - secondShot);
 
     // No vaccins left over after serving the second shot
     if (secondShot >= vaccin->getVaccinAmount()) {
         return secondShot;
     }
     else {
-        int notVaccinated = this->fpopulation - (this->fvaccinated + vaccinated);
+        int notVaccinated = this->getPopulation() - (this->getVaccinated() + vaccinated);
 
         if (notVaccinated - totalWaitingForSeccondPrik() - vaccinsUsed >= 0) {
 
-            int smallest_ = std::min(vaccin->getVaccinAmount(), this->fcapacity - secondShot);
+            int smallest_ = std::min(vaccin->getVaccinAmount(), this->getCapacity() - secondShot);
             int newFirstShot = std::min(smallest_, notVaccinated - totalWaitingForSeccondPrik() - vaccinated);
-            newFirstShot = std::min(newFirstShot, this->fcapacity - vaccinsUsed);
+            newFirstShot = std::min(newFirstShot, this->getCapacity() - vaccinsUsed);
 
             if (newFirstShot != 0) {
                 vaccin->insertRequiredDay(vaccin->getRenewal() * (-1), newFirstShot);
@@ -218,59 +324,117 @@ std::map<const std::string, VaccinInCenter*> VaccinationCenter::getVaccin(bool z
 
     std::map<const std::string, VaccinInCenter*> zeroVaccins;
 
-    for (std::map<const std::string, VaccinInCenter*>::const_iterator it = fvaccinsType.begin(); it != fvaccinsType.end(); it++) {
-        if((it->second->getTemperature() < 0 && zeroVaccin) || (it->second->getTemperature() > 0 && !zeroVaccin)) {
-            zeroVaccins.insert(std::make_pair(it->first, it->second));
-        }
+    const std::vector<VaccinInCenter*> &vaccins = getVaccinTypes(zeroVaccin);
+    for (std::vector<VaccinInCenter*>::const_iterator it = vaccins.begin(); it != vaccins.end(); it++) {
+        zeroVaccins.insert(std::make_pair((*it)->getType(), *it));
     }
     return zeroVaccins;
 }
 
-void VaccinationCenter::vaccinateCenter(std::map<const std::string, VaccinInCenter*> vaccinsType, int & vaccinated, int & vaccinsUsed) {
+const std::vector<VaccinInCenter*> &VaccinationCenter::getVaccinTypes(bool zeroVaccin) const {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+    return zeroVaccin ? ffrozenTypes : fcooledTypes;
+}
+
+/**
+ * \brief Order of Vaccin types on name, the order of fvaccinsType
+ */
+static bool typeBefore(const VaccinInCenter *first, const VaccinInCenter *second) {
+
+    return first->getType() < second->getType();
+}
+
+void VaccinationCenter::insertVaccinType(VaccinInCenter *vaccin) {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+    REQUIRE(fvaccinsType.find(vaccin->getType()) == fvaccinsType.end(), "Vaccin type can't yet exist in center");
+
+    fvaccinsType.insert(std::make_pair(vaccin->getType(), vaccin));
+    if (ftable != NULL && vaccin->getTable() == ftable) {
+        if (vaccin->getTypeIndex() >= static_cast<int>(ftypes.size())) {
+            ftypes.resize(vaccin->getTypeIndex() + 1, NULL);
+        }
+        ftypes[vaccin->getTypeIndex()] = vaccin;
+    }
+    if (vaccin->getTemperature() == 0) {
+        return;
+    }
+    std::vector<VaccinInCenter*> &vaccins = vaccin->getTemperature() < 0 ? ffrozenTypes : fcooledTypes;
+    vaccins.insert(std::upper_bound(vaccins.begin(), vaccins.end(), vaccin, typeBefore), vaccin);
+}
+
+void VaccinationCenter::eraseVaccinType(VaccinInCenter *vaccin) {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+
+    fvaccinsType.erase(vaccin->getType());
+    if (ftable != NULL && vaccin->getTable() == ftable && vaccin->getTypeIndex() < static_cast<int>(ftypes.size())) {
+        ftypes[vaccin->getTypeIndex()] = NULL;
+    }
+    std::vector<VaccinInCenter*> &vaccins = vaccin->getTemperature() < 0 ? ffrozenTypes : fcooledTypes;
+    std::vector<VaccinInCenter*>::iterator it = std::find(vaccins.begin(), vaccins.end(), vaccin);
+    if (it != vaccins.end()) {
+        vaccins.erase(it);
+    }
+}
+
+VaccinInCenter *VaccinationCenter::findVaccinType(const VaccinInHub *vaccin) const {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+
+    int type = vaccin->getTypeIndex(ftable);
+    if (type != -1) {
+        return type < static_cast<int>(ftypes.size()) ? ftypes[type] : NULL;
+    }
+    std::map<const std::string, VaccinInCenter*>::const_iterator it = fvaccinsType.find(vaccin->getType());
+    return it == fvaccinsType.end() ? NULL : it->second;
+}
+
+void VaccinationCenter::vaccinateCenter(const std::vector<VaccinInCenter*> &vaccinsType, int & vaccinated, int & vaccinsUsed) {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
-    REQUIRE(checkAmountVaccins(), "Amount of vaccins must not exceed capacity");
+    REQUIRE_FULL(checkAmountVaccins(), "Amount of vaccins must not exceed capacity");
 
-    for (std::map<const std::string, VaccinInCenter*>::iterator it = vaccinsType.begin(); it != vaccinsType.end(); it++) {
+    for (std::vector<VaccinInCenter*>::const_iterator it = vaccinsType.begin(); it != vaccinsType.end(); it++) {
 
         // Vaccin with renewal
-        if (it->second->isRenewal()) {
+        if ((*it)->isRenewal()) {
 
             // Population did not yet get a first Vaccin shot
-            if (it->second->getTracker().empty()) {
+            if ((*it)->isTrackerEmpty()) {
 
-                int vaccinAmount = calculateVaccinationAmount(it->second, vaccinsUsed);
+                int vaccinAmount = calculateVaccinationAmount(*it, vaccinsUsed);
                 vaccinsUsed += vaccinAmount;
-                it->second->getVaccinAmount() -= vaccinAmount;
+                if (fjournal != NULL) {
+                    fjournal->recordVaccinAmount(*it);
+                }
+                (*it)->setVaccinAmount((*it)->getVaccinAmount() - vaccinAmount);
                 // Insert in tracker-map
-                it->second->insertRequiredDay(it->second->getRenewal() * (-1), vaccinAmount);
+                (*it)->insertRequiredDay((*it)->getRenewal() * (-1), vaccinAmount);
             }
 
             // Population has already recieved a first Vaccins shot
-            else {
-                std::map<int, int> & firstShot = it->second->getTracker();
-
-                for (std::map<int, int>::iterator ite = firstShot.begin(); ite != firstShot.end(); ite++) {
-
-                    // Renewal interval is over
-                    if (ite->first == 0) {
-
-                        // Return secondShot amount
-                        int vaccinAmount = calculateVaccinationAmountSecondShot(it->second, ite->second,
-                                                                                vaccinated, vaccinsUsed);
-                        // Remove from map
-                        ite->second -= vaccinAmount;
-                    }
-                }
+            // Renewal interval is over
+            else if ((*it)->hasRequiredDay()) {
+
+                // Return secondShot amount
+                int vaccinAmount = calculateVaccinationAmountSecondShot(*it, (*it)->getRequiredDay(),
+                                                                        vaccinated, vaccinsUsed);
+                // Remove from tracker
+                (*it)->removeRequiredDay(vaccinAmount);
             }
         }
 
         // Vaccin without renewal
         else {
-            int vaccinAmount = calculateVaccinationAmount(it->second, vaccinsUsed);
+            int vaccinAmount = calculateVaccinationAmount(*it, vaccinsUsed);
             vaccinated += vaccinAmount;
             vaccinsUsed += vaccinAmount;
-            it->second->getVaccinAmount() -= vaccinAmount;
+            if (fjournal != NULL) {
+                fjournal->recordVaccinAmount(*it);
+            }
+            (*it)->setVaccinAmount((*it)->getVaccinAmount() - vaccinAmount);
         }
     }
 
@@ -280,80 +444,93 @@ void VaccinationCenter::vaccinateCenter(std::map<const std::string, VaccinInCent
 void VaccinationCenter::print(std::ostream &stream) const {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
-    stream << this->fname << ": " << this->fvaccinated << " inwoners gevaccineerd, nog ";
-    stream << (this->fpopulation - this->fvaccinated) << " inwoners niet gevaccineerd\n";
+    stream << this->fname << ": " << this->getVaccinated() << " inwoners gevaccineerd, nog ";
+    stream << (this->getPopulation() - this->getVaccinated()) << " inwoners niet gevaccineerd\n";
 }
 
 void VaccinationCenter::printGraphical(std::ostream &stream) const {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
 
-    int perVaccin = ToPercent(this->getVaccins(), fcapacity);
-    int perVaccinated = ToPercent(fvaccinated, fpopulation);
+    TextSink text(stream);
+    recordStock(text);
+}
 
-    if(perVaccin > 100) {
-        perVaccin = 100;
-    }
+void VaccinationCenter::recordStock(EventSink &sink) const {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
 
-    stream << this->fname << ":" << "\n";
-    stream << "\t" << "- geavaccineerd " << ProgressBar(perVaccinated, 20) << " " <<  perVaccinated << "%" << ": " << fvaccinated << "/" << fpopulation << "\n";
-//    stream << "\t \t- " << "Totaal volledig: " << ": " << fvaccinated << "/" << fpopulation << "\n";
-    stream << "\t" << "- " << "vaccins       " << ProgressBar(perVaccin, 20)   << " "<< perVaccin << "%" <<"\n";
+    sink.record(EventSink::centerStock(this->fname, this->getVaccins(), this->getVaccinated(), this->getPopulation(),
+                                       this->getCapacity()));
     for (std::map<const std::string, VaccinInCenter*>::const_iterator it = fvaccinsType.begin(); it != fvaccinsType.end(); it++) {
-        stream << "\t \t- " << it->first << ": " << it->second->getVaccinAmount() << "\n";
-        if(it->second->totalFirstVaccination() != 0)
-            stream << "\t \t \t- " << "Eerste prik: " << ": " << it->second->totalFirstVaccination() << "\n";
+        sink.record(EventSink::vaccinStock(this->fname, it->first, it->second->getVaccinAmount(),
+                                           it->second->totalFirstVaccination()));
     }
 }
 
-std::string VaccinationCenter::stockToSize() const {
+double VaccinationCenter::stockToScale() const {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
 
     // Min size
     if (this->getVaccins() == 0) {
 
-        return "scale = 0.05\n";
+        return 0.05;
     }
     // Max size
-    else if (this->getVaccins() == this->fcapacity) {
+    else if (this->getVaccins() == this->getCapacity()) {
 
-        return "scale = 0.12\n";
+        return 0.12;
     }
     else {
         double scale = 0.05;
-        scale += 0.07 * ToPercent(this->getVaccins(), fcapacity) / 100;
-        return "scale = " + ToString(scale) + "\n";
+        scale += 0.07 * ToPercent(this->getVaccins(), this->getCapacity()) / 100;
+        return scale;
     }
 }
 
-std::string VaccinationCenter::vaccinatedToColor() const {
+std::string VaccinationCenter::stockToSize() const {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+
+    return "scale = " + ToString(stockToScale()) + "\n";
+}
+
+Scene::Color VaccinationCenter::vaccinatedToRgb() const {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
 
     // Red
-    if (this->fvaccinated == 0) {
+    if (this->getVaccinated() == 0) {
 
-        return "color = (1, 0, 0)\n";
+        return Scene::Color(1, 0, 0);
     }
     // Green
-    else if (this->fvaccinated == this->fpopulation) {
+    else if (this->getVaccinated() == this->getPopulation()) {
 
-        return "color = (0, 1, 0)\n";
+        return Scene::Color(0, 1, 0);
     }
     // Mix between Red and Green
     else {
 
-        double a = static_cast<double>(fvaccinated) / fpopulation;
+        double a = static_cast<double>(this->getVaccinated()) / this->getPopulation();
         a = static_cast<double>(a * 100);
 
         double red = 1.0 - a / 100;
         double green = 0.0 + a / 100;
-        return "color = (" + ToString(red) + ", " + ToString(green) + ", 0)\n";
+        return Scene::Color(red, green, 0);
     }
 }
 
-std::pair<double, double> VaccinationCenter::generateIni(std::ofstream & stream, int& counterFigures,
+std::string VaccinationCenter::vaccinatedToColor() const {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+
+    Scene::Color color = vaccinatedToRgb();
+    return "color = (" + ToString(color.red) + ", " + ToString(color.green) + ", " + ToString(color.blue) + ")\n";
+}
+
+std::pair<double, double> VaccinationCenter::generateIni(std::ostream & stream, int& counterFigures,
                                                          int & counterCenter, const double & maxHubX) const {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
@@ -378,6 +555,18 @@ std::pair<double, double> VaccinationCenter::generateIni(std::ofstream & stream,
     return std::make_pair(positionX, 1.2);
 }
 
+Scene::Vector3 VaccinationCenter::generateScene(Scene &scene, int &counterCenter) const {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+    REQUIRE(scene.properlyInitialized(), "Scene must be properly initialized");
+
+    // Same place, size and color as in the .ini file of generateIni
+    counterCenter++;
+    Scene::Vector3 position(static_cast<double>(counterCenter) / 1.5, 1.2, 0);
+    scene.addFigure(Scene::Figure(Scene::Figure::kCube, stockToScale(), position, vaccinatedToRgb()));
+    return position;
+}
+
 std::map<std::string, int> VaccinationCenter::requiredAmountVaccinType() {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
@@ -394,24 +583,35 @@ std::map<std::string, int> VaccinationCenter::requiredAmountVaccinType() {
 void VaccinationCenter::vaccinateCenter(std::ostream &stream) {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
-    REQUIRE(checkAmountVaccins(), "Amount of vaccins must not exceed capacity");
+    REQUIRE_FULL(checkAmountVaccins(), "Amount of vaccins must not exceed capacity");
+
+    TextSink text(stream);
+    vaccinateCenter(text);
+}
+
+void VaccinationCenter::vaccinateCenter(EventSink &sink) {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+    REQUIRE_FULL(checkAmountVaccins(), "Amount of vaccins must not exceed capacity");
 
     int vaccinated = 0;
     int vaccinsUsed = 0;
 
-    vaccinateCenter(getVaccin(true), vaccinated, vaccinsUsed);
+    vaccinateCenter(ffrozenTypes, vaccinated, vaccinsUsed);
 
-    vaccinateCenter(getVaccin(false), vaccinated, vaccinsUsed);
+    vaccinateCenter(fcooledTypes, vaccinated, vaccinsUsed);
 
-    this->fvaccinated += vaccinated;
+    if (fjournal != NULL) {
+        fjournal->recordCenterVaccinated(this);
+    }
+    setVaccinated(this->getVaccinated() + vaccinated);
 
-    if(vaccinsUsed == 0 && this->fvaccinated + this->totalWaitingForSeccondPrik() == this->getPopulation()){
+    if(vaccinsUsed == 0 && this->getVaccinated() + this->totalWaitingForSeccondPrik() == this->getPopulation()){
         for(std::map<const std::string, VaccinInCenter*>::const_iterator it = fvaccinsType.begin();
         it != fvaccinsType.end(); it++) {
             if (it->second->totalFirstVaccination() <= 0 && it->second->getVaccinAmount() > 0) {
 
-                stream << "Er werden " << it->second->getVaccinAmount() << " onodige vaccins van " << it->second->getType();
-                stream << " verwijderd." << std::endl;
+                sink.record(EventSink::discard(this->fname, it->second->getType(), it->second->getVaccinAmount()));
                 it->second->removeVaccin();
             }
         }
@@ -422,7 +622,7 @@ void VaccinationCenter::vaccinateCenter(std::ostream &stream) {
     if (vaccinated == 0) {
         return;
     }
-    stream << "Er werden " << vaccinated << " inwoners gevaccineerd in " << this->fname << ".\n";
+    sink.record(EventSink::vaccination(this->fname, vaccinated));
 }
 
 int VaccinationCenter::getOpenVaccinStorage(VaccinInHub* vaccin) {
@@ -430,37 +630,70 @@ int VaccinationCenter::getOpenVaccinStorage(VaccinInHub* vaccin) {
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
     REQUIRE(vaccin->properlyInitialized(), "VaccinationCenter must be properly initialized");
 
-
-    std::map<std::string, int> requiredVaccins = this->requiredAmountVaccinType();
+    VaccinInCenter *required = findVaccinType(vaccin);
     if((this->getPopulation() - this->getVaccinated() - this->totalWaitingForSeccondPrik()) <= this->getVaccins()
-    && (requiredVaccins.find(vaccin->getType()) == requiredVaccins.end() || requiredVaccins.find(vaccin->getType())->second == 0)){
+    && (required == NULL || requiredAmountVaccin(required) == 0)){
         //indien er voldoende vaccins op vooraad zijn om iedereen te vaccineren
         return 0;
     }
 
-    std::map<const std::string, VaccinInCenter*> zeroVaccins;
-    int openVaccinStorageTotal = this->getCapacity() * 2;
-    int openVaccinStorage = openVaccinStorageTotal;
+    // Types the center does not have are 0 in its row of the table
+    int openVaccinStorageTotal = this->getCapacity() * 2 - this->getVaccins();
+    int openVaccinStorage = this->getCapacity() * 2;
     if(vaccin->checkUnderZero()){
         openVaccinStorage = this->getCapacity();
     }
 
-    for (std::map<const std::string, VaccinInCenter*>::const_iterator it = fvaccinsType.begin(); it != fvaccinsType.end(); it++){
-        if((it->second->getTemperature() < 0 && vaccin->checkUnderZero()) || (it->second->getTemperature() > 0 && !vaccin->checkUnderZero())) {
-            openVaccinStorage -= it->second->getVaccinAmount();
-        }
-        openVaccinStorageTotal -= it->second->getVaccinAmount();
+    const std::vector<VaccinInCenter*> &vaccins = getVaccinTypes(vaccin->checkUnderZero());
+    for (std::vector<VaccinInCenter*>::const_iterator it = vaccins.begin(); it != vaccins.end(); it++){
+        openVaccinStorage -= (*it)->getVaccinAmount();
     }
 
     int minimum = std::min(openVaccinStorageTotal, openVaccinStorage);
     return std::min(minimum, std::max(this->getPopulation() - this->getVaccinated() - this->getVaccins(), vaccin->getTransport()));
 }
 
+int VaccinationCenter::getOpenLoads(VaccinInHub* vaccin) {
+
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+    REQUIRE(vaccin->properlyInitialized(), "VaccinationCenter must be properly initialized");
+    REQUIRE(vaccin->getTransport() > 0, "Transport must be positive");
+
+    int transport = vaccin->getTransport();
+
+    // Every load takes a transport of the storage of all types and of the storage of its temperature
+    int openVaccinStorageTotal = this->getCapacity() * 2 - this->getVaccins();
+    int openVaccinStorage = this->getCapacity() * 2;
+    if(vaccin->checkUnderZero()){
+        openVaccinStorage = this->getCapacity();
+    }
+    const std::vector<VaccinInCenter*> &vaccins = getVaccinTypes(vaccin->checkUnderZero());
+    for (std::vector<VaccinInCenter*>::const_iterator it = vaccins.begin(); it != vaccins.end(); it++){
+        openVaccinStorage -= (*it)->getVaccinAmount();
+    }
+    int minimum = std::min(openVaccinStorageTotal, openVaccinStorage);
+    int loads = minimum >= transport ? minimum / transport : 0;
+
+    // No storage is left once there are vaccins for everyone who isn't vaccinated or waiting and the vaccins for
+    // the second shots of the type are there
+    int unvaccinated = this->getPopulation() - this->getVaccinated() - this->totalWaitingForSeccondPrik()
+            - this->getVaccins();
+    int required = 0;
+    VaccinInCenter *type = findVaccinType(vaccin);
+    if (type != NULL) {
+        required = type->getRequiredDay() - type->getVaccinAmount();
+    }
+    int needed = std::max(unvaccinated, required);
+    int neededLoads = needed > 0 ? (needed - 1) / transport + 1 : 0;
+
+    return std::min(loads, neededLoads);
+}
+
 int VaccinationCenter::requiredAmountVaccin(VaccinInCenter *vaccin) {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
 
-    int needed = vaccin->getTracker().find(0)->second - vaccin->getVaccinAmount();
+    int needed = vaccin->getRequiredDay() - vaccin->getVaccinAmount();
     if(needed < 0) {
         needed = 0;
     }
@@ -479,20 +712,37 @@ VaccinationCenter::~VaccinationCenter() {
 int VaccinationCenter::totalWaitingForSeccondPrik() const {
 
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
-
-    int total = 0;
-    for(std::map<const std::string, VaccinInCenter*>::const_iterator it = fvaccinsType.begin(); it != fvaccinsType.end(); it++){
-        total += it->second->totalFirstVaccination();
-    }
-    return total;
+    return ftable != NULL ? ftable->getCenterBacklog(findex) : sumVaccins(fvaccinsType, true);
 }
 
 VaccinationCenter::VaccinationCenter() {
+    fjournal = NULL;
+    fcreated = countCreated();
+    ftable = NULL;
+    findex = -1;
+    fpopulation = 0;
+    fcapacity = 0;
+    fvaccinated = 0;
     _initCheck = this;
     ENSURE(properlyInitialized(), "Constructor must end in properlyInitialized state");
 }
 
-const std::map<const std::string, VaccinInCenter *> VaccinationCenter::vaccinsType() const {
+const std::map<const std::string, VaccinInCenter *> &VaccinationCenter::vaccinsType() const {
     REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
     return fvaccinsType;
 }
+
+unsigned long VaccinationCenter::getCreated() const {
+    REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized");
+    return fcreated;
+}
+
+unsigned long VaccinationCenter::countCreated() {
+    static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    static unsigned long created = 0;
+
+    pthread_mutex_lock(&mutex);
+    unsigned long count = created++;
+    pthread_mutex_unlock(&mutex);
+    return count;
+}
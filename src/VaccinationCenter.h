@@ -17,26 +17,91 @@
 #include <fstream>
 #include "DesignByContract.h"
 #include "Utils.h"
+#include "Scene.h"
+#include "EventSink.h"
 
 /**
  * \brief Forward declaration of the Vaccin class
  */
 class VaccinInHub;
 class VaccinInCenter;
+class Journal;
+class Snapshot;
+class CenterTable;
 
 /**
  * \brief Class implemented for a VaccinationCenter
+ *
+ * Population, capacity and vaccinated people are stored in a row of a CenterTable. A VaccinationCenter that is not
+ * bound to a CenterTable keeps them in its own fields until it is bound.
  */
 class VaccinationCenter {
 private:
     std::string fname; ///< Name of the VaccinationCenter
     std::string faddress; ///< Address of the VaccinationCenter
-    int fpopulation; ///< Amount of people the VaccinationCenter is responsible for
-    int fcapacity; ///< Amount of peaple that can be vaccined on one day
-    int fvaccinated; ///< Amount of people already vaccinated
+    CenterTable *ftable; ///< Table with the values of the VaccinationCenter, NULL when not bound
+    int findex; ///< Row of the VaccinationCenter in ftable
+    int fpopulation; ///< Amount of people the VaccinationCenter is responsible for when ftable is NULL
+    int fcapacity; ///< Amount of people that can be vaccinated on one day when ftable is NULL
+    int fvaccinated; ///< Amount of people already vaccinated when ftable is NULL
     std::map<const std::string, VaccinInCenter*> fvaccinsType; ///< Map with name of vaccin type and pointer to vaccinType
+    std::vector<VaccinInCenter*> ffrozenTypes; ///< Vaccin types stored under zero, sorted on name
+    std::vector<VaccinInCenter*> fcooledTypes; ///< Vaccin types stored above zero, sorted on name
+    std::vector<VaccinInCenter*> ftypes; ///< Vaccin type of every column of ftable, NULL for types the center hasn't
+    Journal *fjournal; ///< Journal that records the changes for undo, NULL when changes are not recorded
+    unsigned long fcreated; ///< Amount of VaccinationCenters created before this one
     VaccinationCenter *_initCheck;
 
+    friend class Journal;
+    friend class Snapshot;
+
+    /**
+     * \brief Add a Vaccin type to fvaccinsType and to the list of its temperature
+     *
+     * @param vaccin Pointer to vaccinType object
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     * REQUIRE(fvaccinsType.find(vaccin->getType()) == fvaccinsType.end(), "Vaccin type can't yet exist in center")
+     */
+    void insertVaccinType(VaccinInCenter *vaccin);
+
+    /**
+     * \brief Gives the amount of VaccinationCenters created before and counts a new VaccinationCenter, safe to call
+     *        from several threads
+     *
+     * @return Amount of VaccinationCenters created before
+     */
+    static unsigned long countCreated();
+
+    /**
+     * \brief Remove a Vaccin type from fvaccinsType and from the list of its temperature, the Vaccin is not deleted
+     *
+     * @param vaccin Pointer to vaccinType object
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     */
+    void eraseVaccinType(VaccinInCenter *vaccin);
+
+    /**
+     * \brief Find the Vaccin type of a Vaccin of a Hub, on its column in ftable when the Hub is bound to ftable and
+     *        on its name when not
+     *
+     * @param vaccin Vaccin of a Hub
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     *
+     * @return Vaccin type of the center, NULL when the center doesn't have the type
+     */
+    VaccinInCenter *findVaccinType(const VaccinInHub *vaccin) const;
+
+    /**
+     * \brief Set amount of people already vaccinated, in ftable when the VaccinationCenter is bound to it
+     */
+    void setVaccinated(int vaccinated);
+
 public:
     /**
      * \brief Non-default constructor for a VaccinationCenter object
@@ -154,6 +219,50 @@ public:
      */
     void setCapacity(const int &newCapacity);
 
+    /**
+     * \brief Set the Journal that records the changes of the VaccinationCenter and its vaccins
+     *
+     * @param journal Pointer to Journal object, NULL to stop recording
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     */
+    void setJournal(Journal *journal);
+
+    /**
+     * \brief Move the values of the VaccinationCenter and its vaccins to a row of a CenterTable
+     *
+     * @param table Pointer to CenterTable object, the row is the one with the name of the VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     * REQUIRE(table != NULL, "CenterTable must exist")
+     *
+     * @post
+     * ENSURE(getTable() == table, "VaccinationCenter is not bound to the table")
+     */
+    void bind(CenterTable *table);
+
+    /**
+     * \brief Get the CenterTable with the values of the VaccinationCenter
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     *
+     * @return Pointer to CenterTable object, NULL when the VaccinationCenter isn't bound
+     */
+    const CenterTable *getTable() const;
+
+    /**
+     * \brief Get the row of the VaccinationCenter in getTable()
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     *
+     * @return Index as int, -1 when the VaccinationCenter isn't bound
+     */
+    int getIndex() const;
+
     /**
      * \brief Get amount of vaccins of the VaccinationCenter
      *
@@ -164,6 +273,17 @@ public:
      */
     int getVaccins() const;
 
+    /**
+     * \brief Check if vaccinating the VaccinationCenter can change it, this is when it has vaccins in stock or counts
+     *        more people vaccinated or waiting for a second shot than its population
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     *
+     * @return true when the VaccinationCenter has to be vaccinated
+     */
+    bool isActive() const;
+
     /**
      * \brief Get amount of vaccins of the VaccinationCenter
      *
@@ -195,8 +315,8 @@ public:
      * REQUIRE(amount + this->getVaccins() <= (this->getCapacity() * 2), "Amount of vaccins must not exceed capacity of Center")
      *
      * @post
-     * ENSURE(checkAmountVaccins(), "Amount of vaccins must not exceed capacity of Center");
-     * ENSURE(vaccinsType().find(vaccin->getType())->second->getVaccinAmount() >= amount, "Amount of vaccins must be bigger then the added amount (+= amount)");
+     * ENSURE_FULL(checkAmountVaccins(), "Amount of vaccins must not exceed capacity of Center");
+     * ENSURE_FULL(vaccinsType().find(vaccin->getType())->second->getVaccinAmount() >= amount, "Amount of vaccins must be bigger then the added amount (+= amount)");
      */
     void addVaccins(const int amount, const VaccinInHub* vaccin);
 
@@ -209,7 +329,18 @@ public:
      *
      * @return map with name of vaccin type and pointer to vaccinType
      */
-    const std::map<const std::string, VaccinInCenter*> vaccinsType() const;
+    const std::map<const std::string, VaccinInCenter*> &vaccinsType() const;
+
+    /**
+     * \brief Gives the amount of VaccinationCenters created before this one, centra that are read from a file are
+     *        created in the order of the file
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     *
+     * @return Amount of VaccinationCenters created before
+     */
+    unsigned long getCreated() const;
 
     /**
      * \brief  gives amount of people that need an vaccin
@@ -273,6 +404,18 @@ public:
     */
     std::map<const std::string, VaccinInCenter*> getVaccin(bool zeroVaccin) const;
 
+    /**
+    * \brief Gives the Vaccins with temp under zero or the Vaccins with temp above zero, sorted on name
+    *
+    * @param zeroVaccin: true -> underZero vaccins, false -> aboveZero vaccins
+    *
+    * @pre
+    * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+    *
+    * @return Vector with pointers to the vaccinType objects
+    */
+    const std::vector<VaccinInCenter*> &getVaccinTypes(bool zeroVaccin) const;
+
     /**
      * \brief Vaccinate center and update fvaccins, will also delete any Vaccins that may not be needed and will cause
      *        problems for the Simulation
@@ -281,7 +424,7 @@ public:
      *
      * @pre
      * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
-     * REQUIRE(checkAmountVaccins(), "Amount of vaccins must not exceed capacity")
+     * REQUIRE_FULL(checkAmountVaccins(), "Amount of vaccins must not exceed capacity")
      *
      * @post
      * ENSURE(vaccinsUsed <= this->getCapacity(), "Amount of vaccinations must not exceed capacity")
@@ -291,19 +434,32 @@ public:
     void vaccinateCenter(std::ostream &stream);
 
     /**
-     * \brief Vaccinate all vaccins in a given map
+     * \brief Vaccinate center like vaccinateCenter(std::ostream &), with an event for every discard and the vaccination
+     *
+     * @param sink Sink for the events
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     * REQUIRE_FULL(checkAmountVaccins(), "Amount of vaccins must not exceed capacity")
+     *
+     * @post
+     * ENSURE(this->getVaccinated() <= this->getPopulation(), "Peaple that are vaccinated can not be more than the population")
+     */
+    void vaccinateCenter(EventSink &sink);
+
+    /**
+     * \brief Vaccinate all vaccins in a given list
      *
-     * @param vaccinsType Map of vaccins with name of vaccinType and pointer to vaccinType object
+     * @param vaccinsType Vector with pointers to the vaccinType objects
      * @param vaccinated Total amount of people vaccinated by the center that day
      * @param vaccinsUsed Total amount of vaccins used by the center that day
      *
      * @pre
      * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
-     * REQUIRE(checkAmountVaccins(), "Amount of vaccins must not exceed capacity")
+     * REQUIRE_FULL(checkAmountVaccins(), "Amount of vaccins must not exceed capacity")
      *
      */
-    void vaccinateCenter(std::map<const std::string, VaccinInCenter*> vaccinsType, int & vaccinated,
-                                        int & vaccinsUsed);
+    void vaccinateCenter(const std::vector<VaccinInCenter*> &vaccinsType, int & vaccinated, int & vaccinsUsed);
 
     /**
      * \brief Print out data of VaccinationCenter
@@ -325,6 +481,16 @@ public:
      */
     void printGraphical(std::ostream &stream) const;
 
+    /**
+     * \brief Record the stock of the VaccinationCenter and of every Vaccin type, the events of printGraphical
+     *
+     * @param sink Sink for the events
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     */
+    void recordStock(EventSink &sink) const;
+
     /**
      * \brief Gives the amount of vaccines needed for 2nd vaccination today
      *
@@ -347,6 +513,20 @@ public:
      */
     int getOpenVaccinStorage(VaccinInHub* vaccin);
 
+    /**
+     * \brief Gives the amount of loads of a Vaccin the VaccinationCenter can store one after another, every load is a
+     *        transport of the Vaccin that fits in getOpenVaccinStorage() after the loads before it
+     *
+     * @param vaccin Pointer to Vaccin object
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     * REQUIRE(vaccin->getTransport() > 0, "Transport must be positive")
+     *
+     * @return Amount of loads
+     */
+    int getOpenLoads(VaccinInHub* vaccin);
+
     /**
      * \brief Gives the amount of vaccines needed for 2nd vaccination of current day
      *
@@ -359,6 +539,17 @@ public:
      */
     int requiredAmountVaccin(VaccinInCenter *vaccin);
 
+    /**
+     * \brief Calculate the scale of the VaccinationCenter in a 3D-environment depending on the number
+     *        of Vaccins in the Center versus the total number of Vaccins that can be stored (=capacity)
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     *
+     * @return Scale of Center in 3D-environment
+     */
+    double stockToScale() const;
+
     /**
      * \brief Calculate the scale of the VaccinationCenter in a 3D-environment depending on the number
      *        of Vaccins in the Center versus the total number of Vaccins that can be stored (=capacity)
@@ -381,6 +572,17 @@ public:
      */
     std::string vaccinatedToColor() const;
 
+    /**
+     * \brief Calculate color of VaccinationCenter in 3D-environment depending on the number of people already
+     *        vaccinated versus the population that the Center operates in
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     *
+     * @return Color of Center in 3D-environment
+     */
+    Scene::Color vaccinatedToRgb() const;
+
     /**
      * \brief Generate a .ini file that describes the VaccinationCenter in a 3D-environment
      *
@@ -394,9 +596,23 @@ public:
      *
      * @return x-value and y-value of the Cartesian coordinates of Center as pair of doubles
      */
-    std::pair<double, double> generateIni(std::ofstream & stream, int & counterFigures, int & counterCenter,
+    std::pair<double, double> generateIni(std::ostream & stream, int & counterFigures, int & counterCenter,
                                           const double & maxHubX) const;
 
+    /**
+     * \brief Add the VaccinationCenter to a Scene, as a cube like in the .ini file of generateIni
+     *
+     * @param scene The Scene
+     * @param counterCenter Current number of Centra already in the Scene
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "VaccinationCenter must be properly initialized")
+     * REQUIRE(scene.properlyInitialized(), "Scene must be properly initialized")
+     *
+     * @return Cartesian coordinates of Center
+     */
+    Scene::Vector3 generateScene(Scene &scene, int &counterCenter) const;
+
     /**
      * \brief Calculate total amount of people wainting for a second shot for all the Vaccins the Center stores
      *
@@ -0,0 +1,390 @@
+/**
+ * @file VdBenchmarks.cpp
+ * @brief This file is used to measure the import and the simulation of a day on generated simulations
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstdlib>
+#include <dirent.h>
+#include <sstream>
+#include <unistd.h>
+#include "Simulation.h"
+#include "XMLReader.h"
+#include "XMLStreamReader.h"
+#include "TagSchema.h"
+#include "VaccinationCenter.h"
+#include "Vaccin.h"
+#include "Hub.h"
+#include "ScenarioGenerator.h"
+
+/**
+ * \brief Days simulated before a part of a day is measured, longer than the renewal of the generated Vaccins so
+ *        second shots are needed
+ */
+static const int kWarmUpDays = 25;
+
+/**
+ * \brief Days simulated by automaticSimulation
+ */
+static const int kSimulationDays = 30;
+
+/**
+ * \brief Generate a simulation file with the given amount of hubs, centra and Vaccin types, the same sizes give
+ *        the same file
+ *
+ * @param state Benchmark state, range(0) hubs, range(1) centra and range(2) Vaccin types
+ *
+ * @return Path of the simulation file
+ */
+static std::string scenarioFile(const benchmark::State &state) {
+
+    int hubs = static_cast<int>(state.range(0));
+    int centra = static_cast<int>(state.range(1));
+    int types = static_cast<int>(state.range(2));
+
+    std::string path = "scenario-" + ToString(hubs) + "-" + ToString(centra) + "-" + ToString(types) + ".xml";
+    if (FileExists(path)) {
+        return path;
+    }
+
+    ScenarioGenerator generator(1);
+    generator.setSize(hubs, centra);
+    generator.setVaccinTypes(types, types, 40, 20);
+    generator.generateFile(path);
+    return path;
+}
+
+/**
+ * \brief Import a simulation file and simulate a number of days
+ *
+ * @param path Path of the simulation file
+ * @param days Days to simulate
+ *
+ * @return Pointer to the Simulation object, deleted by the caller
+ */
+static Simulation *buildSimulation(const std::string &path, int days) {
+
+    // One thread, so the measurements do not depend on the amount of cores of the machine
+    Simulation *simulation = new Simulation();
+    simulation->setThreads(1);
+    simulation->importXmlFile(path.c_str());
+    std::ostringstream stream;
+    simulation->automaticSimulation(days, stream, false, false);
+    return simulation;
+}
+
+/**
+ * \brief Sizes of the generated simulations: hubs, centra, Vaccin types
+ */
+static void scenarioSizes(benchmark::internal::Benchmark *benchmark) {
+
+    benchmark->ArgNames({"hubs", "centra", "types"});
+    benchmark->Args({1, 8, 2});
+    benchmark->Args({2, 64, 3});
+    benchmark->Args({4, 256, 5});
+    benchmark->Unit(benchmark::kMicrosecond);
+}
+
+static void BM_ReadVaccinationCenters(benchmark::State &state) {
+
+    std::string path = scenarioFile(state);
+    std::ostringstream errors;
+    for (auto _ : state) {
+        XMLReader reader(path.c_str());
+        std::map<std::string, VaccinationCenter *> centra = reader.readVaccinationCenters(errors);
+
+        state.PauseTiming();
+        for (std::map<std::string, VaccinationCenter *>::iterator it = centra.begin(); it != centra.end(); it++) {
+            delete it->second;
+        }
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_ReadVaccinationCenters)->Apply(scenarioSizes);
+
+static void BM_ReadHubs(benchmark::State &state) {
+
+    std::string path = scenarioFile(state);
+    std::ostringstream errors;
+    XMLReader reader(path.c_str());
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::map<std::string, VaccinationCenter *> centra = reader.readVaccinationCenters(errors);
+        state.ResumeTiming();
+
+        std::vector<Hub *> hubs = reader.readHubs(centra, errors);
+
+        state.PauseTiming();
+        for (std::vector<Hub *>::iterator it = hubs.begin(); it != hubs.end(); it++) {
+            delete *it;
+        }
+        for (std::map<std::string, VaccinationCenter *>::iterator it = centra.begin(); it != centra.end(); it++) {
+            delete it->second;
+        }
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_ReadHubs)->Apply(scenarioSizes);
+
+static void BM_StreamReadScenario(benchmark::State &state) {
+
+    std::string path = scenarioFile(state);
+    std::ostringstream errors;
+    for (auto _ : state) {
+        XMLStreamReader reader(path.c_str());
+        std::map<std::string, VaccinationCenter *> centra = reader.readVaccinationCenters(errors);
+        std::vector<Hub *> hubs = reader.readHubs(centra, errors);
+
+        state.PauseTiming();
+        for (std::vector<Hub *>::iterator it = hubs.begin(); it != hubs.end(); it++) {
+            delete *it;
+        }
+        for (std::map<std::string, VaccinationCenter *>::iterator it = centra.begin(); it != centra.end(); it++) {
+            delete it->second;
+        }
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_StreamReadScenario)->Apply(scenarioSizes);
+
+static void BM_ImportXmlFile(benchmark::State &state) {
+
+    std::string path = scenarioFile(state);
+    for (auto _ : state) {
+        Simulation *simulation = new Simulation();
+        simulation->importXmlFile(path.c_str());
+
+        state.PauseTiming();
+        delete simulation;
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_ImportXmlFile)->Apply(scenarioSizes);
+
+static void BM_ImportXmlFileKnownTags(benchmark::State &state) {
+
+    // The tags of a generated simulation file, the schema is built once and used for every import
+    const char *const tags[] = {"HUB", "VACCINATIECENTRUM", "VACCIN", "CENTRA", "levering", "interval", "transport",
+                                "naam", "adres", "inwoners", "capaciteit", "type", "hernieuwing", "temperatuur",
+                                "centrum", "levering", "interval", "transport"};
+    const int depths[] = {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2};
+    TagSchema schema;
+    for (unsigned int i = 0; i < sizeof(depths) / sizeof(depths[0]); i++) {
+        schema.addTag(tags[i], depths[i]);
+    }
+
+    std::string path = scenarioFile(state);
+    std::ostringstream errors;
+    for (auto _ : state) {
+        Simulation *simulation = new Simulation();
+        simulation->importXmlFile(path.c_str(), schema, errors);
+
+        state.PauseTiming();
+        delete simulation;
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_ImportXmlFileKnownTags)->Apply(scenarioSizes);
+
+static void BM_LoadSnapshot(benchmark::State &state) {
+
+    std::string path = scenarioFile(state) + ".snap";
+    if (!FileExists(path)) {
+        Simulation *simulation = buildSimulation(scenarioFile(state), kWarmUpDays);
+        simulation->saveSnapshot(path);
+        delete simulation;
+    }
+    for (auto _ : state) {
+        Simulation *simulation = new Simulation();
+        simulation->loadSnapshot(path);
+
+        state.PauseTiming();
+        delete simulation;
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_LoadSnapshot)->Apply(scenarioSizes);
+
+static void BM_DistributeVaccinsFair(benchmark::State &state) {
+
+    std::string path = scenarioFile(state);
+    std::ostringstream stream;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Simulation *simulation = buildSimulation(path, kWarmUpDays);
+        stream.str("");
+        state.ResumeTiming();
+
+        for (std::vector<Hub *>::const_iterator it = simulation->getHub().begin(); it != simulation->getHub().end(); it++) {
+            const std::map<std::string, VaccinInHub *> &vaccins = (*it)->getVaccins();
+            for (std::map<std::string, VaccinInHub *>::const_iterator ite = vaccins.begin(); ite != vaccins.end(); ite++) {
+                (*it)->distributeVaccinsFair(ite->second, simulation->getIter(), stream);
+            }
+        }
+
+        state.PauseTiming();
+        delete simulation;
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_DistributeVaccinsFair)->Apply(scenarioSizes)->Iterations(20);
+
+static void BM_DistributeRequiredVaccins(benchmark::State &state) {
+
+    std::string path = scenarioFile(state);
+    std::ostringstream stream;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Simulation *simulation = buildSimulation(path, kWarmUpDays);
+        stream.str("");
+        state.ResumeTiming();
+
+        for (std::vector<Hub *>::const_iterator it = simulation->getHub().begin(); it != simulation->getHub().end(); it++) {
+            const std::map<std::string, VaccinationCenter *> &centra = (*it)->getCentra();
+            for (std::map<std::string, VaccinationCenter *>::const_iterator ite = centra.begin(); ite != centra.end(); ite++) {
+                (*it)->distributeRequiredVaccins(ite->second, stream);
+            }
+        }
+
+        state.PauseTiming();
+        delete simulation;
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_DistributeRequiredVaccins)->Apply(scenarioSizes)->Iterations(20);
+
+static void BM_VaccinateCenter(benchmark::State &state) {
+
+    std::string path = scenarioFile(state);
+    std::ostringstream stream;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Simulation *simulation = buildSimulation(path, kWarmUpDays);
+        simulation->simulateTransport(simulation->getIter(), stream);
+        stream.str("");
+        state.ResumeTiming();
+
+        const std::map<std::string, VaccinationCenter *> &centra = simulation->getFcentra();
+        for (std::map<std::string, VaccinationCenter *>::const_iterator it = centra.begin(); it != centra.end(); it++) {
+            it->second->vaccinateCenter(stream);
+        }
+
+        state.PauseTiming();
+        delete simulation;
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_VaccinateCenter)->Apply(scenarioSizes)->Iterations(20);
+
+static void BM_Simulate(benchmark::State &state) {
+
+    std::string path = scenarioFile(state);
+    Simulation *simulation = buildSimulation(path, kWarmUpDays);
+    for (auto _ : state) {
+        // The day is recorded for undo, undoing it gives the same day for the next iteration
+        simulation->simulate();
+
+        state.PauseTiming();
+        simulation->undoSimulation();
+        state.ResumeTiming();
+    }
+    delete simulation;
+}
+BENCHMARK(BM_Simulate)->Apply(scenarioSizes);
+
+static void BM_Render(benchmark::State &state) {
+
+    std::string path = scenarioFile(state);
+    Simulation *simulation = buildSimulation(path, kWarmUpDays);
+    for (auto _ : state) {
+        Image image = simulation->render();
+        benchmark::DoNotOptimize(image.getPixels());
+    }
+    delete simulation;
+}
+BENCHMARK(BM_Render)->Apply(scenarioSizes);
+
+static void BM_AutomaticSimulation(benchmark::State &state) {
+
+    std::string path = scenarioFile(state);
+    std::ostringstream stream;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Simulation *simulation = new Simulation();
+        simulation->setThreads(1);
+        simulation->importXmlFile(path.c_str());
+        stream.str("");
+        state.ResumeTiming();
+
+        simulation->automaticSimulation(kSimulationDays, stream, false, false);
+
+        state.PauseTiming();
+        delete simulation;
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_AutomaticSimulation)->Apply(scenarioSizes)->Iterations(10);
+
+static void BM_AutomaticSimulationNullSink(benchmark::State &state) {
+
+    std::string path = scenarioFile(state);
+    NullSink sink;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Simulation *simulation = new Simulation();
+        simulation->setThreads(1);
+        simulation->importXmlFile(path.c_str());
+        state.ResumeTiming();
+
+        // The same days as BM_AutomaticSimulation, without formatting any text
+        simulation->automaticSimulation(kSimulationDays, sink, false, false);
+
+        state.PauseTiming();
+        delete simulation;
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_AutomaticSimulationNullSink)->Apply(scenarioSizes)->Iterations(10);
+
+/**
+ * \brief Remove the files in a directory and the directory itself
+ *
+ * @param path Path of the directory
+ */
+static void removeDirectory(const char *path) {
+
+    DIR *directory = opendir(path);
+    if (directory != NULL) {
+        for (struct dirent *entry = readdir(directory); entry != NULL; entry = readdir(directory)) {
+            std::string name = entry->d_name;
+            if (name != "." && name != "..") {
+                std::remove((std::string(path) + "/" + name).c_str());
+            }
+        }
+        closedir(directory);
+    }
+    rmdir(path);
+}
+
+int main(int argc, char **argv) {
+
+    // The generated simulations and the Day-<n>.ini files of simulate() are written to a temporary directory
+    char directory[] = "/tmp/VaccinDistributor_bench_XXXXXX";
+    if (mkdtemp(directory) == NULL || chdir(directory) != 0) {
+        std::cerr << "Could not create a temporary directory" << std::endl;
+        return 1;
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    removeDirectory(directory);
+    return 0;
+}
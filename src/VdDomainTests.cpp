@@ -9,6 +9,10 @@
 #include <string>
 #include "gtest/gtest.h"
 #include "Simulation.h"
+#include "CenterHeap.h"
+#include "LoadAllocator.h"
+#include "CenterTable.h"
+#include "Arena.h"
 
 class VaccinDistributorDomainTests : public::testing::Test {
 
@@ -752,3 +756,315 @@ TEST_F(VaccinDistributorDomainTests, Create) {
     EXPECT_TRUE(h->containsVaccin(vaccin2));
     EXPECT_TRUE(h->getVaccins().size() == 3);
 }
+
+// Test order of the CenterHeap used to distribute vaccins fair
+TEST_F(VaccinDistributorDomainTests, CenterHeap) {
+
+    VaccinationCenter *center = new VaccinationCenter("a", "a", 1000, 100);
+    VaccinationCenter *center1 = new VaccinationCenter("b", "b", 1000, 100);
+    VaccinationCenter *center2 = new VaccinationCenter("c", "c", 1000, 100);
+    CenterHeap heap;
+
+    EXPECT_TRUE(heap.properlyInitialized());
+    EXPECT_TRUE(heap.empty());
+    EXPECT_DEATH(heap.top(), "CenterHeap can not be empty");
+
+    heap.push(0, center, 0.5);
+    heap.push(1, center1, 0.25);
+    heap.push(2, center2, 0.25);
+    EXPECT_DEATH(heap.push(1, center1, 0.25), "VaccinationCenter is already in the heap");
+
+    // Equal ratio, the last center in order is on top
+    EXPECT_EQ(center2, heap.top());
+    EXPECT_EQ(2, heap.topOrder());
+
+    heap.update(2, 0.75);
+    EXPECT_EQ(center1, heap.top());
+    heap.update(0, 0.25);
+    EXPECT_EQ(center1, heap.top());
+    heap.remove(1);
+    EXPECT_FALSE(heap.contains(1));
+    EXPECT_EQ(center, heap.top());
+    heap.remove(0);
+    EXPECT_EQ(center2, heap.top());
+    heap.remove(2);
+    EXPECT_TRUE(heap.empty());
+
+    delete center;
+    delete center1;
+    delete center2;
+}
+
+// Test the loads given by both modes of the LoadAllocator used to distribute vaccins fair
+TEST_F(VaccinDistributorDomainTests, LoadAllocator) {
+
+    LoadAllocator::Candidate first = {NULL, 0, 100, 5, false};
+    LoadAllocator::Candidate second = {NULL, 0, 200, 2, false};
+    LoadAllocator::Candidate full = {NULL, 50, 100, 3, true};
+    LoadAllocator::Candidate empty = {NULL, 0, 100, 0, false};
+    LoadAllocator allocators[2];
+    LoadAllocator::Mode modes[2] = {LoadAllocator::kWaterFilling, LoadAllocator::kSequential};
+
+    for (int i = 0; i < 2; i++) {
+        LoadAllocator &allocator = allocators[i];
+        EXPECT_TRUE(allocator.properlyInitialized());
+        allocator.add(first);
+        allocator.add(second);
+        allocator.add(full);
+        EXPECT_DEATH(allocator.add(empty), "Candidate must be able to store a load");
+        EXPECT_EQ(3u, allocator.getCandidates().size());
+
+        // Equal ratios, the last candidate gets the first load
+        allocator.allocate(4, 10, modes[i]);
+        EXPECT_EQ(2, allocator.getLoads()[0]);
+        EXPECT_EQ(2, allocator.getLoads()[1]);
+        EXPECT_EQ(0, allocator.getLoads()[2]);
+        EXPECT_EQ(-1, allocator.getStopped());
+        allocator.allocate(3, 10, modes[i]);
+        EXPECT_EQ(1, allocator.getLoads()[0]);
+        EXPECT_EQ(2, allocator.getLoads()[1]);
+
+        // The full candidate stops the distribution when it would get the next load
+        allocator.allocate(20, 10, modes[i]);
+        EXPECT_EQ(5, allocator.getLoads()[0]);
+        EXPECT_EQ(2, allocator.getLoads()[1]);
+        EXPECT_EQ(0, allocator.getLoads()[2]);
+        EXPECT_EQ(2, allocator.getStopped());
+
+        allocator.allocate(0, 10, modes[i]);
+        EXPECT_EQ(0, allocator.getLoads()[0]);
+        EXPECT_EQ(-1, allocator.getStopped());
+        EXPECT_DEATH(allocator.allocate(1, 0, modes[i]), "Transport must be positive");
+    }
+}
+
+// Test renewal tracker of a VaccinInCenter
+TEST_F(VaccinDistributorDomainTests, RenewalTracker) {
+
+    VaccinInCenter *vaccin = new VaccinInCenter("Pfizer", -70, 3, 0);
+
+    EXPECT_TRUE(vaccin->isTrackerEmpty());
+    EXPECT_FALSE(vaccin->hasRequiredDay());
+    EXPECT_EQ(0, vaccin->getRequiredDay());
+    EXPECT_DEATH(vaccin->insertRequiredDay(-4, 10), "Day left of renewal must be between -renewal and 0");
+
+    vaccin->insertRequiredDay(-3, 10);
+    EXPECT_FALSE(vaccin->isTrackerEmpty());
+    EXPECT_EQ(10, vaccin->getTracker()[-3]);
+    EXPECT_EQ(10, vaccin->totalFirstVaccination());
+
+    vaccin->addDay();
+    vaccin->insertRequiredDay(-3, 5);
+    EXPECT_TRUE(vaccin->hasRequiredDay());
+    EXPECT_EQ(0, vaccin->getRequiredDay());
+    EXPECT_EQ(3u, vaccin->getTracker().size());
+    EXPECT_EQ(10, vaccin->getTracker()[-2]);
+    EXPECT_EQ(5, vaccin->getTracker()[-3]);
+    EXPECT_EQ(15, vaccin->totalFirstVaccination());
+
+    vaccin->addDay();
+    vaccin->addDay();
+    EXPECT_EQ(10, vaccin->getRequiredDay());
+    vaccin->removeRequiredDay(4);
+    EXPECT_EQ(6, vaccin->getRequiredDay());
+    EXPECT_EQ(11, vaccin->totalFirstVaccination());
+
+    vaccin->addDay();
+    EXPECT_EQ(11, vaccin->getRequiredDay());
+    EXPECT_EQ(1u, vaccin->getTracker().size());
+    EXPECT_EQ(11, vaccin->totalFirstVaccination());
+
+    delete vaccin;
+}
+
+// Test values of VaccinationCenters moved to a CenterTable
+TEST_F(VaccinDistributorDomainTests, CenterTable) {
+
+    CenterTable table;
+    VaccinationCenter *center = new VaccinationCenter("a", "a", 1000, 100);
+    VaccinInHub *vaccin = new VaccinInHub("Pfizer", 100, 1, 20, 3, -70);
+    VaccinInHub *vaccin1 = new VaccinInHub("Moderna", 100, 1, 20, 0, 0);
+
+    EXPECT_TRUE(table.properlyInitialized());
+    EXPECT_EQ(0, table.getCenters());
+    EXPECT_EQ(0, table.getTypes());
+
+    // Names are interned
+    EXPECT_EQ(0, table.addType("Pfizer"));
+    EXPECT_EQ(0, table.addCenter("b"));
+    EXPECT_EQ(0, table.addCenter("b"));
+    EXPECT_EQ(-1, table.findCenter("a"));
+    table.setStock(0, 0, 5);
+
+    // A center that isn't bound keeps its values without a table
+    EXPECT_TRUE(center->getTable() == NULL);
+    EXPECT_EQ(-1, center->getIndex());
+    center->addVaccins(30, vaccin);
+    center->getVaccin(true).begin()->second->insertRequiredDay(-3, 10);
+    EXPECT_TRUE(center->getVaccin(true).begin()->second->getTable() == NULL);
+    EXPECT_EQ(30, center->getVaccins());
+    EXPECT_EQ(10, center->totalWaitingForSeccondPrik());
+    EXPECT_EQ(1000, center->getPopulation());
+
+    center->bind(&table);
+    EXPECT_EQ(&table, center->getTable());
+    EXPECT_EQ(1, center->getIndex());
+    EXPECT_EQ(1000, table.getPopulation(1));
+    EXPECT_EQ(100, table.getCapacity(1));
+    EXPECT_EQ(30, table.getStock(1, 0));
+    EXPECT_EQ(10, table.getBacklog(1, 0));
+
+    // A new type keeps the values of the other types
+    center->addVaccins(40, vaccin1);
+    EXPECT_EQ(2, table.getTypes());
+    EXPECT_EQ(5, table.getStock(0, 0));
+    EXPECT_EQ(30, table.getStock(1, 0));
+    EXPECT_EQ(40, table.getStock(1, table.findType("Moderna")));
+    EXPECT_EQ(70, center->getVaccins());
+    EXPECT_EQ(10, center->totalWaitingForSeccondPrik());
+
+    std::ofstream ostream;
+    center->vaccinateCenter(ostream);
+    EXPECT_EQ(center->getVaccinated(), table.getVaccinated(1));
+    EXPECT_EQ(center->getVaccinated(), table.getTotalVaccinated());
+    EXPECT_EQ(1000, table.getTotalPopulation());
+    EXPECT_TRUE(table.checkCenter(1));
+    EXPECT_TRUE(table.checkTotals());
+
+    delete center;
+    EXPECT_EQ(0, table.getCenterStock(1));
+    EXPECT_EQ(0, table.getCenterBacklog(1));
+    EXPECT_EQ(5, table.getCenterStock(0));
+
+    delete vaccin;
+    delete vaccin1;
+}
+
+// Test objects owned by an Arena and by the Arena of a Simulation
+TEST_F(VaccinDistributorDomainTests, Arena) {
+
+    Arena arena;
+    EXPECT_TRUE(arena.properlyInitialized());
+    EXPECT_EQ(0, arena.getHubs());
+    EXPECT_EQ(0, arena.getCentra());
+
+    VaccinationCenter *center = arena.createCenter("a", "b", 1000, 100);
+    Hub *hub = arena.createHub();
+    hub->addVaccin(new VaccinInHub("Pfizer", 100, 1, 20, 3, -70));
+    hub->addCenter("a", center);
+    EXPECT_TRUE(center->properlyInitialized());
+    EXPECT_TRUE(hub->properlyInitialized());
+    EXPECT_TRUE(arena.owns(center));
+    EXPECT_TRUE(arena.owns(hub));
+    EXPECT_EQ(1, arena.getHubs());
+    EXPECT_EQ(1, arena.getCentra());
+
+    // The storage of a destroyed object is used for the next one
+    arena.destroy(center);
+    EXPECT_FALSE(arena.owns(center));
+    VaccinationCenter *next = arena.createCenter("c", "d", 1000, 100);
+    EXPECT_EQ(center, next);
+    VaccinationCenter other("e", "f", 1000, 100);
+    EXPECT_FALSE(arena.owns(&other));
+
+    // Objects are found in every block of storage
+    std::vector<VaccinationCenter*> centra;
+    for (int i = 0; i < 200; i++) {
+        centra.push_back(arena.createCenter(ToString(i), "g", 1000, 100));
+    }
+    EXPECT_EQ(201, arena.getCentra());
+    for (std::vector<VaccinationCenter*>::reverse_iterator it = centra.rbegin(); it != centra.rend(); it++) {
+        EXPECT_TRUE(arena.owns(*it));
+        arena.destroy(*it);
+        EXPECT_FALSE(arena.owns(*it));
+    }
+    EXPECT_EQ(1, arena.getCentra());
+    EXPECT_TRUE(arena.owns(next));
+
+    arena.clear();
+    EXPECT_EQ(0, arena.getHubs());
+    EXPECT_EQ(0, arena.getCentra());
+
+    // A Simulation owns what it imports
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+    Simulation simulation;
+    simulation.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    EXPECT_EQ(2, simulation.getArena().getHubs());
+    EXPECT_EQ(4, simulation.getArena().getCentra());
+    EXPECT_TRUE(simulation.getArena().owns(simulation.getHub().front()));
+    EXPECT_TRUE(simulation.getArena().owns(simulation.getFcentra().begin()->second));
+
+    // Importing again replaces the objects
+    simulation.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    EXPECT_EQ(2, simulation.getArena().getHubs());
+    EXPECT_EQ(4, simulation.getArena().getCentra());
+
+    // The recorded days of the released objects are cleared with them
+    for (int i = 0; i < 3; i++) {
+        simulation.simulate();
+    }
+    EXPECT_EQ(3u, simulation.getUndoStack().size());
+    simulation.clearSimulation();
+    EXPECT_EQ(0, simulation.getArena().getHubs());
+    EXPECT_EQ(0, simulation.getArena().getCentra());
+    EXPECT_TRUE(simulation.getUndoStack().empty());
+}
+
+// Test totals of a Hub kept up to date by its Vaccins
+TEST_F(VaccinDistributorDomainTests, HubTotals) {
+
+    Hub *hub = new Hub();
+    VaccinInHub *vaccin = new VaccinInHub("Pfizer", 100, 2, 20, 3, -70);
+    VaccinInHub *vaccin1 = new VaccinInHub("Moderna", 50, 1, 10, 0, 0);
+
+    EXPECT_EQ(0, hub->getAmountVaccin());
+    hub->addVaccin(vaccin);
+    hub->addVaccin(vaccin1);
+    EXPECT_EQ(150, hub->getAmountVaccin());
+    EXPECT_EQ(150, hub->getDelivery());
+
+    vaccin->updateVaccinsTransport(40);
+    vaccin1->updateVaccins();
+    vaccin1->setDelivery(70);
+    EXPECT_EQ(160, hub->getAmountVaccin());
+    EXPECT_EQ(170, hub->getDelivery());
+    EXPECT_TRUE(hub->checkTotals());
+
+    delete hub;
+}
+
+// Test the lists of Vaccin types under and above zero of a VaccinationCenter
+TEST_F(VaccinDistributorDomainTests, VaccinTypeLists) {
+
+    VaccinationCenter *center = new VaccinationCenter("Park Spoor Oost", "Noordersingel 40, Antwerpen", 1000, 500);
+    VaccinInHub *vaccin = new VaccinInHub("Pfizer", 100, 2, 20, 3, -70);
+    VaccinInHub *vaccin1 = new VaccinInHub("Moderna", 100, 2, 20, 3, -20);
+    VaccinInHub *vaccin2 = new VaccinInHub("Atrazenica", 100, 2, 20, 0, 5);
+    VaccinInHub *vaccin3 = new VaccinInHub("Janssen", 100, 2, 20, 0, 0);
+
+    center->addVaccins(20, vaccin);
+    center->addVaccins(20, vaccin1);
+    center->addVaccins(20, vaccin2);
+    center->addVaccins(20, vaccin3);
+
+    EXPECT_EQ(4, (int) center->vaccinsType().size());
+    ASSERT_EQ(2, (int) center->getVaccinTypes(true).size());
+    EXPECT_EQ("Moderna", center->getVaccinTypes(true)[0]->getType());
+    EXPECT_EQ("Pfizer", center->getVaccinTypes(true)[1]->getType());
+    ASSERT_EQ(1, (int) center->getVaccinTypes(false).size());
+    EXPECT_EQ("Atrazenica", center->getVaccinTypes(false)[0]->getType());
+    EXPECT_EQ(2, (int) center->getVaccin(true).size());
+
+    VaccinationCenter *copy = new VaccinationCenter();
+    copy->copyVaccinationCenter(center);
+    EXPECT_EQ(2, (int) copy->getVaccinTypes(true).size());
+    EXPECT_EQ(1, (int) copy->getVaccinTypes(false).size());
+    EXPECT_EQ(60, copy->getVaccins());
+
+    delete copy;
+    delete center;
+    delete vaccin;
+    delete vaccin1;
+    delete vaccin2;
+    delete vaccin3;
+}
@@ -7,7 +7,10 @@
 
 #include "gtest/gtest.h"
 #include <fstream>
+#include <algorithm>
 #include "Simulation.h"
+#include "Sweep.h"
+#include "ScenarioGenerator.h"
 
 class VaccinSimulationTests : public::testing::Test {
 
@@ -579,4 +582,664 @@ TEST_F(VaccinSimulationTests, SadDays) {
     errCompare.append("Centra De Zoerla does not exist\nVaccin not added: Can't convert string to int\n");
     EXPECT_EQ(errCompare, err);
     EXPECT_TRUE(s.checkSimulation());
-}
\ No newline at end of file
+}
+// Undo simulated days and compare with the state before these days
+TEST_F(VaccinSimulationTests, UndoSimulation) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    std::string fileName = "tests/outputTests/generatedOutput/generatedUndoSimulation.txt";
+    std::string fileNameCompare = "tests/outputTests/generatedOutput/generatedUndoSimulation_.txt";
+
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    EXPECT_FALSE(s.undoSimulation());
+
+    for (int i = 0; i < 10; i++) {
+        s.simulate();
+    }
+    s.exportFile(fileNameCompare);
+    std::map<const std::string, int> vaccinData = s.getVaccinData();
+    std::map<int, int> dayVaccinated = s.getDayVaccinated();
+
+    for (int i = 0; i < 5; i++) {
+        s.simulate();
+    }
+    unsigned long int x = 15;
+    EXPECT_EQ(x, s.getUndoStack().size());
+    for (int i = 0; i < 5; i++) {
+        EXPECT_TRUE(s.undoSimulation());
+    }
+    EXPECT_EQ(10, s.getIter());
+    EXPECT_TRUE(s.checkSimulation());
+    EXPECT_TRUE(vaccinData == s.getVaccinData());
+    EXPECT_TRUE(dayVaccinated == s.getDayVaccinated());
+    s.exportFile(fileName);
+    EXPECT_TRUE(FileCompare(fileName, fileNameCompare));
+
+    while (s.undoSimulation()) {}
+    EXPECT_EQ(0, s.getIter());
+    EXPECT_TRUE(s.getUndoStack().empty());
+    EXPECT_TRUE(s.getDayVaccinated().empty());
+    EXPECT_TRUE(s.checkVaccins());
+}
+
+// Vaccinating the centra on several threads gives the same output as on one thread
+TEST_F(VaccinSimulationTests, ThreadedSimulation) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysOverKillHubs.xml"));
+
+    Simulation threaded;
+    s.setThreads(1);
+    threaded.setThreads(4);
+    EXPECT_EQ(1, s.getThreads());
+    EXPECT_EQ(4, threaded.getThreads());
+    EXPECT_DEATH(s.setThreads(0), "Amount of threads must be positive");
+
+    s.importXmlFile("tests/inputTests/happyDaysOverKillHubs.xml");
+    threaded.importXmlFile("tests/inputTests/happyDaysOverKillHubs.xml");
+
+    std::string fileName = "tests/outputTests/generatedOutput/generatedThreadedSimulation.txt";
+    std::string fileNameCompare = "tests/outputTests/generatedOutput/generatedThreadedSimulation_.txt";
+    std::ostringstream stream;
+    s.automaticSimulation(60, stream, false, false);
+    threaded.automaticSimulation(60, stream, false, false);
+
+    s.exportFile(fileNameCompare);
+    threaded.exportFile(fileName);
+    EXPECT_TRUE(FileCompare(fileName, fileNameCompare));
+    EXPECT_TRUE(s.getDayVaccinated() == threaded.getDayVaccinated());
+    EXPECT_TRUE(s.getVaccinData() == threaded.getVaccinData());
+}
+
+// Days without stock in the Hubs and centra have no transports and no vaccinations
+TEST_F(VaccinSimulationTests, IdleSimulation) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    EXPECT_TRUE(s.isActive());
+
+    // Without deliveries the loads run out and every next day only records the stock
+    for (std::vector<Hub*>::const_iterator it = s.getHub().begin(); it != s.getHub().end(); it++) {
+        for (std::map<std::string, VaccinInHub*>::const_iterator ite = (*it)->getVaccins().begin();
+             ite != (*it)->getVaccins().end(); ite++) {
+            ite->second->setInterval(1000);
+        }
+    }
+    for (int day = 0; day < 100; day++) {
+        s.simulate(false);
+    }
+    EXPECT_FALSE(s.isActive());
+
+    std::string idle = s.simulate(false).second;
+    EXPECT_EQ(std::string::npos, idle.find("getransporteerd"));
+    EXPECT_EQ(std::string::npos, idle.find("gevaccineerd in"));
+    EXPECT_FALSE(idle.empty());
+    EXPECT_EQ(s.getDayVaccinated().find(99)->second, s.getDayVaccinated().find(100)->second);
+}
+
+// Hubs that share no centra are simulated at the same time and give the same output as on one thread
+TEST_F(VaccinSimulationTests, ComponentSimulation) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    // Both hubs supply Park Spoor Oost
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    ASSERT_EQ(1u, s.getComponents().size());
+    EXPECT_EQ(2u, s.getComponents()[0].size());
+
+    // Every center is supplied by one hub, so every hub is a component
+    ScenarioGenerator generator(11);
+    generator.setSize(6, 60);
+    generator.setVaccinTypes(3, 2, 40, 20);
+    std::string path = "tests/inputTests/generatedComponents.xml";
+    generator.generateFile(path);
+
+    Simulation threaded;
+    Simulation single;
+    threaded.setThreads(4);
+    single.setThreads(1);
+    threaded.importXmlFile(path.c_str());
+    single.importXmlFile(path.c_str());
+    ASSERT_EQ(6u, threaded.getComponents().size());
+    for (unsigned int i = 0; i < threaded.getComponents().size(); i++) {
+        ASSERT_EQ(1u, threaded.getComponents()[i].size());
+        EXPECT_EQ(static_cast<int>(i), threaded.getComponents()[i][0]);
+    }
+
+    std::ostringstream threadedStream;
+    std::ostringstream singleStream;
+    threaded.automaticSimulation(40, threadedStream, false, false);
+    single.automaticSimulation(40, singleStream, false, false);
+    EXPECT_EQ(singleStream.str(), threadedStream.str());
+    EXPECT_TRUE(single.getDayVaccinated() == threaded.getDayVaccinated());
+    EXPECT_TRUE(single.getVaccinData() == threaded.getVaccinData());
+
+    // Hubs next to each other supply the same centra, so all hubs are one component
+    generator.setFanOut(2);
+    generator.generateFile(path);
+    Simulation chained;
+    chained.importXmlFile(path.c_str());
+    ASSERT_EQ(1u, chained.getComponents().size());
+    EXPECT_EQ(6u, chained.getComponents()[0].size());
+}
+
+// The connections are indexed by hub and by center when the simulation is imported
+TEST_F(VaccinSimulationTests, Topology) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    EXPECT_EQ(0, s.getTopology().getHubs());
+    EXPECT_EQ(0, s.getTopology().getCentra());
+
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    const Topology &topology = s.getTopology();
+    ASSERT_EQ(2, topology.getHubs());
+    ASSERT_EQ(4, topology.getCentra());
+    EXPECT_TRUE(topology.isConnected());
+    EXPECT_TRUE(s.checkConnections());
+
+    // Centra are indexed in the order of their names
+    EXPECT_EQ("AED Studios", topology.getCenter(0)->getName());
+    EXPECT_EQ("Park Spoor Oost", topology.getCenter(3)->getName());
+    EXPECT_EQ(s.getFcentra().find("De Zoerla")->second, topology.getCenter(1));
+
+    // The first hub only supplies Park Spoor Oost, the second hub supplies every center
+    ASSERT_EQ(1, topology.endCentra(0) - topology.beginCentra(0));
+    EXPECT_EQ(3, topology.getEdgeCenter(topology.beginCentra(0)));
+    ASSERT_EQ(4, topology.endCentra(1) - topology.beginCentra(1));
+    for (int edge = topology.beginCentra(1); edge < topology.endCentra(1); edge++) {
+        EXPECT_EQ(edge - topology.beginCentra(1), topology.getEdgeCenter(edge));
+    }
+
+    // Park Spoor Oost is supplied by both hubs, the other centra by the second hub
+    ASSERT_EQ(2, topology.endHubs(3) - topology.beginHubs(3));
+    EXPECT_EQ(0, topology.getEdgeHub(topology.beginHubs(3)));
+    EXPECT_EQ(1, topology.getEdgeHub(topology.beginHubs(3) + 1));
+    ASSERT_EQ(1, topology.endHubs(0) - topology.beginHubs(0));
+    EXPECT_EQ(1, topology.getEdgeHub(topology.beginHubs(0)));
+
+    // A center without a hub isn't connected
+    std::map<std::string, VaccinationCenter*> centra = s.getFcentra();
+    VaccinationCenter extra("Extra", "Straat 1", 1000, 100);
+    centra["Extra"] = &extra;
+    EXPECT_FALSE(Topology(centra, s.getHub()).isConnected());
+
+    s.clearSimulation();
+    EXPECT_EQ(0, s.getTopology().getHubs());
+}
+
+// The vaccins of the hubs and centra are found on the column of their type in the table of the centra
+TEST_F(VaccinSimulationTests, TypeIndices) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    const CenterTable *table = s.getFcentra().begin()->second->getTable();
+    ASSERT_TRUE(table != NULL);
+    EXPECT_EQ(3, table->getTypes());
+    for (std::vector<Hub*>::const_iterator it = s.getHub().begin(); it != s.getHub().end(); it++) {
+        const std::map<std::string, VaccinInHub*> &vaccins = (*it)->getVaccins();
+        for (std::map<std::string, VaccinInHub*>::const_iterator ite = vaccins.begin(); ite != vaccins.end(); ite++) {
+            EXPECT_EQ(table->findType(ite->first), ite->second->getTypeIndex(table));
+            EXPECT_EQ(-1, ite->second->getTypeIndex(NULL));
+        }
+    }
+
+    // The centra get their types with the first transport, on the same columns
+    std::ostringstream stream;
+    s.automaticSimulation(5, stream, false, false);
+    for (std::map<std::string, VaccinationCenter*>::const_iterator it = s.getFcentra().begin();
+         it != s.getFcentra().end(); it++) {
+        const std::map<const std::string, VaccinInCenter*> &types = it->second->vaccinsType();
+        EXPECT_FALSE(types.empty());
+        for (std::map<const std::string, VaccinInCenter*>::const_iterator ite = types.begin(); ite != types.end(); ite++) {
+            EXPECT_EQ(table, ite->second->getTable());
+            EXPECT_EQ(table->findType(ite->first), ite->second->getTypeIndex());
+        }
+    }
+
+    // A vaccin outside the simulation has no column
+    VaccinInHub vaccin("Pfizer", 1000, 7, 100, 0, -70);
+    EXPECT_EQ(-1, vaccin.getTypeIndex(table));
+}
+
+// Giving the loads of the hubs one at a time gives the same output as giving them all at once
+TEST_F(VaccinSimulationTests, SequentialAllocation) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysOverKillHubs.xml"));
+
+    Simulation sequential;
+    sequential.setAllocation(LoadAllocator::kSequential);
+    EXPECT_EQ(LoadAllocator::kWaterFilling, s.getAllocation());
+    EXPECT_EQ(LoadAllocator::kSequential, sequential.getAllocation());
+
+    s.importXmlFile("tests/inputTests/happyDaysOverKillHubs.xml");
+    sequential.importXmlFile("tests/inputTests/happyDaysOverKillHubs.xml");
+    EXPECT_EQ(LoadAllocator::kSequential, sequential.getHub().front()->getAllocation());
+
+    std::ostringstream stream;
+    std::ostringstream sequentialStream;
+    s.automaticSimulation(60, stream, false, false);
+    sequential.automaticSimulation(60, sequentialStream, false, false);
+    EXPECT_EQ(stream.str(), sequentialStream.str());
+    EXPECT_TRUE(s.getDayVaccinated() == sequential.getDayVaccinated());
+    EXPECT_TRUE(s.getVaccinData() == sequential.getVaccinData());
+}
+
+// Continuing a simulation from a snapshot gives the same days as simulating without interruption
+TEST_F(VaccinSimulationTests, SnapshotSimulation) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    std::string snapshot = "tests/outputTests/generatedOutput/generatedSnapshot.snap";
+    std::string fileName = "tests/outputTests/generatedOutput/generatedSnapshotSimulation.txt";
+    std::string fileNameCompare = "tests/outputTests/generatedOutput/generatedSnapshotSimulation_.txt";
+
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    std::ostringstream stream;
+    s.automaticSimulation(12, stream, false, false);
+    s.saveSnapshot(snapshot);
+    EXPECT_TRUE(Snapshot::isSnapshot(snapshot));
+    EXPECT_FALSE(Snapshot::isSnapshot("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    Simulation loaded;
+    loaded.loadSnapshot(snapshot);
+    EXPECT_EQ(12, loaded.getIter());
+    EXPECT_TRUE(loaded.checkSimulation());
+    EXPECT_TRUE(loaded.getUndoStack().empty());
+    EXPECT_FALSE(loaded.undoSimulation());
+    EXPECT_TRUE(s.getDayVaccinated() == loaded.getDayVaccinated());
+    EXPECT_TRUE(s.getVaccinData() == loaded.getVaccinData());
+    EXPECT_DEATH(loaded.loadSnapshot(snapshot), "Simulation must be empty");
+
+    // Only a loaded simulation is continued, a simulation that already ran can't start again
+    Simulation uninterrupted;
+    uninterrupted.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    std::ostringstream continued;
+    std::ostringstream resumed;
+    uninterrupted.automaticSimulation(30, continued, false, false);
+    loaded.automaticSimulation(30, resumed, false, false);
+    EXPECT_EQ(continued.str().substr(stream.str().size()), resumed.str());
+    EXPECT_DEATH(s.automaticSimulation(30, continued, false, false),
+                 "Amount of vaccins or amount of vaccinated in a center must be 0 at begin of simulation");
+    uninterrupted.exportFile(fileNameCompare);
+    loaded.exportFile(fileName);
+    EXPECT_TRUE(FileCompare(fileName, fileNameCompare));
+    EXPECT_TRUE(uninterrupted.getDayVaccinated() == loaded.getDayVaccinated());
+
+    // Days simulated after loading can be undone, the days before can't
+    Simulation undo;
+    undo.loadSnapshot(snapshot);
+    for (int i = 0; i < 3; i++) {
+        undo.simulate();
+    }
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(undo.undoSimulation());
+    }
+    EXPECT_FALSE(undo.undoSimulation());
+    EXPECT_EQ(12, undo.getIter());
+    Simulation fresh;
+    fresh.loadSnapshot(snapshot);
+    EXPECT_TRUE(undo.getVaccinData() == fresh.getVaccinData());
+    EXPECT_TRUE(undo.getDayVaccinated() == fresh.getDayVaccinated());
+
+    // A file that is not a valid snapshot leaves the Simulation empty
+    Simulation invalid;
+    EXPECT_THROW(invalid.loadSnapshot("tests/inputTests/happyDaysMultipleHubs.xml"), Exception);
+    std::ofstream truncated(fileName.c_str(), std::ios::binary);
+    std::ifstream original(snapshot.c_str(), std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(original)), std::istreambuf_iterator<char>());
+    truncated << bytes.substr(0, bytes.size() - 1);
+    truncated.close();
+    EXPECT_THROW(invalid.loadSnapshot(fileName), Exception);
+    EXPECT_TRUE(invalid.getFcentra().empty());
+    EXPECT_TRUE(invalid.getHub().empty());
+}
+
+// Test drawing the Simulation in memory
+TEST_F(VaccinSimulationTests, RenderSimulation) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+
+    unsigned int lines = 0;
+    for (std::vector<Hub *>::const_iterator it = s.getHub().begin(); it != s.getHub().end(); it++) {
+        lines += (*it)->getCentra().size();
+    }
+    Scene scene = s.generateScene();
+    EXPECT_EQ(s.getHub().size() * 2 + s.getFcentra().size(), scene.getFigures().size());
+    EXPECT_EQ(lines, scene.getLines().size());
+
+    // The largest side has the size of the Scene, the centra are red before anyone is vaccinated
+    Image image = s.render();
+    EXPECT_EQ(1024, std::max(image.getWidth(), image.getHeight()));
+    EXPECT_EQ(43, image.getPixel(0, 0, 0));
+    bool red = false;
+    for (int y = 0; y < image.getHeight() && !red; y++) {
+        for (int x = 0; x < image.getWidth() && !red; x++) {
+            red = image.getPixel(x, y, 0) == 255 && image.getPixel(x, y, 1) == 0 && image.getPixel(x, y, 2) == 0;
+        }
+    }
+    EXPECT_TRUE(red);
+
+    // Undoing a day gives the same image
+    s.simulate(false);
+    s.undoSimulation();
+    Image undone = s.render();
+    ASSERT_EQ(image.getWidth(), undone.getWidth());
+    ASSERT_EQ(image.getHeight(), undone.getHeight());
+    EXPECT_TRUE(std::equal(image.getPixels(), image.getPixels() + image.getWidth() * image.getHeight() * 3,
+                           undone.getPixels()));
+
+    std::string path = "tests/outputTests/generatedOutput/generatedRender.bmp";
+    s.generateBmp(path);
+    std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+    file.seekg(0, std::ios::end);
+    EXPECT_EQ(54 + ((image.getWidth() * 3 + 3) / 4 * 4) * image.getHeight(), file.tellg());
+    file.close();
+    std::remove(path.c_str());
+}
+
+// Test writing the files of every day to one archive
+TEST_F(VaccinSimulationTests, ArchiveSimulation) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    std::string path = "tests/outputTests/generatedOutput/generatedDays.archive";
+    std::string fileName = "tests/outputTests/generatedOutput/generatedArchiveDay.txt";
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    Simulation compare;
+    compare.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+
+    // The text of a day is the same as the file of exportFile
+    DayArchive archive;
+    archive.open(path, true);
+    std::ostringstream stream;
+    s.automaticSimulation(5, stream, true, true, false, &archive);
+    EXPECT_EQ(5u, archive.getDays(DayArchive::kText).size());
+    EXPECT_EQ(5u, archive.getDays(DayArchive::kIni).size());
+    EXPECT_TRUE(archive.getDays(DayArchive::kBmp).empty());
+    compare.automaticSimulation(3, stream, false, false);
+    compare.exportFile(fileName);
+    std::ifstream file(fileName.c_str());
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    EXPECT_EQ(text, archive.read(2, DayArchive::kText));
+    archive.close();
+    EXPECT_FALSE(archive.isOpen());
+
+    // A closed archive is continued, a day that is archived again gives the newest file
+    archive.open(path);
+    EXPECT_EQ(5u, archive.getDays(DayArchive::kText).size());
+    EXPECT_EQ(text, archive.read(2, DayArchive::kText));
+    archive.append(2, DayArchive::kText, "day 2");
+    s.archiveDay(archive, 5, false, false, true);
+    EXPECT_EQ("day 2", archive.read(2, DayArchive::kText));
+    std::string bmp = archive.read(5, DayArchive::kBmp);
+    EXPECT_EQ("BM", bmp.substr(0, 2));
+    archive.close();
+
+    // An archive that was not closed is read from its records
+    std::ifstream original(path.c_str(), std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(original)), std::istreambuf_iterator<char>());
+    original.close();
+    std::ofstream truncated(path.c_str(), std::ios::binary);
+    truncated << bytes.substr(0, bytes.size() - 1);
+    truncated.close();
+    archive.open(path);
+    EXPECT_EQ("day 2", archive.read(2, DayArchive::kText));
+    EXPECT_EQ(bmp, archive.read(5, DayArchive::kBmp));
+    EXPECT_EQ(5u, archive.getDays(DayArchive::kIni).size());
+    archive.close();
+
+    // A footer with more entries than the archive can hold is ignored, the records are read instead
+    std::ifstream closed(path.c_str(), std::ios::binary);
+    bytes.assign((std::istreambuf_iterator<char>(closed)), std::istreambuf_iterator<char>());
+    closed.close();
+    int32_t entries = 0x7fffffff;
+    bytes.replace(bytes.size() - 8, sizeof(entries), reinterpret_cast<const char *>(&entries), sizeof(entries));
+    std::ofstream damaged(path.c_str(), std::ios::binary);
+    damaged << bytes;
+    damaged.close();
+    archive.open(path);
+    EXPECT_EQ("day 2", archive.read(2, DayArchive::kText));
+    EXPECT_EQ(5u, archive.getDays(DayArchive::kIni).size());
+    archive.close();
+
+    DayArchive invalid;
+    EXPECT_THROW(invalid.open("tests/inputTests/happyDaysMultipleHubs.xml"), Exception);
+    EXPECT_FALSE(invalid.isOpen());
+    std::remove(path.c_str());
+    std::remove(fileName.c_str());
+}
+
+/**
+Tests the events of the simulation: the text of a TextSink, a .csv file and a binary log that is replayed
+*/
+TEST_F(VaccinSimulationTests, EventSinks) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    Simulation compare;
+    compare.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+
+    // The text of a TextSink is the text written to a stream
+    std::ostringstream expected;
+    compare.automaticSimulation(5, expected, false, false);
+    std::ostringstream text;
+    std::ostringstream csv;
+    std::ostringstream log;
+    TextSink textSink(text);
+    CsvSink csvSink(csv);
+    BinarySink logSink(log);
+    EventBuffer buffer;
+    TeeSink sink;
+    sink.add(&textSink);
+    sink.add(&csvSink);
+    sink.add(&logSink);
+    sink.add(&buffer);
+    s.automaticSimulation(5, sink, false, false);
+    EXPECT_EQ(expected.str(), text.str());
+
+    // Every event is a line of the .csv file, after the names of the columns
+    std::string values = csv.str();
+    EXPECT_EQ(buffer.getEvents().size() + 1, static_cast<unsigned int>(std::count(values.begin(), values.end(), '\n')));
+    EXPECT_EQ(0u, values.find("day,event,center,vaccin,"));
+    EXPECT_EQ(4, buffer.getEvents().back().day);
+
+    // A replayed log and a replayed buffer give the same text
+    std::istringstream input(log.str());
+    std::ostringstream replayed;
+    TextSink replayedSink(replayed);
+    BinarySink::replay(input, replayedSink);
+    EXPECT_EQ(expected.str(), replayed.str());
+    std::ostringstream buffered;
+    TextSink bufferedSink(buffered);
+    buffer.replay(bufferedSink);
+    EXPECT_EQ(expected.str(), buffered.str());
+
+    // A day simulated with a NullSink changes the simulation like a day with text
+    Simulation quiet;
+    quiet.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    Simulation verbose;
+    verbose.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    NullSink nullSink;
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ("", quiet.simulate(nullSink));
+        verbose.simulate(false);
+    }
+    EXPECT_EQ(verbose.getVaccinated(), quiet.getVaccinated());
+    EXPECT_EQ(s.getVaccinated(), quiet.getVaccinated());
+
+    std::istringstream invalid("VDEVENT");
+    EXPECT_THROW(BinarySink::replay(invalid, replayedSink), Exception);
+    std::string truncatedLog = log.str();
+    std::istringstream truncated(truncatedLog.substr(0, truncatedLog.size() - 1));
+    EXPECT_THROW(BinarySink::replay(truncated, replayedSink), Exception);
+}
+
+/**
+Tests the levels of the sinks, a sink with movements records the events of a sink with stock without the stock
+*/
+TEST_F(VaccinSimulationTests, EventLevels) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    EXPECT_EQ(EventSink::kMovements, EventSink::levelOf(EventSink::Event::kTransport));
+    EXPECT_EQ(EventSink::kMovements, EventSink::levelOf(EventSink::Event::kVaccination));
+    EXPECT_EQ(EventSink::kStock, EventSink::levelOf(EventSink::Event::kCenterStock));
+    EXPECT_EQ(EventSink::kStock, EventSink::levelOf(EventSink::Event::kVaccinStock));
+
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    Simulation compare;
+    compare.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+
+    EventBuffer stock;
+    EXPECT_EQ(EventSink::kStock, stock.getLevel());
+    compare.automaticSimulation(10, stock, false, false);
+
+    // The level of a TeeSink drops the events before they reach its sinks
+    EventBuffer movements;
+    TeeSink sink;
+    sink.setLevel(EventSink::kMovements);
+    EXPECT_EQ(EventSink::kMovements, sink.getLevel());
+    sink.add(&movements);
+    s.automaticSimulation(10, sink, false, false);
+
+    std::vector<EventSink::Event> expected;
+    for (std::vector<EventSink::Event>::const_iterator it = stock.getEvents().begin(); it != stock.getEvents().end();
+         it++) {
+        if (EventSink::levelOf(it->type) == EventSink::kMovements) {
+            expected.push_back(*it);
+        }
+    }
+    EXPECT_LT(expected.size(), stock.getEvents().size());
+    ASSERT_EQ(expected.size(), movements.getEvents().size());
+    for (unsigned int i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i].type, movements.getEvents()[i].type);
+        EXPECT_EQ(expected[i].day, movements.getEvents()[i].day);
+        EXPECT_EQ(expected[i].amount, movements.getEvents()[i].amount);
+        EXPECT_EQ(expected[i].vaccinated, movements.getEvents()[i].vaccinated);
+    }
+    EXPECT_EQ(compare.getVaccinated(), s.getVaccinated());
+    EXPECT_TRUE(compare.getDayVaccinated() == s.getDayVaccinated());
+}
+
+/**
+Tests the deliveries given by the DeliverySchedule, they are the days an interval is over in the order of the Hubs
+*/
+TEST_F(VaccinSimulationTests, DeliverySchedule) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    typedef std::vector<std::pair<int, std::string> > Deliveries;
+    Deliveries expected;
+    Deliveries delivered;
+    for (int day = 0; day < 30; day++) {
+        // The interval of every Vaccin changes halfway
+        if (day == 15) {
+            for (std::vector<Hub*>::const_iterator it = s.getHub().begin(); it != s.getHub().end(); it++) {
+                for (std::map<std::string, VaccinInHub*>::const_iterator ite = (*it)->getVaccins().begin();
+                     ite != (*it)->getVaccins().end(); ite++) {
+                    ite->second->setInterval(ite->second->getInterval() + 1);
+                }
+            }
+        }
+        for (std::vector<Hub*>::const_iterator it = s.getHub().begin(); it != s.getHub().end(); it++) {
+            for (std::map<std::string, VaccinInHub*>::const_iterator ite = (*it)->getVaccins().begin();
+                 ite != (*it)->getVaccins().end(); ite++) {
+                if (day != 0 && day % ite->second->getInterval() == 0) {
+                    expected.push_back(std::make_pair(day, ite->first));
+                }
+            }
+        }
+        EventBuffer buffer;
+        s.simulate(buffer);
+        for (std::vector<EventSink::Event>::const_iterator it = buffer.getEvents().begin();
+             it != buffer.getEvents().end(); it++) {
+            if (it->type == EventSink::Event::kDelivery) {
+                delivered.push_back(std::make_pair(it->day, *it->vaccin));
+            }
+        }
+    }
+    EXPECT_FALSE(expected.empty());
+    EXPECT_TRUE(expected == delivered);
+
+    // Days simulated again after an undo get the same deliveries
+    for (int i = 0; i < 10; i++) {
+        EXPECT_TRUE(s.undoSimulation());
+    }
+    Deliveries again;
+    for (int day = 20; day < 30; day++) {
+        EventBuffer buffer;
+        s.simulate(buffer);
+        for (std::vector<EventSink::Event>::const_iterator it = buffer.getEvents().begin();
+             it != buffer.getEvents().end(); it++) {
+            if (it->type == EventSink::Event::kDelivery) {
+                again.push_back(std::make_pair(it->day, *it->vaccin));
+            }
+        }
+    }
+    Deliveries::iterator first = delivered.begin();
+    while (first != delivered.end() && first->first < 20) {
+        first++;
+    }
+    EXPECT_TRUE(Deliveries(first, delivered.end()) == again);
+}
+
+/**
+Tests the simulation of several scenarios of one imported simulation
+*/
+TEST_F(VaccinSimulationTests, SweepSimulation) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+
+    s.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+    Sweep sweep(s);
+    sweep.setThreads(2);
+    EXPECT_EQ(2, sweep.getThreads());
+
+    std::istringstream scenarios("base\n"
+                                 "# every combination of values\n"
+                                 "grid capacity:\"Park Spoor Oost\"=500,1000 delivery:AstraZeneca=1500,3000,6000\n"
+                                 "unknown capacity:Nowhere=10\n");
+    sweep.readScenarios(scenarios);
+    ASSERT_EQ(8u, sweep.getScenarios().size());
+    EXPECT_EQ("grid/capacity:Park Spoor Oost=1000/delivery:AstraZeneca=1500", sweep.getScenarios()[4].name);
+    std::istringstream invalid("fine\ninvalid interval:Pfizer=0\n");
+    EXPECT_THROW(sweep.readScenarios(invalid), Exception);
+    EXPECT_EQ(8u, sweep.getScenarios().size());
+
+    sweep.run(20);
+    const std::vector<Sweep::Result> &results = sweep.getResults();
+    ASSERT_EQ(8u, results.size());
+
+    // A scenario gives the same result as the Simulation changed by the same overrides
+    for (unsigned int i = 0; i < 7; i++) {
+        Simulation compare;
+        compare.importXmlFile("tests/inputTests/happyDaysMultipleHubs.xml");
+        const std::vector<Sweep::Override> &overrides = sweep.getScenarios()[i].overrides;
+        for (std::vector<Sweep::Override>::const_iterator it = overrides.begin(); it != overrides.end(); it++) {
+            Sweep::apply(compare, *it);
+        }
+        NullSink sink;
+        compare.automaticSimulation(20, sink, false, false);
+        EXPECT_EQ(sweep.getScenarios()[i].name, results[i].name);
+        EXPECT_TRUE(results[i].error.empty());
+        EXPECT_EQ(compare.getVaccinated(), results[i].vaccinated);
+        EXPECT_TRUE(compare.getDayVaccinated() == results[i].dayVaccinated);
+        EXPECT_TRUE(compare.getVaccinData() == results[i].vaccinData);
+    }
+    EXPECT_NE(results[1].vaccinData, results[3].vaccinData);
+    EXPECT_EQ("Unknown VaccinationCenter Nowhere", results[7].error);
+
+    // A line for every scenario after the names of the columns
+    std::ostringstream csv;
+    sweep.writeCsv(csv);
+    std::string values = csv.str();
+    EXPECT_EQ(9, std::count(values.begin(), values.end(), '\n'));
+    EXPECT_EQ(0u, values.find("scenario,error,vaccinated,delivered AstraZeneca,delivered Moderna,delivered Pfizer,day 0,"));
+}
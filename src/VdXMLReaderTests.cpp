@@ -7,7 +7,10 @@
 
 #include "gtest/gtest.h"
 #include <fstream>
+#include <sstream>
+#include <cstdio>
 #include "Simulation.h"
+#include "ScenarioGenerator.h"
 
 class XMLReaderTest : public::testing::Test {
 
@@ -31,6 +34,70 @@ protected:
 
 };
 
+/**
+ * \brief Read a file with the XMLReader and the XMLStreamReader and compare the VaccinationCenters, hubs and errors
+ *
+ * @param path Path of the file, must be supported by the XMLStreamReader
+ */
+static void compareReaders(const char *path) {
+
+    std::ostringstream errors;
+    std::ostringstream streamErrors;
+    std::map<std::string, VaccinationCenter *> centra;
+    std::map<std::string, VaccinationCenter *> streamCentra;
+    std::vector<Hub *> hubs;
+    std::vector<Hub *> streamHubs;
+
+    XMLReader r(path);
+    XMLStreamReader s(path);
+    ASSERT_TRUE(s.isSupported()) << path;
+    try {
+        centra = r.readVaccinationCenters(errors);
+        hubs = r.readHubs(centra, errors);
+    }
+    catch (Exception ex) {
+        errors << ex.value() << std::endl;
+    }
+    try {
+        streamCentra = s.readVaccinationCenters(streamErrors);
+        streamHubs = s.readHubs(streamCentra, streamErrors);
+    }
+    catch (Exception ex) {
+        streamErrors << ex.value() << std::endl;
+    }
+
+    EXPECT_EQ(errors.str(), streamErrors.str()) << path;
+    ASSERT_EQ(centra.size(), streamCentra.size()) << path;
+    for (std::map<std::string, VaccinationCenter *>::iterator it = centra.begin(); it != centra.end(); it++) {
+        VaccinationCenter *center = streamCentra[it->first];
+        ASSERT_TRUE(center != NULL) << path;
+        EXPECT_EQ(it->second->getAddress(), center->getAddress()) << path;
+        EXPECT_EQ(it->second->getPopulation(), center->getPopulation()) << path;
+        EXPECT_EQ(it->second->getCapacity(), center->getCapacity()) << path;
+    }
+    ASSERT_EQ(hubs.size(), streamHubs.size()) << path;
+    for (unsigned int i = 0; i < hubs.size(); i++) {
+        EXPECT_EQ(hubs[i]->getCentra().size(), streamHubs[i]->getCentra().size()) << path;
+        ASSERT_EQ(hubs[i]->getVaccins().size(), streamHubs[i]->getVaccins().size()) << path;
+        std::map<std::string, VaccinInHub *>::const_iterator ite = streamHubs[i]->getVaccins().begin();
+        for (std::map<std::string, VaccinInHub *>::const_iterator it = hubs[i]->getVaccins().begin();
+             it != hubs[i]->getVaccins().end(); it++, ite++) {
+            EXPECT_EQ(it->first, ite->first) << path;
+            EXPECT_EQ(it->second->getDelivery(), ite->second->getDelivery()) << path;
+            EXPECT_EQ(it->second->getInterval(), ite->second->getInterval()) << path;
+            EXPECT_EQ(it->second->getTransport(), ite->second->getTransport()) << path;
+            EXPECT_EQ(it->second->getRenewal(), ite->second->getRenewal()) << path;
+            EXPECT_EQ(it->second->getTemperature(), ite->second->getTemperature()) << path;
+        }
+        delete hubs[i];
+        delete streamHubs[i];
+    }
+    for (std::map<std::string, VaccinationCenter *>::iterator it = centra.begin(); it != centra.end(); it++) {
+        delete it->second;
+        delete streamCentra[it->first];
+    }
+}
+
 // Test with an "empty" XML file
 TEST_F(XMLReaderTest, EmptyXml) {
 
@@ -77,6 +144,54 @@ TEST_F(XMLReaderTest, NoAllowedTagTest) {
     ,errorStream.str());
 }
 
+// Test a TagSchema used for more than one file, by the XMLReader and the XMLStreamReader
+TEST_F(XMLReaderTest, TagSchemaReused) {
+
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDays1.xml"));
+    ASSERT_TRUE(FileExists("tests/inputTests/happyDaysMultipleHubs.xml"));
+    ASSERT_TRUE(FileExists("tests/inputTests/knownTagsNotComplete1.xml"));
+
+    std::ostringstream schemaErrors;
+    TagSchema schema("tests/inputTests/knownTagsNotComplete1.xml", schemaErrors);
+    EXPECT_EQ("", schemaErrors.str());
+    EXPECT_TRUE(schema.isKnown("VACCINATIECENTRUM", 0));
+    EXPECT_TRUE(schema.isKnown("adres", 1));
+    EXPECT_FALSE(schema.isKnown("adres", 0));
+    EXPECT_FALSE(schema.isKnown("naam", 1));
+
+    const char *paths[] = {"tests/inputTests/happyDays1.xml", "tests/inputTests/happyDaysMultipleHubs.xml"};
+    for (unsigned int i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+        std::ostringstream errors;
+        std::ostringstream streamErrors;
+        XMLReader r(paths[i]);
+        XMLStreamReader s(paths[i], &schema);
+        ASSERT_TRUE(s.isSupported());
+        EXPECT_FALSE(r.acceptedTags(errors, schema));
+        EXPECT_FALSE(s.acceptedTags(streamErrors));
+        EXPECT_NE("", errors.str());
+        EXPECT_EQ(errors.str(), streamErrors.str());
+    }
+
+    std::ostringstream errors;
+    Simulation simulation;
+    simulation.importXmlFile("tests/inputTests/happyDays1.xml", schema, errors);
+    EXPECT_EQ("Error unknown tag: 'naam'\nError unknown tag: 'naam'\nError unknown tag: 'naam'\nError unknown tag: 'naam'\n"
+              , errors.str());
+    EXPECT_TRUE(simulation.checkSimulation());
+
+    // A schema grows past the size it starts with
+    TagSchema grown;
+    for (int i = 0; i < 200; i++) {
+        grown.addTag("tag" + ToString(i), i % 3);
+        grown.addTag("tag" + ToString(i), i % 3);
+    }
+    EXPECT_EQ(200, grown.getTags());
+    for (int i = 0; i < 200; i++) {
+        EXPECT_TRUE(grown.isKnown("tag" + ToString(i), i % 3));
+        EXPECT_FALSE(grown.isKnown("tag" + ToString(i), i % 3 + 1));
+    }
+}
+
 // Test with wrong pad
 TEST_F(XMLReaderTest, NoFileOnPath) {
 
@@ -189,3 +304,93 @@ TEST_F(XMLReaderTest, Happyday2) {
 
     EXPECT_THROW(r.getElement("NOTEXIST"), Exception);
 }
+
+// Test reading a generated simulation
+TEST_F(XMLReaderTest, GeneratedScenario) {
+
+    ScenarioGenerator generator(7);
+    generator.setSize(3, 40);
+    generator.setVaccinTypes(4, 2, 50, 25);
+    generator.setFanOut(2);
+    generator.setPopulation(1000, 200000, true);
+
+    std::stringstream first;
+    std::stringstream second;
+    generator.generate(first);
+    generator.generate(second);
+    EXPECT_EQ(first.str(), second.str());
+
+    std::string path = "tests/inputTests/generatedScenario.xml";
+    generator.generateFile(path);
+
+    std::stringstream errors;
+    XMLReader r(path.c_str());
+    std::map<std::string, VaccinationCenter *> centra = r.readVaccinationCenters(errors);
+    std::vector<Hub *> hubs = r.readHubs(centra, errors);
+    EXPECT_EQ("", errors.str());
+    EXPECT_EQ(40, (int) centra.size());
+    ASSERT_EQ(3, (int) hubs.size());
+
+    int connections = 0;
+    for (std::vector<Hub *>::iterator it = hubs.begin(); it != hubs.end(); it++) {
+        EXPECT_EQ(2, (int) (*it)->getVaccins().size());
+        connections += (*it)->getCentra().size();
+        delete *it;
+    }
+    EXPECT_EQ(80, connections);
+    for (std::map<std::string, VaccinationCenter *>::iterator it = centra.begin(); it != centra.end(); it++) {
+        EXPECT_GE(it->second->getPopulation(), 1000);
+        EXPECT_LE(it->second->getPopulation(), 200000);
+        delete it->second;
+    }
+
+    Simulation s;
+    EXPECT_NO_THROW(s.importXmlFile(path.c_str()));
+    EXPECT_TRUE(s.checkSimulation());
+    std::remove(path.c_str());
+}
+
+// Test the XMLStreamReader against the XMLReader, also with missing, empty and wrong values
+TEST_F(XMLReaderTest, StreamReaderSameAsXMLReader) {
+
+    const char *paths[] = {"tests/inputTests/happyDays1.xml", "tests/inputTests/happyDays2.xml",
+                           "tests/inputTests/happyDaysMultipleHubs.xml", "tests/inputTests/missingElementCenter.xml",
+                           "tests/inputTests/missingMultipleElementsVaccin.xml", "tests/inputTests/emptyVaccinInformation.xml",
+                           "tests/inputTests/stringCenterInformation.xml", "tests/inputTests/nonExistingCenter.xml",
+                           "tests/inputTests/noCentraTag.xml", "tests/inputTests/noVaccinTag.xml"};
+    for (unsigned int i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+        ASSERT_TRUE(FileExists(paths[i]));
+        compareReaders(paths[i]);
+    }
+
+    // Comments, entities, white space and a declaration are read like TinyXML reads them
+    std::string path = "tests/inputTests/streamScenario.xml";
+    std::ofstream file(path.c_str());
+    file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\r\n<!-- scenario -->\n";
+    file << "<HUB><levering>100</levering><interval>2</interval><transport>10</transport>\n";
+    file << "<CENTRA><centrum>  De   Zoerla </centrum><centrum/><centrum>Nergens</centrum></CENTRA></HUB>\n";
+    file << "<HUB><!--levering--><levering>5</levering><interval>1</interval><transport>1</transport></HUB>\n";
+    file << "<VACCINATIECENTRUM><naam>De Zoerla</naam><adres>Straat &amp; Plein</adres>\n";
+    file << "<inwoners> 4000 </inwoners><capaciteit><!-- leeg -->100</capaciteit></VACCINATIECENTRUM>\n";
+    file << "<VACCINATIECENTRUM><naam>Park</naam><adres>Park</adres><inwoners>10</inwoners><capaciteit>1</capaciteit>\n";
+    file << "</VACCINATIECENTRUM>\n";
+    file.close();
+    compareReaders(path.c_str());
+    std::remove(path.c_str());
+}
+
+// Test files that the XMLStreamReader leaves to the XMLReader
+TEST_F(XMLReaderTest, StreamReaderNotSupported) {
+
+    const char *paths[] = {"tests/inputTests/wrongClosingTagXml1.xml", "tests/inputTests/wrongClosingTagXml2.xml",
+                           "tests/inputTests/wrongLayoutXml.xml", "tests/inputTests/noHub.xml"};
+    for (unsigned int i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+        ASSERT_TRUE(FileExists(paths[i]));
+        XMLStreamReader s(paths[i]);
+        EXPECT_FALSE(s.isSupported()) << paths[i];
+    }
+
+    Simulation simulation;
+    std::ostringstream errors;
+    EXPECT_THROW(simulation.importXmlFile("tests/inputTests/wrongClosingTagXml1.xml", "", errors), Exception);
+}
@@ -39,71 +39,43 @@ bool XMLReader::properlyInitialized() const {
     return XMLReader::_initCheck == this;
 }
 
-bool XMLReader::acceptedTags(std::ostream &errorStream, const char *knownTagsDocument) {
-    REQUIRE(properlyInitialized(), "XMLReader object must be properly initialized");
+void XMLReader::setArena(Arena *arena) {
 
-    if(!FileExists(knownTagsDocument)){
-        errorStream << "cannot find file with accepted tags" << std::endl;
-    }
-    TiXmlDocument* checkFile = new TiXmlDocument();
-    if(!checkFile->LoadFile(knownTagsDocument)) {
-        errorStream << "error in find file with accepted tags: " << checkFile->ErrorDesc() << std::endl;
-    }
-
-    TiXmlNode *node = checkFile->RootElement();
-    allowedTags = new std::list<std::pair<std::string, int> >();
-    knownTags(node,0);
-    delete checkFile;
-    node = doc->RootElement();
-    return checkTags(node,errorStream,0);
+    REQUIRE(properlyInitialized(), "XMLReader object must be properly initialized");
+    farena = arena;
 }
 
-bool XMLReader::checkTags(TiXmlNode *node, std::ostream &errorStream, int depth) const {
-
+bool XMLReader::acceptedTags(std::ostream &errorStream, const char *knownTagsDocument) {
     REQUIRE(properlyInitialized(), "XMLReader object must be properly initialized");
 
-    bool rtn = true;
-    while (node != NULL) {
-        std::string naam = node->ToElement()->Value();
-        if (!checkTag(naam, depth)) {
-            errorStream << "Error unknown tag: '" << node->ToElement()->Value() << "'" << std::endl;
-            rtn = false;
-        }
-        if (node->FirstChildElement() != NULL) {
-            bool rtn1 = checkTags(node->FirstChildElement(), errorStream, depth + 1);
-            if(rtn == true)
-                rtn = rtn1;
-
-        }
-        node = node->Parent()->IterateChildren(node);
-    }
-    return rtn;
+    TagSchema schema(knownTagsDocument, errorStream);
+    return acceptedTags(errorStream, schema);
 }
 
-bool XMLReader::checkTag(std::string& name, int diepte) const {
-
+bool XMLReader::acceptedTags(std::ostream &errorStream, const TagSchema &schema) const {
     REQUIRE(properlyInitialized(), "XMLReader object must be properly initialized");
 
-    for(std::list<std::pair<std::string, int> >::iterator it = allowedTags->begin(); it !=  allowedTags->end(); it++){
-        if((*it).first == name && (*it).second == diepte){
-            return true;
-        }
-    }
-    return false;
+    return checkTags(doc->FirstChildElement(), errorStream, 0, schema);
 }
 
-void XMLReader::knownTags(TiXmlNode *node,int diepte) {
+bool XMLReader::checkTags(const TiXmlElement *element, std::ostream &errorStream, int depth,
+                          const TagSchema &schema) const {
 
     REQUIRE(properlyInitialized(), "XMLReader object must be properly initialized");
 
-    while (node != NULL) {
-        std::string naam = node->ToElement()->Value();
-        allowedTags->push_back(std::pair<std::string, int>(naam, diepte));
-        if (node->FirstChildElement() != NULL) {
-            knownTags(node->FirstChildElement(),diepte + 1);
+    bool rtn = true;
+    while (element != NULL) {
+        const TIXML_STRING &name = element->ValueTStr();
+        if (!schema.isKnown(name.c_str(), name.length(), depth)) {
+            errorStream << "Error unknown tag: '" << element->Value() << "'" << std::endl;
+            rtn = false;
         }
-        node = node->Parent()->IterateChildren(node);
+        if (!checkTags(element->FirstChildElement(), errorStream, depth + 1, schema)) {
+            rtn = false;
+        }
+        element = element->NextSiblingElement();
     }
+    return rtn;
 }
 
 std::vector<Hub*> XMLReader::readHubs(std::map<std::string, VaccinationCenter *> &vaccinationCentras,  std::ostream &errorStream) {
@@ -112,12 +84,10 @@ std::vector<Hub*> XMLReader::readHubs(std::map<std::string, VaccinationCenter *>
 
     std::vector<Hub*> hubs;
 
-    std::list<std::pair<std::string, int> > knownTags; //even = naam van tag, oneven = diepte van tag --> list[0] = naam en list[0 + 1] = diepte
-
     TiXmlElement* xmlHub = getElement("HUB");
     while(xmlHub != NULL) {
+        Hub* newHub = farena != NULL ? farena->createHub() : new Hub();
         try{
-            Hub* newHub = new Hub();
 
             TiXmlElement* xmlVaccin = xmlHub->FirstChildElement("VACCIN");
 
@@ -192,6 +162,12 @@ std::vector<Hub*> XMLReader::readHubs(std::map<std::string, VaccinationCenter *>
         }
         catch (Exception ex) {
             errorStream  << "Hub not added: " << ex.value() << std::endl;
+            if (farena != NULL) {
+                farena->destroy(newHub);
+            }
+            else {
+                delete newHub;
+            }
         }
         xmlHub = xmlHub->NextSiblingElement("HUB");
     }
@@ -217,7 +193,8 @@ std::map<std::string, VaccinationCenter *> XMLReader::readVaccinationCenters(std
             int population = ToInt(inwonersString);
             int capacity = ToInt(capacityString);
 
-            VaccinationCenter *center = new VaccinationCenter(name, address, population, capacity);
+            VaccinationCenter *center = farena != NULL ? farena->createCenter(name, address, population, capacity)
+                                                       : new VaccinationCenter(name, address, population, capacity);
 
             VaccinationCentera[name] = center;
         }
@@ -233,6 +210,7 @@ XMLReader::XMLReader(const char *path) {
 
     REQUIRE(FileExists(path), "File must exist on path");
     doc = NULL;
+    farena = NULL;
     doc = new TiXmlDocument();
 
     if(!doc->LoadFile(path)) {
@@ -17,6 +17,8 @@
 #include "Utils.h"
 #include "Simulation.h"
 #include "Hub.h"
+#include "TagSchema.h"
+#include "Arena.h"
 
 /**
  * \brief Class implemented for a XMLReader object, used to read data from .xml files
@@ -24,48 +26,25 @@
 class XMLReader {
 
     TiXmlDocument* doc; // Pointer to TiXmlDocument
-    std::list<std::pair<std::string, int> >* allowedTags;
+    Arena *farena; ///< Owner of the Hubs and VaccinationCenters that are read, NULL when the caller owns them
     XMLReader *_initCheck;
 
     /**
-     * \brief check's if the node with name 'name' is in the allowedTags list
+     * \brief check's for an element, its siblings after it and all their children if the tag is in the schema
      *
-     * @param name: the name of the node
-     * @param diepte: the nested depth of the node
-     *
-     * @pre
-     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
-     *
-     * @return bool true: node name is in list, false: node name is not in the list
-     */
-    bool checkTag(std::string& name, int depht) const;
-
-    /**
-     * \brief check's for all sibling, child nodes of the name is in the list
-     *
-     * @param node: the start node
+     * @param element: the start element
      * @param errorStream: the error stream to print
      * @param depth: starting depth
+     * @param schema: the allowed tags
      *
      * @pre
      * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
      *
-     * @return bool true: node name is in list, false: node name is not in the list
+     * @return bool true: all tags are in the schema, false: not all tags are in the schema
      *
      */
-    bool checkTags(TiXmlNode *node, std::ostream &errorStream, int depth) const;
+    bool checkTags(const TiXmlElement *element, std::ostream &errorStream, int depth, const TagSchema &schema) const;
 
-    /**
-     * \brief pushes all node names (sibling, child nodes) to the allowedTags list
-     *
-     * @param node: the start node
-     * @param depth: starting depth
-     *
-     * @pre
-     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
-     *
-     */
-    void knownTags(TiXmlNode *node,int depth);
 public:
     /**
      * \brief initialize XMLReader, en create a TiXmlDocument for filepad
@@ -96,6 +75,15 @@ public:
     */
     bool properlyInitialized() const;
 
+    /**
+     * \brief Set the Arena that owns the Hubs and VaccinationCenters that are read, without one they are created
+     *        with new and deleted by the caller
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "XMLReader object must be properly initialized")
+     */
+    void setArena(Arena *arena);
+
     /**
      * \brief gives TiXmlElement whith tag 'name'
      *
@@ -133,6 +121,19 @@ public:
      */
     bool acceptedTags(std::ostream &errorStream, const char *knownTagsDocument);
 
+    /**
+     * \brief checks if all nodes in the doc are allowed by a schema, unknown tags are printed in the order of the doc
+     *
+     * @param errorStream the error stream
+     * @param schema the allowed tags, can be used for any number of docs
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "Simulation object must be properly initialized")
+     *
+     * @return true: all tags are allowed, false: not all the tags are allowed
+     */
+    bool acceptedTags(std::ostream &errorStream, const TagSchema &schema) const;
+
     /**
      * \brief reads all hubs from xml file
      *
@@ -0,0 +1,625 @@
+/**
+ * @file XMLStreamReader.cpp
+ * @brief This file contains the definitions of the members of the XMLStreamReader class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <strings.h>
+#include "XMLStreamReader.h"
+
+/**
+ * \brief Names of the values of a VACCINATIECENTRUM, VACCIN and HUB element
+ */
+static const char *const kCenterFields[] = {"naam", "adres", "inwoners", "capaciteit"};
+static const char *const kVaccinFields[] = {"type", "levering", "interval", "transport", "hernieuwing", "temperatuur"};
+static const char *const kHubFields[] = {"levering", "interval", "transport"};
+
+/**
+ * \brief Check whether a character is white space for TinyXML
+ */
+static bool isSpace(char c) {
+
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ * \brief Check whether the name of an element, which is not ended by '\0', equals a string
+ */
+static bool nameEquals(const char *name, size_t length, const char *other) {
+
+    return std::strlen(other) == length && std::strncmp(name, other, length) == 0;
+}
+
+/**
+ * \brief Place of a name in a list of names
+ *
+ * @return Index of the name, -1 when it is not in the list
+ */
+static int findField(const char *const *fields, int count, const char *name, size_t length) {
+
+    for (int i = 0; i < count; i++) {
+        if (nameEquals(name, length, fields[i])) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * \brief Skip white space, p is moved to the first other character
+ *
+ * @return false when p is at a byte order mark, TinyXML skips those as white space in UTF-8 documents
+ */
+static bool skipWhiteSpace(const char *&p) {
+
+    while (isSpace(*p)) {
+        p++;
+    }
+    const unsigned char *u = reinterpret_cast<const unsigned char *>(p);
+    return !(u[0] == 0xef && (u[1] == 0xbb || u[1] == 0xbf));
+}
+
+/**
+ * \brief Length of the name of an element, names with characters outside of ASCII are not supported
+ *
+ * @return Length of the name, 0 when there is no supported name
+ */
+static size_t nameLength(const char *p) {
+
+    if (!std::isalpha(static_cast<unsigned char>(*p)) && *p != '_') {
+        return 0;
+    }
+    size_t length = 1;
+    while (std::isalnum(static_cast<unsigned char>(p[length])) || p[length] == '_' || p[length] == '-' ||
+           p[length] == '.' || p[length] == ':') {
+        length++;
+    }
+    return length;
+}
+
+/**
+ * \brief Length of a UTF-8 sequence
+ *
+ * @return Length of the sequence, 0 when it is not valid UTF-8
+ */
+static size_t sequenceLength(const char *p) {
+
+    const unsigned char *u = reinterpret_cast<const unsigned char *>(p);
+    size_t length;
+    if (u[0] >= 0xc2 && u[0] <= 0xdf) {
+        length = 2;
+    }
+    else if (u[0] >= 0xe0 && u[0] <= 0xef) {
+        length = 3;
+    }
+    else if (u[0] >= 0xf0 && u[0] <= 0xf4) {
+        length = 4;
+    }
+    else {
+        return 0;
+    }
+    for (size_t i = 1; i < length; i++) {
+        if (u[i] < 0x80 || u[i] > 0xbf) {
+            return 0;
+        }
+    }
+    return length;
+}
+
+/**
+ * \brief Scan text like TinyXML, white space at the start and the end is removed and other white space becomes a
+ *        single space, p is moved to the '<' after the text
+ *
+ * @param p Start of the text, not white space
+ * @param text String the text is written to, NULL when the text is not needed
+ *
+ * @return true when the text is supported, false when not
+ */
+static bool scanText(const char *&p, std::string *text) {
+
+    bool whitespace = false;
+    while (*p != '<') {
+        if (*p == '\0') {
+            return false;
+        }
+        if (isSpace(*p)) {
+            whitespace = true;
+            p++;
+            continue;
+        }
+        if (whitespace && text != NULL) {
+            text->push_back(' ');
+        }
+        whitespace = false;
+
+        size_t length = 1;
+        char entity = '\0';
+        if (*p == '&') {
+            // Only the named entities, TinyXML also reads numeric entities and keeps unknown entities as text
+            if (std::strncmp(p, "&amp;", 5) == 0) { entity = '&'; length = 5; }
+            else if (std::strncmp(p, "&lt;", 4) == 0) { entity = '<'; length = 4; }
+            else if (std::strncmp(p, "&gt;", 4) == 0) { entity = '>'; length = 4; }
+            else if (std::strncmp(p, "&quot;", 6) == 0) { entity = '"'; length = 6; }
+            else if (std::strncmp(p, "&apos;", 6) == 0) { entity = '\''; length = 6; }
+            else {
+                return false;
+            }
+        }
+        else if (static_cast<unsigned char>(*p) >= 0x80) {
+            length = sequenceLength(p);
+            if (length == 0) {
+                return false;
+            }
+        }
+
+        if (text != NULL) {
+            if (entity != '\0') {
+                text->push_back(entity);
+            }
+            else {
+                text->append(p, length);
+            }
+        }
+        p += length;
+    }
+    return true;
+}
+
+/**
+ * \brief Scan a comment, p is moved to the end of the comment
+ *
+ * @param p Start of the comment, at "<!--"
+ * @param text String the text of the comment is written to, NULL when the text is not needed
+ *
+ * @return true when the comment is ended, false when not
+ */
+static bool scanComment(const char *&p, std::string *text) {
+
+    const char *end = std::strstr(p + 4, "-->");
+    if (end == NULL) {
+        return false;
+    }
+    if (text != NULL) {
+        text->assign(p + 4, end);
+    }
+    p = end + 3;
+    return true;
+}
+
+/**
+ * \brief Scan an xml declaration, only version, encoding and standalone in quotes are supported, p is moved to the
+ *        end of the declaration
+ *
+ * @param p Start of the declaration, at "<?xml"
+ *
+ * @return true when the declaration is supported, false when not
+ */
+static bool scanDeclaration(const char *&p) {
+
+    p += 5;
+    while (true) {
+        if (*p == '>') {
+            p++;
+            return true;
+        }
+        if (!skipWhiteSpace(p)) {
+            return false;
+        }
+        if (p[0] == '?' && p[1] == '>') {
+            p += 2;
+            return true;
+        }
+
+        const char *name = p;
+        while (std::isalpha(static_cast<unsigned char>(*p))) {
+            p++;
+        }
+        size_t length = p - name;
+        if (!(length == 7 && strncasecmp(name, "version", 7) == 0) &&
+            !(length == 8 && strncasecmp(name, "encoding", 8) == 0) &&
+            !(length == 10 && strncasecmp(name, "standalone", 10) == 0)) {
+            return false;
+        }
+        if (!skipWhiteSpace(p) || *p != '=') {
+            return false;
+        }
+        p++;
+        if (!skipWhiteSpace(p) || (*p != '"' && *p != '\'')) {
+            return false;
+        }
+        char quote = *p;
+        p++;
+        while (*p != quote) {
+            if (*p == '\0' || *p == '&' || *p == '>' || static_cast<unsigned char>(*p) >= 0x80) {
+                return false;
+            }
+            p++;
+        }
+        p++;
+    }
+}
+
+XMLStreamReader::XMLStreamReader(const char *path, const TagSchema *schema) : fschema(schema), farena(NULL) {
+
+    REQUIRE(FileExists(path), "File must exist on path");
+
+    // The file is only kept while it is scanned
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    file.seekg(0, std::ios::end);
+    std::streamoff size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    std::vector<char> buffer(size > 0 ? static_cast<size_t>(size) + 1 : 1, '\0');
+    if (size > 0) {
+        file.read(&buffer[0], size);
+    }
+    file.close();
+
+    fsupported = scanDocument(&buffer[0]);
+    if (!fsupported) {
+        fcentraRecords.clear();
+        fhubRecords.clear();
+        funknownTags.clear();
+    }
+    _initCheck = this;
+    ENSURE(properlyInitialized(), "Constructor must end in a properly initialized state");
+}
+
+bool XMLStreamReader::properlyInitialized() const {
+
+    return XMLStreamReader::_initCheck == this;
+}
+
+void XMLStreamReader::setArena(Arena *arena) {
+
+    REQUIRE(properlyInitialized(), "XMLStreamReader object must be properly initialized");
+    farena = arena;
+}
+
+bool XMLStreamReader::isSupported() const {
+
+    REQUIRE(properlyInitialized(), "XMLStreamReader object must be properly initialized");
+    return fsupported;
+}
+
+bool XMLStreamReader::scanDocument(const char *p) {
+
+    // Byte order mark of UTF-8
+    if (std::strncmp(p, "\xef\xbb\xbf", 3) == 0) {
+        p += 3;
+    }
+
+    // TinyXML does not accept a document without nodes
+    bool found = false;
+    while (true) {
+        if (!skipWhiteSpace(p)) {
+            return false;
+        }
+        if (*p == '\0') {
+            return found;
+        }
+        if (*p != '<') {
+            // TinyXML stops reading at text outside of the elements
+            return false;
+        }
+
+        if (strncasecmp(p, "<?xml", 5) == 0) {
+            if (!scanDeclaration(p)) {
+                return false;
+            }
+        }
+        else if (std::strncmp(p, "<!--", 4) == 0) {
+            if (!scanComment(p, NULL)) {
+                return false;
+            }
+        }
+        else {
+            const char *name = p + 1;
+            size_t length = nameLength(name);
+            bool scanned;
+            if (nameEquals(name, length, "VACCINATIECENTRUM")) {
+                fcentraRecords.push_back(Record());
+                scanned = scanElement(p, kCenter, NULL, &fcentraRecords.back(), NULL, 0);
+            }
+            else if (nameEquals(name, length, "HUB")) {
+                fhubRecords.push_back(HubRecord());
+                scanned = scanElement(p, kHub, NULL, &fhubRecords.back().fields, &fhubRecords.back(), 0);
+            }
+            else {
+                scanned = scanElement(p, kSkip, NULL, NULL, NULL, 0);
+            }
+            if (!scanned) {
+                return false;
+            }
+        }
+        found = true;
+    }
+}
+
+bool XMLStreamReader::scanElement(const char *&p, Content content, Value *value, Record *record, HubRecord *hub,
+                                  int depth) {
+
+    const char *name = p + 1;
+    size_t length = nameLength(name);
+    if (length == 0) {
+        return false;
+    }
+    if (fschema != NULL && !fschema->isKnown(name, length, depth)) {
+        funknownTags.push_back(std::string(name, length));
+    }
+    p = name + length;
+
+    // Attributes are not supported
+    if (!skipWhiteSpace(p)) {
+        return false;
+    }
+    if (content == kValue) {
+        value->state = kEmpty;
+    }
+    if (p[0] == '/' && p[1] == '>') {
+        p += 2;
+        return true;
+    }
+    if (*p != '>') {
+        return false;
+    }
+    p++;
+
+    bool first = true;
+    while (true) {
+        if (!skipWhiteSpace(p) || *p == '\0') {
+            return false;
+        }
+
+        if (*p != '<') {
+            // Text is only expected in the elements of a value
+            if (content != kValue && content != kSkip) {
+                return false;
+            }
+            std::string *text = NULL;
+            if (content == kValue && first) {
+                value->state = kText;
+                text = &value->text;
+            }
+            if (!scanText(p, text)) {
+                return false;
+            }
+        }
+        else if (p[1] == '/') {
+            p += 2;
+            if (std::strncmp(p, name, length) != 0) {
+                return false;
+            }
+            p += length;
+            if (!skipWhiteSpace(p) || *p != '>') {
+                return false;
+            }
+            p++;
+            return true;
+        }
+        else if (std::strncmp(p, "<!--", 4) == 0) {
+            std::string comment;
+            if (!scanComment(p, content == kValue ? NULL : &comment)) {
+                return false;
+            }
+            if (content == kValue && first) {
+                value->state = kNotText;
+            }
+            else if (content == kCenter || content == kVaccin || content == kHub) {
+                // XMLReader::getElementValue also finds a comment of which the text is the name, it has no children
+                int field = -1;
+                if (content == kCenter) {
+                    field = findField(kCenterFields, 4, comment.c_str(), comment.size());
+                }
+                else if (content == kVaccin) {
+                    field = findField(kVaccinFields, 6, comment.c_str(), comment.size());
+                }
+                else {
+                    field = findField(kHubFields, 3, comment.c_str(), comment.size());
+                }
+                if (field >= 0 && record->values[field].state == kMissing) {
+                    record->values[field].state = kEmpty;
+                }
+            }
+        }
+        else {
+            if (content == kValue && first) {
+                value->state = kNotText;
+            }
+            if (!scanChild(p, content, record, hub, depth + 1)) {
+                return false;
+            }
+        }
+        first = false;
+    }
+}
+
+bool XMLStreamReader::scanChild(const char *&p, Content content, Record *record, HubRecord *hub, int depth) {
+
+    const char *name = p + 1;
+    size_t length = nameLength(name);
+    if (length == 0) {
+        return false;
+    }
+
+    int field = -1;
+    if (content == kCenter) {
+        field = findField(kCenterFields, 4, name, length);
+    }
+    else if (content == kVaccin) {
+        field = findField(kVaccinFields, 6, name, length);
+    }
+    else if (content == kHub) {
+        field = findField(kHubFields, 3, name, length);
+    }
+
+    // Only the first child with the name of a value is used, like XMLReader::getElementValue
+    if (field >= 0 && record->values[field].state == kMissing) {
+        return scanElement(p, kValue, &record->values[field], NULL, NULL, depth);
+    }
+    if (content == kHub && nameEquals(name, length, "VACCIN")) {
+        hub->vaccins.push_back(Record());
+        return scanElement(p, kVaccin, NULL, &hub->vaccins.back(), NULL, depth);
+    }
+    if (content == kHub && nameEquals(name, length, "CENTRA") && !hub->hasCentra) {
+        hub->hasCentra = true;
+        return scanElement(p, kCentra, NULL, NULL, hub, depth);
+    }
+    if (content == kCentra && nameEquals(name, length, "centrum")) {
+        hub->centra.push_back(Value());
+        return scanElement(p, kValue, &hub->centra.back(), NULL, NULL, depth);
+    }
+    return scanElement(p, kSkip, NULL, NULL, NULL, depth);
+}
+
+bool XMLStreamReader::acceptedTags(std::ostream &errorStream) const {
+
+    REQUIRE(properlyInitialized(), "XMLStreamReader object must be properly initialized");
+    REQUIRE(isSupported(), "File must be supported by the XMLStreamReader");
+
+    for (std::vector<std::string>::const_iterator it = funknownTags.begin(); it != funknownTags.end(); it++) {
+        errorStream << "Error unknown tag: '" << *it << "'" << std::endl;
+    }
+    return funknownTags.empty();
+}
+
+std::string XMLStreamReader::getValue(const Value &value, const char *name) {
+
+    if (value.state == kMissing) throw Exception("Element not found: " + std::string(name));
+    if (value.state == kEmpty) throw Exception("Element is empty: " + std::string(name));
+    if (value.state == kNotText) throw Exception("Element not found " + std::string(name));
+    return value.text;
+}
+
+std::map<std::string, VaccinationCenter *> XMLStreamReader::readVaccinationCenters(std::ostream &errorStream) {
+
+    REQUIRE(properlyInitialized(), "XMLStreamReader object must be properly initialized");
+    REQUIRE(isSupported(), "File must be supported by the XMLStreamReader");
+
+    if (fcentraRecords.empty()) {
+        throw Exception("Element not found: VACCINATIECENTRUM");
+    }
+
+    std::map<std::string, VaccinationCenter *> vaccinationCentras;
+    for (std::vector<Record>::const_iterator it = fcentraRecords.begin(); it != fcentraRecords.end(); it++) {
+        try {
+            std::string name = getValue(it->values[0], "naam");
+            std::string address = getValue(it->values[1], "adres");
+            std::string populationString = getValue(it->values[2], "inwoners");
+            std::string capacityString = getValue(it->values[3], "capaciteit");
+            int population = ToInt(populationString);
+            int capacity = ToInt(capacityString);
+
+            // A later VaccinationCenter with the same name replaces the earlier one
+            VaccinationCenter *center = farena != NULL ? farena->createCenter(name, address, population, capacity)
+                                                       : new VaccinationCenter(name, address, population, capacity);
+            std::map<std::string, VaccinationCenter *>::iterator old = vaccinationCentras.find(name);
+            if (old != vaccinationCentras.end()) {
+                if (farena != NULL) {
+                    farena->destroy(old->second);
+                }
+                else {
+                    delete old->second;
+                }
+                old->second = center;
+            }
+            else {
+                vaccinationCentras.insert(std::make_pair(name, center));
+            }
+        }
+        catch (Exception ex) {
+            errorStream << ex.value() << std::endl;
+        }
+    }
+    return vaccinationCentras;
+}
+
+std::vector<Hub *> XMLStreamReader::readHubs(std::map<std::string, VaccinationCenter *> &vaccinationCentras,
+                                              std::ostream &errorStream) {
+
+    REQUIRE(properlyInitialized(), "XMLStreamReader object must be properly initialized");
+    REQUIRE(isSupported(), "File must be supported by the XMLStreamReader");
+
+    if (fhubRecords.empty()) {
+        throw Exception("Element not found: HUB");
+    }
+
+    std::vector<Hub *> hubs;
+    for (std::vector<HubRecord>::const_iterator it = fhubRecords.begin(); it != fhubRecords.end(); it++) {
+        Hub *newHub = farena != NULL ? farena->createHub() : new Hub();
+        try {
+            // Hub heeft maar een vaccin en er is geen vaccin tag
+            if (it->vaccins.empty()) {
+                std::string delivery = getValue(it->fields.values[0], "levering");
+                std::string interval = getValue(it->fields.values[1], "interval");
+                std::string transport = getValue(it->fields.values[2], "transport");
+
+                int intDelivery = ToInt(delivery);
+                int intInterval = ToInt(interval);
+                int intTransport = ToInt(transport);
+
+                newHub->addVaccin(new VaccinInHub("HUB_BASE_VACCIN", intDelivery, intInterval, intTransport, 0, 420));
+            }
+            for (std::vector<Record>::const_iterator ite = it->vaccins.begin(); ite != it->vaccins.end(); ite++) {
+                try {
+                    std::string type = getValue(ite->values[0], "type");
+                    std::string delivery = getValue(ite->values[1], "levering");
+                    std::string interval = getValue(ite->values[2], "interval");
+                    std::string transport = getValue(ite->values[3], "transport");
+                    std::string renewal = getValue(ite->values[4], "hernieuwing");
+                    std::string temp = getValue(ite->values[5], "temperatuur");
+
+                    int intDelivery = ToInt(delivery);
+                    int intInterval = ToInt(interval);
+                    int intTransport = ToInt(transport);
+                    int intRenewal = ToInt(renewal);
+                    int intTemp = ToInt(temp);
+
+                    newHub->addVaccin(new VaccinInHub(type, intDelivery, intInterval, intTransport, intRenewal,
+                                                      intTemp));
+                }
+                catch (Exception ex) {
+                    errorStream << "Vaccin not added: " << ex.value() << std::endl;
+                }
+            }
+
+            if (!it->hasCentra) {
+                throw Exception("No centra");
+            }
+            if (it->centra.empty()) {
+                std::cerr << "fout" << std::endl;
+            }
+            for (std::vector<Value>::const_iterator ite = it->centra.begin(); ite != it->centra.end(); ite++) {
+                if (ite->state == kText) {
+                    std::map<std::string, VaccinationCenter *>::iterator center = vaccinationCentras.find(ite->text);
+                    if (center != vaccinationCentras.end()) {
+                        newHub->addCenter(ite->text, center->second);
+                    }
+                    else {
+                        errorStream << "Centra " << ite->text << " does not exist" << std::endl;
+                    }
+                }
+                else {
+                    errorStream << "Empty centra name" << std::endl;
+                }
+            }
+            hubs.push_back(newHub);
+        }
+        catch (Exception ex) {
+            errorStream << "Hub not added: " << ex.value() << std::endl;
+            if (farena != NULL) {
+                farena->destroy(newHub);
+            }
+            else {
+                delete newHub;
+            }
+        }
+    }
+    if (hubs.empty()) {
+        throw Exception("0 correct Hubs found");
+    }
+    return hubs;
+}
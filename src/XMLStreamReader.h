@@ -0,0 +1,216 @@
+/**
+ * @file XMLStreamReader.h
+ * @brief This header file contains the declarations and members of the XMLStreamReader class
+ * @author Stein Vandenbroeke
+ * @date 17/10/2026
+ */
+
+#ifndef TTT_XMLSTREAMREADER_H
+#define TTT_XMLSTREAMREADER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <iostream>
+#include "Exception.h"
+#include "Utils.h"
+#include "Hub.h"
+#include "VaccinationCenter.h"
+#include "TagSchema.h"
+#include "Arena.h"
+
+/**
+ * \brief Class implemented for a XMLStreamReader object, reads the same .xml files as XMLReader without building a
+ *        TinyXML document
+ *
+ * The file is scanned once and only the values that XMLReader would look up are kept. Files with parts that TinyXML
+ * treats in a special way (attributes, CDATA, numeric entities, ...) or that TinyXML would not accept are not
+ * supported, those files must be read by XMLReader, which gives the same objects and errors.
+ * When a TagSchema is given, the tags are checked while the file is scanned.
+ */
+class XMLStreamReader {
+private:
+    /**
+     * \brief First child of an element with a given name, as seen by XMLReader::getElementValue
+     */
+    enum ValueState {
+        kMissing, ///< No child with the name
+        kEmpty, ///< Child without children of its own
+        kNotText, ///< Child of which the first child is not text
+        kText ///< Child of which the first child is text
+    };
+
+    /**
+     * \brief Kind of content of the scanned element
+     */
+    enum Content {
+        kSkip, kValue, kCenter, kVaccin, kHub, kCentra
+    };
+
+    /**
+     * \brief Value of a child element of a VACCINATIECENTRUM, VACCIN or HUB element
+     */
+    struct Value {
+        ValueState state;
+        std::string text;
+
+        Value() : state(kMissing) {}
+    };
+
+    /**
+     * \brief Values of a VACCINATIECENTRUM, VACCIN or HUB element, in the order of the names of its Content
+     */
+    struct Record {
+        Value values[6];
+    };
+
+    /**
+     * \brief Values, VACCIN elements and centrum elements of the first CENTRA element of a HUB element
+     */
+    struct HubRecord {
+        Record fields;
+        std::vector<Record> vaccins;
+        bool hasCentra;
+        std::vector<Value> centra;
+
+        HubRecord() : hasCentra(false) {}
+    };
+
+    std::vector<Record> fcentraRecords; ///< VACCINATIECENTRUM elements in the order of the file
+    std::vector<HubRecord> fhubRecords; ///< HUB elements in the order of the file
+    std::vector<std::string> funknownTags; ///< Names of the tags that are not in the schema, in the order of the file
+    const TagSchema *fschema; ///< Allowed tags, NULL when the tags are not checked
+    bool fsupported; ///< The file can be read by the XMLStreamReader
+    Arena *farena; ///< Owner of the Hubs and VaccinationCenters that are read, NULL when the caller owns them
+    XMLStreamReader *_initCheck;
+
+    /**
+     * \brief Scan the elements of a document
+     *
+     * @param p Start of the document, ends with '\0'
+     *
+     * @return true when the document is supported, false when not
+     */
+    bool scanDocument(const char *p);
+
+    /**
+     * \brief Scan an element and its children, p is moved to the end of the element
+     *
+     * @param p Start of the element
+     * @param content Kind of content of the element
+     * @param value Value written to when content is kValue
+     * @param record Record written to when content is kCenter, kVaccin or kHub
+     * @param hub HubRecord written to when content is kHub or kCentra
+     * @param depth Nested depth of the element, 0 for the root elements
+     *
+     * @return true when the element is supported, false when not
+     */
+    bool scanElement(const char *&p, Content content, Value *value, Record *record, HubRecord *hub, int depth);
+
+    /**
+     * \brief Scan a child element of an element, p is moved to the end of the child element
+     *
+     * @param p Start of the child element
+     * @param content Kind of content of the parent element
+     * @param record Record of the parent element when content is kCenter, kVaccin or kHub
+     * @param hub HubRecord of the parent element when content is kHub or kCentra
+     * @param depth Nested depth of the child element
+     *
+     * @return true when the child element is supported, false when not
+     */
+    bool scanChild(const char *&p, Content content, Record *record, HubRecord *hub, int depth);
+
+    /**
+     * \brief Gives the text of a value like XMLReader::getElementValue
+     *
+     * @param value The value
+     * @param name Name of the element of the value
+     *
+     * @return Text of the value, throws an Exception when the value has no text
+     */
+    static std::string getValue(const Value &value, const char *name);
+
+public:
+    /**
+     * \brief initialize XMLStreamReader and scan the file on path
+     *
+     * @param path location of the xml file
+     * @param schema allowed tags, checked while the file is scanned, NULL when the tags are not checked
+     *
+     * @pre
+     * REQUIRE(FileExists(path), "File must exist on path")
+     *
+     * @post
+     * ENSURE(properlyInitialized(), "Constructor must end in a properly initialized state")
+     */
+    XMLStreamReader(const char *path, const TagSchema *schema = NULL);
+
+    /**
+    * \brief Check whether the XMLStreamReader object is properly initialised
+    *
+    * @return true when object is properly initialised, false when not
+    */
+    bool properlyInitialized() const;
+
+    /**
+     * \brief Set the Arena that owns the Hubs and VaccinationCenters that are read, without one they are created
+     *        with new and deleted by the caller
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "XMLStreamReader object must be properly initialized")
+     */
+    void setArena(Arena *arena);
+
+    /**
+     * \brief Check whether the file can be read by the XMLStreamReader, when not it must be read by XMLReader
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "XMLStreamReader object must be properly initialized")
+     *
+     * @return true when the file is supported, false when not
+     */
+    bool isSupported() const;
+
+    /**
+     * \brief prints the tags that are not in the schema, gives the same errors as XMLReader::acceptedTags
+     *
+     * @param errorStream the error stream
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "XMLStreamReader object must be properly initialized")
+     * REQUIRE(isSupported(), "File must be supported by the XMLStreamReader")
+     *
+     * @return true: all tags are allowed or no schema is given, false: not all the tags are allowed
+     */
+    bool acceptedTags(std::ostream &errorStream) const;
+
+    /**
+     * \brief reads all hubs from xml file, gives the same hubs and errors as XMLReader::readHubs
+     *
+     * @param vaccinationCentras: map of all existing vaccinationCentras
+     * @param errorStream: all error streams
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "XMLStreamReader object must be properly initialized")
+     * REQUIRE(isSupported(), "File must be supported by the XMLStreamReader")
+     *
+     * @return std::vector<Hub*>: all hubs
+     */
+    std::vector<Hub*> readHubs(std::map<std::string, VaccinationCenter *> &vaccinationCentras, std::ostream &errorStream);
+
+    /**
+     * \brief reads all VaccinationCenters from xml file, gives the same VaccinationCenters and errors as
+     *        XMLReader::readVaccinationCenters
+     *
+     * @param errorStream: all error streams
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "XMLStreamReader object must be properly initialized")
+     * REQUIRE(isSupported(), "File must be supported by the XMLStreamReader")
+     *
+     * @return std::map<std::string, VaccinationCenter*>: all VaccinationCenters
+     */
+    std::map<std::string, VaccinationCenter*> readVaccinationCenters(std::ostream &errorStream);
+};
+
+#endif //TTT_XMLSTREAMREADER_H
@@ -7,6 +7,12 @@
 
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
+#include <cstdio>
+
+/**
+ * @brief Archive with the image of every simulated day, in the working directory
+ */
+static const char *kArchivePath = "Simulation.archive";
 
 MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent),
@@ -27,6 +33,7 @@ MainWindow::MainWindow(QWidget *parent) :
 MainWindow::~MainWindow()
 {
     REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+    stopWorker();
     delete ui;
 }
 
@@ -149,6 +156,22 @@ void MainWindow::on_buttonStart_clicked()
         return;
     }
 
+    // The images of the days are kept for the previous button and the export as mp4
+    try {
+        archive.open(kArchivePath, true);
+    }
+    catch (Exception ex) {
+        MessageBox msg;
+        msg.setWindowTitle("Error");
+        msg.setText(ex.value().c_str());
+        msg.setStyleSheet_();
+        msg.setIcon(QMessageBox::Critical);
+        msg.setStandardButtons(QMessageBox::Ok);
+        msg.autoClose = true;
+        msg.timeout = 2;
+        msg.exec();
+    }
+
     this->runSimulation = true;
     changeStateButtons(true);
     ui->buttonPrevious->setEnabled(false);
@@ -176,11 +199,16 @@ void MainWindow::on_buttonStop_clicked()
     ui->progressBarVaccinated->setValue(0);
     QStringList x;
     modelVaccins->setStringList(x);
-    on_action_bmp_triggered();
-    on_action_ini_triggered();
     this->runSimulation = false;
     changeStateButtons(false);
-    s.clearSimulation(true);
+    s.clearSimulation();
+    try {
+        archive.close();
+    }
+    catch (Exception ex) {
+        // The archive is removed
+    }
+    std::remove(kArchivePath);
     ui->buttonStart->setEnabled(true);
 
     MessageBox msg;
@@ -202,12 +230,14 @@ void MainWindow::on_buttonNext_clicked()
 
     if (this->runSimulation && s.checkSimulation() && s.properlyInitialized()) {
 
-        std::pair<std::string, std::string> pairReturn = s.simulate();
+        // The day is drawn in memory, no .ini or .bmp file is written
+        std::pair<std::string, std::string> pairReturn = s.simulate(false);
 
         updateTextEdit(QString::fromStdString(pairReturn.second));
 
-        std::string imageName = s.generateBmp(pairReturn.first);
-        updateLabelImage(tr(imageName.c_str()));
+        Image image = s.render();
+        updateLabelImage(image);
+        archiveImage(s.getIter() - 1, image);
 
         updateProgressBarVaccinated(s.getVaccinatedPercent());
         updateModels(s.getVaccinData());
@@ -233,8 +263,23 @@ void MainWindow::on_buttonPrevious_clicked() {
         msg.exec();
     }
 
-    std::string imageName = "Day-" + std::to_string(s.getIter() - 1) + ".bmp";
-    updateLabelImage(tr(imageName.c_str()));
+    // The image of the day before the current day is in the archive, day 0 has no image yet
+    QImage image;
+    if (archive.isOpen() && s.getIter() > 0 && archive.contains(s.getIter() - 1, DayArchive::kBmp)) {
+        try {
+            std::string bmp = archive.read(s.getIter() - 1, DayArchive::kBmp);
+            image.loadFromData(reinterpret_cast<const uchar *>(bmp.data()), static_cast<int>(bmp.size()), "BMP");
+        }
+        catch (Exception ex) {
+            // The day is drawn again
+        }
+    }
+    if (!image.isNull()) {
+        showLabelImage(image);
+    }
+    else {
+        updateLabelImage(s.render());
+    }
     updateProgressBarVaccinated(s.getVaccinatedPercent());
     updateModels(s.getVaccinData());
     vacinCount->updateData(s.getDayVaccinated());
@@ -259,15 +304,7 @@ void MainWindow::updateLabelImage(const QString &fileName) {
         bool valid = image.load(fileName);
 
         if (valid) {
-            if(image.width() > image.height()){
-                image = image.scaledToWidth(ui->labelImage->width(), Qt::SmoothTransformation);
-                image = image.scaledToWidth(ui->labelImage->height(), Qt::SmoothTransformation);
-            }
-            else{
-                image = image.scaledToHeight(ui->labelImage->width(), Qt::SmoothTransformation);
-                image = image.scaledToHeight(ui->labelImage->height(), Qt::SmoothTransformation);
-            }
-            ui->labelImage->setPixmap(QPixmap::fromImage(image));
+            showLabelImage(image);
         }
         else {
             const char* errMsg = "Could not show image!";
@@ -285,6 +322,47 @@ void MainWindow::updateLabelImage(const QString &fileName) {
     }
 }
 
+void MainWindow::updateLabelImage(const Image &image) {
+
+    REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+
+    // The QImage uses the pixels of the Image, showLabelImage scales it to a copy
+    showLabelImage(QImage(image.getPixels(), image.getWidth(), image.getHeight(), image.getWidth() * 3,
+                          QImage::Format_RGB888));
+}
+
+void MainWindow::archiveImage(int day, const Image &image) {
+
+    REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+
+    if (!archive.isOpen()) {
+        return;
+    }
+    std::ostringstream bmp(std::ios::out | std::ios::binary);
+    image.writeBmp(bmp);
+    try {
+        archive.append(day, DayArchive::kBmp, bmp.str());
+    }
+    catch (Exception ex) {
+        // A day that is not in the archive is drawn again by the previous button
+    }
+}
+
+void MainWindow::showLabelImage(QImage image) {
+
+    REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+
+    if(image.width() > image.height()){
+        image = image.scaledToWidth(ui->labelImage->width(), Qt::SmoothTransformation);
+        image = image.scaledToWidth(ui->labelImage->height(), Qt::SmoothTransformation);
+    }
+    else{
+        image = image.scaledToHeight(ui->labelImage->width(), Qt::SmoothTransformation);
+        image = image.scaledToHeight(ui->labelImage->height(), Qt::SmoothTransformation);
+    }
+    ui->labelImage->setPixmap(QPixmap::fromImage(image));
+}
+
 void MainWindow::updateProgressBarVaccinated(const int x) {
 
     REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
@@ -311,73 +389,195 @@ void MainWindow::updateModels(const std::map<const std::string, int> &vaccins) {
 void MainWindow::on_action_ini_triggered()
 {
     REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
-    std::system("rm *.ini");
+    clearArchive();
 }
 
 void MainWindow::on_action_bmp_triggered()
 {
     REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
-    std::system("rm *.bmp");
+    clearArchive();
 }
 
-void MainWindow::on_buttonAutoSimulation_clicked() {
+void MainWindow::clearArchive() {
+
     REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
-    if(!autoSimulation){
-        ui->buttonAutoSimulationPausePlay->setVisible(true);
-        ui->buttonAutoSimulation->setText("Stop");
-        ui->buttonAutoSimulation->setStyleSheet("border-style: solid;\nborder-top-color: transparent;\nborder-right-color: transparent;\nborder-left-color: transparent;\nborder-bottom-width: 1px;\nborder-bottom-color: rgb(212, 60, 136);\nborder-style: solid;\ncolor: #a9b7c6;\npadding: 2px;\nbackground-color: #1e1d23;");
-        autoSimulation = true;
-        int days = ui->Days->value();
-        int delay = ui->Delay->value();
-        if (this->runSimulation && s.checkSimulation() && s.properlyInitialized()) {
-            for (int i = 0; i < days && autoSimulation; i++) {
-                ui->currentDay->setText(("Current day: " + std::to_string(s.getIter() + 1)).c_str());
-                std::pair<std::string, std::string> pairReturn = s.simulate();
-
-                updateTextEdit(QString::fromStdString(pairReturn.second));
-
-                std::string imageName = s.generateBmp(pairReturn.first);
-                updateLabelImage(tr(imageName.c_str()));
-
-                updateProgressBarVaccinated(s.getVaccinatedPercent());
-                updateModels(s.getVaccinData());
-                vacinCount->updateData(s.getDayVaccinated());
-                typeDelivery->updateData(s.getVaccinData());
-                QTime dieTime = QTime::currentTime().addSecs(delay);
-                while (QTime::currentTime() < dieTime || pauseSimulation)
-                    QCoreApplication::processEvents(QEventLoop::AllEvents, 100);
-            }
+
+    // The worker appends to the archive while the auto simulation runs
+    if (autoSimulation) {
+        return;
+    }
+    try {
+        if (archive.isOpen()) {
+            archive.close();
+            archive.open(kArchivePath, true);
         }
-        else{
-            MessageBox msg;
-            msg.setWindowTitle("No simulation");
-            msg.setText("Open an simulation file");
-            msg.setStyleSheet_();
-            msg.setStandardButtons(QMessageBox::Ok);
-            msg.autoClose = true;
-            msg.timeout = 2;
-            msg.exec();
+        else {
+            std::remove(kArchivePath);
         }
     }
+    catch (Exception ex) {
+        // The days that are not in the archive are drawn again by the previous button
+    }
+}
+
+void MainWindow::on_buttonAutoSimulation_clicked() {
+    REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+    if (autoSimulation) {
+        // autoSimulationFinished resets the buttons when the worker stops
+        worker->stop();
+        return;
+    }
+    if (!this->runSimulation || !s.checkSimulation() || !s.properlyInitialized()) {
+        MessageBox msg;
+        msg.setWindowTitle("No simulation");
+        msg.setText("Open an simulation file");
+        msg.setStyleSheet_();
+        msg.setStandardButtons(QMessageBox::Ok);
+        msg.autoClose = true;
+        msg.timeout = 2;
+        msg.exec();
+        return;
+    }
+    ui->buttonAutoSimulationPausePlay->setVisible(true);
+    ui->buttonAutoSimulation->setText("Stop");
+    ui->buttonAutoSimulation->setStyleSheet("border-style: solid;\nborder-top-color: transparent;\nborder-right-color: transparent;\nborder-left-color: transparent;\nborder-bottom-width: 1px;\nborder-bottom-color: rgb(212, 60, 136);\nborder-style: solid;\ncolor: #a9b7c6;\npadding: 2px;\nbackground-color: #1e1d23;");
+    autoSimulation = true;
+
+    // The worker owns the Simulation until it stops, only the data of a paused simulation can be shown once the worker
+    // sends paused
+    changeStateButtons(false);
+    ui->buttonAutoSimulation->setEnabled(true);
+    ui->buttonAutoSimulationPausePlay->setEnabled(true);
+
+    workerThread = new QThread(this);
+    worker = new SimulationWorker(&s, ui->Days->value(), ui->Delay->value(), archive.isOpen() ? &archive : nullptr);
+    workerPause = pauseSimulation ? worker->setPaused(true) : 0;
+    workerWaiting = false;
+    worker->moveToThread(workerThread);
+    connect(workerThread, &QThread::started, worker, &SimulationWorker::run);
+    connect(worker, &SimulationWorker::dayFinished, this, &MainWindow::showDayResult, Qt::QueuedConnection);
+    connect(worker, &SimulationWorker::failed, this, &MainWindow::showSimulationError, Qt::QueuedConnection);
+    connect(worker, &SimulationWorker::paused, this, &MainWindow::workerPaused, Qt::QueuedConnection);
+    connect(worker, &SimulationWorker::finished, this, &MainWindow::autoSimulationFinished, Qt::QueuedConnection);
+    workerThread->start();
+}
+
+void MainWindow::showDayResult(const SimulationWorker::DayResult &result) {
+
+    REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+
+    updateTextEdit(result.log);
+    showLabelImage(result.image);
+    updateProgressBarVaccinated(result.vaccinatedPercent);
+    updateModels(result.vaccinData);
+    vacinCount->updateData(result.dayVaccinated);
+    typeDelivery->updateData(result.vaccinData);
+    ui->currentDay->setText(("Current day: " + std::to_string(result.day)).c_str());
+}
+
+void MainWindow::showSimulationError(const QString &message) {
+
+    REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+
+    MessageBox msg;
+    msg.setWindowTitle("Error");
+    msg.setText(message);
+    msg.setStyleSheet_();
+    msg.setIcon(QMessageBox::Critical);
+    msg.setStandardButtons(QMessageBox::Ok);
+    msg.autoClose = true;
+    msg.timeout = 2;
+    msg.exec();
+}
+
+void MainWindow::workerPaused(int pause) {
+
+    REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+
+    if (worker != nullptr && pauseSimulation && pause == workerPause) {
+        workerWaiting = true;
+        ui->dataButton->setEnabled(true);
+    }
+}
+
+void MainWindow::autoSimulationFinished() {
+
+    REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+
+    stopWorker();
+    changeStateButtons(true);
+    ui->buttonStart->setEnabled(false);
     ui->buttonAutoSimulation->setText("Start");
     ui->buttonAutoSimulation->setStyleSheet("border-style: solid;\nborder-top-color: transparent;\nborder-right-color: transparent;\nborder-left-color: transparent;\nborder-bottom-width: 1px;\nborder-bottom-color: #04b97f;\nborder-style: solid;\ncolor: #a9b7c6;\npadding: 2px;\nbackground-color: #1e1d23;");
     ui->buttonAutoSimulationPausePlay->setVisible(false);
     autoSimulation = false;
 }
 
+void MainWindow::stopWorker() {
+
+    REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+
+    if (workerThread == nullptr) {
+        return;
+    }
+    worker->stop();
+    workerThread->quit();
+    workerThread->wait();
+    delete worker;
+    delete workerThread;
+    worker = nullptr;
+    workerThread = nullptr;
+    workerPause = 0;
+    workerWaiting = false;
+    ENSURE(worker == nullptr && workerThread == nullptr, "Worker is not stopped");
+}
+
 void MainWindow::on_buttonAutoSimulationPausePlay_clicked() {
     REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
     changePauseState(pauseSimulation);
 }
 
 void MainWindow::on_actionExport_as_mp4_triggered() {
+    REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+
+    // The worker appends to the archive while the auto simulation runs
+    if (autoSimulation || !archive.isOpen() || archive.getDays(DayArchive::kBmp).empty()) {
+        MessageBox msg;
+        msg.setWindowTitle("VaccinDistributor");
+        msg.setText(autoSimulation ? "Stop the auto simulation first" : "There are no simulated days to export");
+        msg.setStyleSheet_();
+        msg.setStandardButtons(QMessageBox::Ok);
+        msg.autoClose = true;
+        msg.timeout = 2;
+        msg.exec();
+        return;
+    }
     QString pad = QFileDialog::getSaveFileName(nullptr, "Export as mp4", ".", "Movie (*.mp4)");
-    std::system(("rm '" + pad.toStdString() + "'").c_str());
-    std::system(("ffmpeg -framerate 1 -i Day-%1d.bmp '" + pad.toStdString() + "'").c_str());
+    if (pad.isEmpty()) {
+        return;
+    }
+
+    // The images are read from the archive in the order of the days and given to ffmpeg through a pipe
+    FILE *ffmpeg = popen(("ffmpeg -y -framerate 1 -f image2pipe -c:v bmp -i - '" + pad.toStdString() + "'").c_str(), "w");
+    if (ffmpeg == nullptr) {
+        return;
+    }
+    std::vector<int> days = archive.getDays(DayArchive::kBmp);
+    for (std::vector<int>::const_iterator it = days.begin(); it != days.end(); it++) {
+        std::string bmp = archive.read(*it, DayArchive::kBmp);
+        if (fwrite(bmp.data(), 1, bmp.size(), ffmpeg) != bmp.size()) {
+            break;
+        }
+    }
+    pclose(ffmpeg);
 }
 
 void MainWindow::on_dataButton_clicked() {
     REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
+    // The auto simulation uses the Simulation until the worker is paused between two days
+    if (worker != nullptr && !workerWaiting) {
+        return;
+    }
     // show errMsg when no .xml file was imported || simulation is not complete
     if (!s.checkSimulation() || !s.properlyInitialized()) {
         const char* errMsg = "Could not show centra!\nTry loading a new .xml file.";
@@ -394,8 +594,6 @@ void MainWindow::on_dataButton_clicked() {
         return;
     }
 
-    changePauseState(false);
-
     Dialog dialog;
     dialog.setModal(true);
     dialog.createModels(s.getFcentra(), s.getHub());
@@ -415,6 +613,15 @@ void MainWindow::changeStateButtons(bool state) {
 void MainWindow::changePauseState(bool state) {
     REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized");
     pauseSimulation = !state;
+    if (worker != nullptr) {
+        // The buttons that read the Simulation are enabled by workerPaused for a new pause
+        int pause = worker->setPaused(pauseSimulation);
+        if (!pauseSimulation || pause != workerPause) {
+            workerPause = pauseSimulation ? pause : 0;
+            workerWaiting = false;
+            ui->dataButton->setEnabled(false);
+        }
+    }
     if(!pauseSimulation){
         ui->buttonAutoSimulationPausePlay->setText("||");
     }
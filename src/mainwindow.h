@@ -22,6 +22,7 @@
 #include <ostream>
 #include "messagebox.h"
 #include "Simulation.h"
+#include "SimulationWorker.h"
 #include "Dialog.h"
 #include <QChart>
 #include <QLineSeries>
@@ -75,6 +76,8 @@ class MainWindow : public QMainWindow
 
     bool pauseSimulation = false;
     bool autoSimulation = false;
+    int workerPause = 0; ///< Number of the pause of the worker that was asked for, 0 when it runs
+    bool workerWaiting = false; ///< The worker sent paused for workerPause, the Simulation can be read
 public:
     /**
      * @brief Default constructor for MainWindow object
@@ -158,7 +161,7 @@ private slots:
     void on_buttonPrevious_clicked();
 
     /**
-     * @brief on_action_ini_triggered Delete all *.ini files in cwd
+     * @brief on_action_ini_triggered Remove the days of the archive of the simulation
      *
      * @pre
      * REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized")
@@ -166,7 +169,7 @@ private slots:
     void on_action_ini_triggered();
 
     /**
-     * @brief on_action_ini_triggered Delete all *.bmp files in cwd
+     * @brief on_action_bmp_triggered Remove the images of the days of the archive of the simulation
      *
      * @pre
      * REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized")
@@ -200,6 +203,45 @@ private slots:
     */
     void on_dataButton_clicked();
 
+    /**
+    * @brief Show the result of a day of the auto simulation, called on the GUI thread for every dayFinished of the worker
+    *
+    * @param result Result of the day
+    *
+    * @pre
+    * REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized")
+    */
+    void showDayResult(const SimulationWorker::DayResult &result);
+
+    /**
+    * @brief Show the error of a day of the auto simulation that failed
+    *
+    * @param message Message of the error
+    *
+    * @pre
+    * REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized")
+    */
+    void showSimulationError(const QString &message);
+
+    /**
+    * @brief Enable the buttons that read the Simulation when the worker is paused between two days, a pause that
+    *        already ended is ignored
+    *
+    * @param pause Number of the pause of the worker
+    *
+    * @pre
+    * REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized")
+    */
+    void workerPaused(int pause);
+
+    /**
+    * @brief Stop the worker and enable the buttons again when the auto simulation is done or stopped
+    *
+    * @pre
+    * REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized")
+    */
+    void autoSimulationFinished();
+
 private:
     Ui::MainWindow *ui;
     QStringListModel *modelVaccins; ///< Hold the vaccinData
@@ -208,6 +250,40 @@ private:
     MainWindow *_initCheck;
     BarGraph* typeDelivery = nullptr;
     LineGraph* vacinCount = nullptr;
+    QThread* workerThread = nullptr; ///< Thread of the auto simulation
+    SimulationWorker* worker = nullptr; ///< Simulates the days of the auto simulation on workerThread
+    DayArchive archive; ///< Image of every simulated day
+
+    /**
+     * @brief Append the image of a day to the archive, nothing happens when the archive is not open
+     *
+     * @param day Day of the image
+     * @param image Image of the day
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized")
+     */
+    void archiveImage(int day, const Image &image);
+
+    /**
+     * @brief Remove the days of the archive, the archive is removed when it is not open, nothing happens while the
+     *        auto simulation runs
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized")
+     */
+    void clearArchive();
+
+    /**
+     * @brief Stop the auto simulation and wait until its thread is done
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized")
+     *
+     * @post
+     * ENSURE(worker == nullptr && workerThread == nullptr, "Worker is not stopped")
+     */
+    void stopWorker();
 
     /**
      * @brief Create menu's
@@ -253,6 +329,26 @@ private:
      */
     void updateLabelImage(const QString &fileName);
 
+    /**
+     * @brief Update labelImage with an Image drawn in memory
+     *
+     * @param image The Image, see Simulation::render
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized")
+     */
+    void updateLabelImage(const Image &image);
+
+    /**
+     * @brief Show an image in labelImage, scaled to the size of labelImage
+     *
+     * @param image The image
+     *
+     * @pre
+     * REQUIRE(properlyInitialized(), "MainWindow object must be properly initialized")
+     */
+    void showLabelImage(QImage image);
+
     /**
      * @brief Update progressBarVaccinated
      *